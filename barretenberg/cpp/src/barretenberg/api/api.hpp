@@ -23,6 +23,8 @@ class API {
                                    // recursive verifier) or is it for an ivc verifier?
         bool write_vk{ false };    // should we addditionally write the verification key when writing the proof
         bool include_gates_per_opcode{ false }; // should we include gates_per_opcode in the gates command output
+        bool shard_constraints{ false }; // build ACIR hash and signature constraints in parallel (UltraHonk only). The
+                                         // vk is only valid for proofs built with the same setting.
 
         friend std::ostream& operator<<(std::ostream& os, const Flags& flags)
         {
@@ -41,6 +43,7 @@ class API {
                << "  verifier_type: " << flags.verifier_type << "\n"
                << "  write_vk " << flags.write_vk << "\n"
                << "  include_gates_per_opcode " << flags.include_gates_per_opcode << "\n"
+               << "  shard_constraints " << flags.shard_constraints << "\n"
                << "]" << std::endl;
             return os;
         }
@@ -22,6 +22,14 @@ void print_avm_stats()
 #endif
 }
 
+std::shared_ptr<const avm2::PrecomputedSnapshot> load_precomputed_snapshot(const std::filesystem::path& path)
+{
+    if (path.empty()) {
+        return nullptr;
+    }
+    return avm2::PrecomputedSnapshot::load_or_build(path);
+}
+
 } // namespace
 
 void avm_check_circuit(const std::filesystem::path&, const std::filesystem::path&)
@@ -60,9 +68,11 @@ void avm_prove(const std::filesystem::path&, const std::filesystem::path&, const
     vinfo("vk as fields written to: ", vk_fields_path);
 }
 
-void avm2_prove(const std::filesystem::path& inputs_path, const std::filesystem::path& output_path)
+void avm2_prove(const std::filesystem::path& inputs_path,
+                const std::filesystem::path& output_path,
+                const std::filesystem::path& precomputed_snapshot_path)
 {
-    avm2::AvmAPI avm;
+    avm2::AvmAPI avm(load_precomputed_snapshot(precomputed_snapshot_path));
     auto inputs = avm2::AvmAPI::ProvingInputs::from(read_file(inputs_path));
     auto [proof, vk] = avm.prove(inputs);
 
@@ -83,9 +93,44 @@ void avm2_prove(const std::filesystem::path& inputs_path, const std::filesystem:
     }
 }
 
-void avm2_check_circuit(const std::filesystem::path& inputs_path)
+void avm2_prove_batch(const std::vector<std::filesystem::path>& inputs_paths,
+                      const std::filesystem::path& output_path,
+                      const std::filesystem::path& precomputed_snapshot_path,
+                      size_t max_pending_traces)
 {
-    avm2::AvmAPI avm;
+    avm2::AvmAPI avm(load_precomputed_snapshot(precomputed_snapshot_path));
+    std::vector<avm2::AvmAPI::ProvingInputs> inputs;
+    inputs.reserve(inputs_paths.size());
+    for (const auto& inputs_path : inputs_paths) {
+        inputs.push_back(avm2::AvmAPI::ProvingInputs::from(read_file(inputs_path)));
+    }
+    auto proofs = avm.prove_batch(inputs, max_pending_traces);
+
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        const auto& [proof, vk] = proofs[i];
+        const auto tx_output_path = output_path / std::to_string(i);
+        std::filesystem::create_directories(tx_output_path);
+        write_file(tx_output_path / "proof", to_buffer(proof));
+        write_file(tx_output_path / "vk", vk);
+    }
+
+    print_avm_stats();
+
+    // As in avm2_prove, we also verify after proving.
+    info("verifying...");
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        const auto& [proof, vk] = proofs[i];
+        if (!avm.verify(proof, inputs[i].publicInputs, vk)) {
+            throw std::runtime_error("Generated proof of " + inputs_paths[i].string() + " is invalid!");
+        }
+    }
+    info("verification: success");
+}
+
+void avm2_check_circuit(const std::filesystem::path& inputs_path,
+                        const std::filesystem::path& precomputed_snapshot_path)
+{
+    avm2::AvmAPI avm(load_precomputed_snapshot(precomputed_snapshot_path));
     auto inputs = avm2::AvmAPI::ProvingInputs::from(read_file(inputs_path));
 
     bool res = avm.check_circuit(inputs);
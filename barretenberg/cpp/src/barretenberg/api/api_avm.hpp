@@ -1,5 +1,7 @@
 #ifndef DISABLE_AZTEC_VM
+#include <cstddef>
 #include <filesystem>
+#include <vector>
 
 namespace bb {
 
@@ -25,9 +27,30 @@ void avm_prove(const std::filesystem::path& public_inputs_path,
                const std::filesystem::path& hints_path,
                const std::filesystem::path& output_path);
 
-void avm2_prove(const std::filesystem::path& inputs_path, const std::filesystem::path& output_path);
+/**
+ * @brief Writes an avm2 proof and its verification key to output_path/{proof, vk}.
+ *
+ * @param precomputed_snapshot_path If not empty, the precomputed columns and their commitments are loaded from this
+ * file, which is (re)built first if it is missing or was built for another circuit.
+ */
+void avm2_prove(const std::filesystem::path& inputs_path,
+                const std::filesystem::path& output_path,
+                const std::filesystem::path& precomputed_snapshot_path = {});
+
+/**
+ * @brief Proves independent txs (e.g., the public txs of a block) in one process, see AvmAPI::prove_batch. The proof
+ * and verification key of the i-th inputs file are written to output_path/i/{proof, vk}.
+ *
+ * @param max_pending_traces Number of txs that are simulated and traced ahead of the one being proven. Each one holds
+ * its trace in memory.
+ */
+void avm2_prove_batch(const std::vector<std::filesystem::path>& inputs_paths,
+                      const std::filesystem::path& output_path,
+                      const std::filesystem::path& precomputed_snapshot_path = {},
+                      size_t max_pending_traces = 1);
 
-void avm2_check_circuit(const std::filesystem::path& inputs_path);
+void avm2_check_circuit(const std::filesystem::path& inputs_path,
+                        const std::filesystem::path& precomputed_snapshot_path = {});
 
 /**
  * @brief Verifies an avm proof and writes the result to stdout
@@ -16,7 +16,7 @@
 namespace bb {
 
 template <typename Flavor, typename Circuit = typename Flavor::CircuitBuilder>
-Circuit _compute_circuit(const std::string& bytecode_path, const std::string& witness_path)
+Circuit _compute_circuit(const std::string& bytecode_path, const std::string& witness_path, bool shard_constraints)
 {
     uint32_t honk_recursion = 0;
     if constexpr (IsAnyOf<Flavor, UltraFlavor, UltraKeccakFlavor, UltraKeccakZKFlavor>) {
@@ -30,7 +30,9 @@ Circuit _compute_circuit(const std::string& bytecode_path, const std::string& wi
     }
 #endif
 
-    const acir_format::ProgramMetadata metadata{ .honk_recursion = honk_recursion };
+    // write_vk and prove both build the circuit here, so that the vk matches the proofs of the same settings.
+    const acir_format::ProgramMetadata metadata{ .honk_recursion = honk_recursion,
+                                                 .shard_constraints = shard_constraints };
     acir_format::AcirProgram program{ get_constraint_system(bytecode_path) };
 
     if (!witness_path.empty()) {
@@ -40,25 +42,29 @@ Circuit _compute_circuit(const std::string& bytecode_path, const std::string& wi
 }
 
 template <typename Flavor>
-UltraProver_<Flavor> _compute_prover(const std::string& bytecode_path, const std::string& witness_path)
+UltraProver_<Flavor> _compute_prover(const std::string& bytecode_path,
+                                     const std::string& witness_path,
+                                     bool shard_constraints)
 {
-    return UltraProver_<Flavor>{ _compute_circuit<Flavor>(bytecode_path, witness_path) };
+    return UltraProver_<Flavor>{ _compute_circuit<Flavor>(bytecode_path, witness_path, shard_constraints) };
 }
 
 template <typename Flavor, typename VK = typename Flavor::VerificationKey>
 PubInputsProofAndKey<VK> _compute_vk(const std::filesystem::path& bytecode_path,
-                                     const std::filesystem::path& witness_path)
+                                     const std::filesystem::path& witness_path,
+                                     bool shard_constraints)
 {
-    auto prover = _compute_prover<Flavor>(bytecode_path.string(), witness_path.string());
+    auto prover = _compute_prover<Flavor>(bytecode_path.string(), witness_path.string(), shard_constraints);
     return { PublicInputsVector{}, HonkProof{}, std::make_shared<VK>(prover.proving_key->proving_key) };
 }
 
 template <typename Flavor, typename VK = typename Flavor::VerificationKey>
 PubInputsProofAndKey<VK> _prove(const bool compute_vk,
                                 const std::filesystem::path& bytecode_path,
-                                const std::filesystem::path& witness_path)
+                                const std::filesystem::path& witness_path,
+                                bool shard_constraints)
 {
-    auto prover = _compute_prover<Flavor>(bytecode_path.string(), witness_path.string());
+    auto prover = _compute_prover<Flavor>(bytecode_path.string(), witness_path.string(), shard_constraints);
     HonkProof concat_pi_and_proof = prover.construct_proof();
     size_t num_inner_public_inputs = prover.proving_key->proving_key.num_public_inputs;
     // Loose check that the public inputs contain a pairing point accumulator, doesn't catch everything.
@@ -151,18 +157,18 @@ void UltraHonkAPI::prove(const Flags& flags,
     };
 
     if (flags.ipa_accumulation) {
-        _write(_prove<UltraRollupFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraRollupFlavor>(flags.write_vk, bytecode_path, witness_path, flags.shard_constraints));
     } else if (flags.oracle_hash_type == "poseidon2") {
-        _write(_prove<UltraFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraFlavor>(flags.write_vk, bytecode_path, witness_path, flags.shard_constraints));
     } else if (flags.oracle_hash_type == "keccak" && !flags.zk) {
-        _write(_prove<UltraKeccakFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraKeccakFlavor>(flags.write_vk, bytecode_path, witness_path, flags.shard_constraints));
     } else if (flags.oracle_hash_type == "keccak" && flags.zk) {
-        _write(_prove<UltraKeccakZKFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraKeccakZKFlavor>(flags.write_vk, bytecode_path, witness_path, flags.shard_constraints));
 #ifdef STARKNET_GARAGA_FLAVORS
     } else if (flags.oracle_hash_type == "starknet" && !flags.zk) {
-        _write(_prove<UltraStarknetFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraStarknetFlavor>(flags.write_vk, bytecode_path, witness_path, flags.shard_constraints));
     } else if (flags.oracle_hash_type == "starknet" && flags.zk) {
-        _write(_prove<UltraStarknetZKFlavor>(flags.write_vk, bytecode_path, witness_path));
+        _write(_prove<UltraStarknetZKFlavor>(flags.write_vk, bytecode_path, witness_path, flags.shard_constraints));
 #endif
     } else {
         throw_or_abort("Invalid proving options specified in _prove");
@@ -218,19 +224,19 @@ void UltraHonkAPI::write_vk(const Flags& flags,
     const auto _write = [&](auto&& _prove_output) { write(_prove_output, flags.output_format, "vk", output_path); };
 
     if (flags.ipa_accumulation) {
-        _write(_compute_vk<UltraRollupFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraRollupFlavor>(bytecode_path, "", flags.shard_constraints));
     } else if (flags.oracle_hash_type == "poseidon2") {
-        _write(_compute_vk<UltraFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraFlavor>(bytecode_path, "", flags.shard_constraints));
     } else if (flags.oracle_hash_type == "keccak" && !flags.zk) {
-        _write(_compute_vk<UltraKeccakFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraKeccakFlavor>(bytecode_path, "", flags.shard_constraints));
 #ifdef STARKNET_GARAGA_FLAVORS
     } else if (flags.oracle_hash_type == "starknet" && !flags.zk) {
-        _write(_compute_vk<UltraStarknetFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraStarknetFlavor>(bytecode_path, "", flags.shard_constraints));
     } else if (flags.oracle_hash_type == "starknet" && flags.zk) {
-        _write(_compute_vk<UltraStarknetZKFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraStarknetZKFlavor>(bytecode_path, "", flags.shard_constraints));
 #endif
     } else if (flags.oracle_hash_type == "keccak" && flags.zk) {
-        _write(_compute_vk<UltraKeccakZKFlavor>(bytecode_path, ""));
+        _write(_compute_vk<UltraKeccakZKFlavor>(bytecode_path, "", flags.shard_constraints));
     } else {
         throw_or_abort("Invalid proving options specified in _prove");
     }
@@ -0,0 +1,293 @@
+#include "prover_server.hpp"
+#include "barretenberg/api/api_ultra_honk.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/stdlib_circuit_builders/plookup_tables/plookup_tables.hpp"
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+bool write_all(int fd, const char* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t written = send(fd, data, size, MSG_NOSIGNAL);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+// The requests only carry a few short strings, so that no header of a malformed message can ask for a large
+// allocation. Exceeding a limit throws, like malformed bytes do.
+const msgpack::unpack_limit MESSAGE_LIMIT(/*array=*/1 << 10,
+                                          /*map=*/1 << 10,
+                                          /*str=*/1 << 20,
+                                          /*bin=*/1 << 20,
+                                          /*ext=*/1 << 20,
+                                          /*depth=*/32);
+
+// Strings reference the unpacker's buffer instead of being copied.
+bool reference_buffer(msgpack::type::object_type /*type*/, std::size_t /*size*/, void* /*user_data*/)
+{
+    return true;
+}
+
+} // namespace
+
+namespace bb {
+
+ProverServer::ProverServer(ProverServerOptions options)
+    : options(std::move(options))
+{
+    if (this->options.max_concurrent_requests == 0) {
+        this->options.max_concurrent_requests = 1;
+    }
+    register_handlers();
+}
+
+ProverServer::~ProverServer()
+{
+    stop();
+    for (auto& connection : connections) {
+        if (connection.thread.joinable()) {
+            connection.thread.join();
+        }
+    }
+}
+
+template <typename Request>
+void ProverServer::register_handler(ProverServerMessageType type,
+                                    ProverServerResponse (ProverServer::*handler)(const Request&))
+{
+    dispatcher.register_target(type, [this, type, handler](msgpack::object& obj, msgpack::sbuffer& buffer) {
+        messaging::TypedMessage<Request> request;
+        obj.convert(request);
+
+        ProverServerResponse response;
+        acquire_request_slot();
+        try {
+            response = (this->*handler)(request.value);
+            response.success = true;
+        } catch (const std::exception& e) {
+            response.error = e.what();
+        }
+        release_request_slot();
+
+        messaging::MsgHeader header(request.header.messageId);
+        messaging::TypedMessage<ProverServerResponse> resp_msg(type, header, response);
+        msgpack::pack(buffer, resp_msg);
+        return true;
+    });
+}
+
+void ProverServer::register_handlers()
+{
+    register_handler(ProverServerMessageType::PROVE, &ProverServer::prove);
+    register_handler(ProverServerMessageType::VERIFY, &ProverServer::verify);
+    register_handler(ProverServerMessageType::WRITE_VK, &ProverServer::write_vk);
+
+    dispatcher.register_target(messaging::SystemMsgTypes::PING,
+                               [](msgpack::object& obj, msgpack::sbuffer& buffer) {
+                                   messaging::HeaderOnlyMessage request;
+                                   obj.convert(request);
+                                   messaging::MsgHeader header(request.header.messageId);
+                                   messaging::HeaderOnlyMessage pong(messaging::SystemMsgTypes::PONG, header);
+                                   msgpack::pack(buffer, pong);
+                                   return true;
+                               });
+    // Returning false closes the connection, see serve_connection.
+    dispatcher.register_target(messaging::SystemMsgTypes::TERMINATE,
+                               [this](msgpack::object&, msgpack::sbuffer&) {
+                                   stop();
+                                   return false;
+                               });
+}
+
+ProverServerResponse ProverServer::prove(const ProveRequest& request)
+{
+    std::filesystem::create_directories(request.output_path);
+    UltraHonkAPI api;
+    api.prove(request.flags.to_api_flags(), request.bytecode_path, request.witness_path, request.output_path);
+    return {};
+}
+
+ProverServerResponse ProverServer::verify(const VerifyRequest& request)
+{
+    UltraHonkAPI api;
+    const bool verified =
+        api.verify(request.flags.to_api_flags(), request.public_inputs_path, request.proof_path, request.vk_path);
+    return { .verified = verified };
+}
+
+ProverServerResponse ProverServer::write_vk(const WriteVkRequest& request)
+{
+    std::filesystem::create_directories(request.output_path);
+    UltraHonkAPI api;
+    api.write_vk(request.flags.to_api_flags(), request.bytecode_path, request.output_path);
+    return {};
+}
+
+void ProverServer::acquire_request_slot()
+{
+    std::unique_lock lock(requests_mutex);
+    request_finished.wait(lock, [&] { return num_running_requests < options.max_concurrent_requests; });
+    ++num_running_requests;
+}
+
+void ProverServer::release_request_slot()
+{
+    {
+        std::unique_lock lock(requests_mutex);
+        --num_running_requests;
+    }
+    request_finished.notify_one();
+}
+
+void ProverServer::run()
+{
+    // Everything that is shared between requests is initialized up front rather than by the first request(s).
+    plookup::get_multitable(plookup::MultiTableId::UINT32_XOR);
+    if (options.warm_crs_log_size > 0) {
+        srs::get_bn254_crs_factory()->get_crs(size_t(1) << options.warm_crs_log_size);
+    }
+
+    const std::string socket_path = options.socket_path.string();
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw_or_abort("Socket path is too long: " + socket_path);
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw_or_abort(std::string("Could not create socket: ") + strerror(errno));
+    }
+    // A stale socket file from a previous server would make bind fail.
+    unlink(socket_path.c_str());
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0) {
+        close(fd);
+        throw_or_abort("Could not listen on " + socket_path + ": " + strerror(errno));
+    }
+    listen_fd = fd;
+    info("Listening on ", socket_path, ", max concurrent requests: ", options.max_concurrent_requests);
+
+    while (!stopping) {
+        int connection_fd = accept(fd, nullptr, nullptr);
+        if (connection_fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            // stop() shuts the listening socket down to get us here.
+            break;
+        }
+        std::unique_lock lock(connections_mutex);
+        if (stopping) {
+            close(connection_fd);
+            break;
+        }
+        // A long-lived server sees many short connections, so their threads are joined as we go rather than at the end.
+        reap_connections();
+        connection_fds.push_back(connection_fd);
+        Connection& connection = connections.emplace_back();
+        connection.thread =
+            std::thread([this, connection_fd, &connection] { serve_connection(connection_fd, connection); });
+    }
+
+    stop();
+    // The connections take the mutex to unregister their fd, so join them without holding it. Only this thread erases
+    // connections (see reap_connections).
+    for (auto& connection : connections) {
+        connection.thread.join();
+    }
+    connections.clear();
+    close(fd);
+    listen_fd = -1;
+    unlink(socket_path.c_str());
+}
+
+void ProverServer::stop()
+{
+    if (stopping.exchange(true)) {
+        return;
+    }
+    if (int fd = listen_fd; fd >= 0) {
+        shutdown(fd, SHUT_RDWR);
+    }
+    // Wake up the connections waiting for a request; the ones busy with a request finish it first.
+    std::unique_lock lock(connections_mutex);
+    for (int fd : connection_fds) {
+        shutdown(fd, SHUT_RD);
+    }
+}
+
+void ProverServer::reap_connections()
+{
+    std::erase_if(connections, [](Connection& connection) {
+        if (!connection.done) {
+            return false;
+        }
+        connection.thread.join();
+        return true;
+    });
+}
+
+void ProverServer::serve_connection(int fd, Connection& connection)
+{
+    msgpack::unpacker unpacker(reference_buffer, nullptr, MSGPACK_UNPACKER_INIT_BUFFER_SIZE, MESSAGE_LIMIT);
+    bool open = true;
+    // Anything thrown here would terminate the whole server, so a bad message only closes its connection.
+    try {
+        while (open) {
+            const size_t BUFFER_SIZE = 1 << 16;
+            unpacker.reserve_buffer(BUFFER_SIZE);
+            const ssize_t num_read = ::read(fd, unpacker.buffer(), unpacker.buffer_capacity());
+            if (num_read < 0 && errno == EINTR) {
+                continue;
+            }
+            if (num_read <= 0) {
+                break;
+            }
+            unpacker.buffer_consumed(static_cast<size_t>(num_read));
+
+            msgpack::object_handle handle;
+            while (open && unpacker.next(handle)) {
+                msgpack::object obj = handle.get();
+                msgpack::sbuffer buffer;
+                open = dispatcher.on_new_data(obj, buffer);
+                if (buffer.size() > 0 && !write_all(fd, buffer.data(), buffer.size())) {
+                    open = false;
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        // We can not tell which request the message was, so we can not answer it either.
+        info("Closing connection after malformed message: ", e.what());
+    }
+
+    std::unique_lock lock(connections_mutex);
+    std::erase(connection_fds, fd);
+    close(fd);
+    // Nothing touches the connection after this, the thread only has to return.
+    connection.done = true;
+}
+
+void serve(const ProverServerOptions& options)
+{
+    ProverServer server(options);
+    server.run();
+}
+
+} // namespace bb
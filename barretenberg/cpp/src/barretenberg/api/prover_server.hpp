@@ -0,0 +1,161 @@
+#pragma once
+
+#include "barretenberg/api/api.hpp"
+#include "barretenberg/messaging/dispatcher.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Messages understood by `bb serve`.
+ * @details Requests are TypedMessage<...Request> and are answered with a TypedMessage<ProverServerResponse> of the same
+ * type, whose header.requestId is the messageId of the request. The system messages are supported too: PING is
+ * answered with PONG and TERMINATE shuts the server down.
+ */
+enum ProverServerMessageType {
+    PROVE = messaging::FIRST_APP_MSG_TYPE,
+    VERIFY,
+    WRITE_VK,
+};
+
+// The subset of API::Flags that can be set per request. The scheme is always ultra_honk.
+struct ProverServerFlags {
+    bool zk = false;
+    bool ipa_accumulation = false;
+    bool write_vk = false;
+    std::string oracle_hash_type = "poseidon2";
+    std::string output_format = "bytes";
+    // Must be the same in the prove and write_vk requests of a circuit, see API::Flags.
+    bool shard_constraints = false;
+
+    MSGPACK_FIELDS(zk, ipa_accumulation, write_vk, oracle_hash_type, output_format, shard_constraints);
+
+    API::Flags to_api_flags() const
+    {
+        return { .zk = zk,
+                 .ipa_accumulation = ipa_accumulation,
+                 .scheme = "ultra_honk",
+                 .oracle_hash_type = oracle_hash_type,
+                 .output_format = output_format,
+                 .write_vk = write_vk,
+                 .shard_constraints = shard_constraints };
+    }
+};
+
+// Same as `bb prove`: reads the bytecode and witness, writes the proof (and vk) to output_path.
+struct ProveRequest {
+    std::string bytecode_path;
+    std::string witness_path;
+    std::string output_path;
+    ProverServerFlags flags;
+    MSGPACK_FIELDS(bytecode_path, witness_path, output_path, flags);
+};
+
+// Same as `bb verify`.
+struct VerifyRequest {
+    std::string public_inputs_path;
+    std::string proof_path;
+    std::string vk_path;
+    ProverServerFlags flags;
+    MSGPACK_FIELDS(public_inputs_path, proof_path, vk_path, flags);
+};
+
+// Same as `bb write_vk`.
+struct WriteVkRequest {
+    std::string bytecode_path;
+    std::string output_path;
+    ProverServerFlags flags;
+    MSGPACK_FIELDS(bytecode_path, output_path, flags);
+};
+
+struct ProverServerResponse {
+    bool success = false;
+    // Only meaningful for VERIFY.
+    bool verified = false;
+    std::string error;
+    MSGPACK_FIELDS(success, verified, error);
+};
+
+struct ProverServerOptions {
+    std::filesystem::path socket_path;
+    // Requests beyond this many wait for one to finish. Each request uses all the threads, so concurrency mostly helps
+    // to overlap the serial parts (witness generation, circuit construction, I/O) of small circuits.
+    size_t max_concurrent_requests = 1;
+    // If non zero, the CRS for circuits of up to 2^warm_crs_log_size gates is loaded before accepting connections.
+    size_t warm_crs_log_size = 0;
+};
+
+/**
+ * @brief Long-lived prover listening on a Unix domain socket (`bb serve`).
+ * @details Compared to running `bb prove` once per circuit, the CRS (and its pippenger point table), the plookup tables
+ * and the memory slabs of the allocator stay warm between requests.
+ *
+ * Each connection is served by its own thread and carries a stream of msgpack messages; the requests of a connection
+ * are answered in order. The CRS factory must have been initialized.
+ */
+class ProverServer {
+  public:
+    explicit ProverServer(ProverServerOptions options);
+    ProverServer(const ProverServer&) = delete;
+    ProverServer& operator=(const ProverServer&) = delete;
+    virtual ~ProverServer();
+
+    // Binds the socket and serves requests until stop() is called or a TERMINATE message is received.
+    void run();
+    // Can be called from any thread, including the handler of a request.
+    void stop();
+
+  protected:
+    // The handlers of the requests, run while holding a request slot. Errors are sent back in the response.
+    virtual ProverServerResponse prove(const ProveRequest& request);
+    virtual ProverServerResponse verify(const VerifyRequest& request);
+    virtual ProverServerResponse write_vk(const WriteVkRequest& request);
+
+  private:
+    struct Connection {
+        std::thread thread;
+        // Set by the thread when it is done with the connection, so that the accept loop can join it.
+        std::atomic_bool done = false;
+    };
+
+    void serve_connection(int fd, Connection& connection);
+    void register_handlers();
+    // Joins the connections that are done. Must hold connections_mutex.
+    void reap_connections();
+
+    template <typename Request>
+    void register_handler(ProverServerMessageType type, ProverServerResponse (ProverServer::*handler)(const Request&));
+
+    // Blocks until fewer than max_concurrent_requests requests are running.
+    void acquire_request_slot();
+    void release_request_slot();
+
+    ProverServerOptions options;
+    messaging::MessageDispatcher dispatcher;
+
+    std::mutex requests_mutex;
+    std::condition_variable request_finished;
+    size_t num_running_requests = 0;
+
+    std::atomic_bool stopping = false;
+    std::atomic_int listen_fd = -1;
+    std::mutex connections_mutex;
+    std::vector<int> connection_fds;
+    // A list so that the threads can refer to their connection while others are added and removed.
+    std::list<Connection> connections;
+};
+
+// Entry point of `bb serve`.
+void serve(const ProverServerOptions& options);
+
+} // namespace bb
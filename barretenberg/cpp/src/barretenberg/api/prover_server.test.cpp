@@ -0,0 +1,355 @@
+#include "barretenberg/api/prover_server.hpp"
+#include "barretenberg/api/exec_pipe.hpp"
+#include "barretenberg/api/file_io.hpp"
+#include "barretenberg/dsl/acir_format/serde/index.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace bb;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Connects to the server, retrying while it has not started listening yet.
+class Client {
+  public:
+    explicit Client(const fs::path& socket_path)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+        for (size_t attempt = 0; attempt < 1000; ++attempt) {
+            fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+                return;
+            }
+            close(fd);
+            fd = -1;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        throw std::runtime_error("Could not connect to " + socket_path.string());
+    }
+    Client(const Client&) = delete;
+    Client& operator=(const Client&) = delete;
+    ~Client()
+    {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    template <typename Request> ProverServerResponse send(ProverServerMessageType type, const Request& request)
+    {
+        messaging::MsgHeader header(++message_id, 0);
+        write(messaging::TypedMessage<Request>(type, header, request));
+        messaging::TypedMessage<ProverServerResponse> response;
+        read().get().convert(response);
+        EXPECT_EQ(response.msgType, static_cast<uint32_t>(type));
+        EXPECT_EQ(response.header.requestId, message_id);
+        return response.value;
+    }
+
+    void ping()
+    {
+        messaging::MsgHeader header(++message_id, 0);
+        write(messaging::HeaderOnlyMessage(messaging::SystemMsgTypes::PING, header));
+        messaging::HeaderOnlyMessage pong;
+        read().get().convert(pong);
+        EXPECT_EQ(pong.msgType, static_cast<uint32_t>(messaging::SystemMsgTypes::PONG));
+        EXPECT_EQ(pong.header.requestId, message_id);
+    }
+
+    void terminate()
+    {
+        messaging::MsgHeader header(++message_id, 0);
+        write(messaging::HeaderOnlyMessage(messaging::SystemMsgTypes::TERMINATE, header));
+    }
+
+    void write_raw(const std::vector<uint8_t>& bytes)
+    {
+        ASSERT_EQ(::write(fd, bytes.data(), bytes.size()), static_cast<ssize_t>(bytes.size()));
+    }
+
+    // Whether the server closed the connection (without sending anything else).
+    bool closed_by_server()
+    {
+        char byte = 0;
+        return ::read(fd, &byte, 1) == 0;
+    }
+
+  private:
+    template <typename Message> void write(const Message& message)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, message);
+        ASSERT_EQ(::write(fd, buffer.data(), buffer.size()), static_cast<ssize_t>(buffer.size()));
+    }
+
+    msgpack::object_handle read()
+    {
+        msgpack::object_handle handle;
+        while (!unpacker.next(handle)) {
+            unpacker.reserve_buffer(1 << 12);
+            const ssize_t num_read = ::read(fd, unpacker.buffer(), unpacker.buffer_capacity());
+            if (num_read <= 0) {
+                throw std::runtime_error("Connection closed while waiting for a response");
+            }
+            unpacker.buffer_consumed(static_cast<size_t>(num_read));
+        }
+        return handle;
+    }
+
+    int fd = -1;
+    uint32_t message_id = 0;
+    msgpack::unpacker unpacker;
+};
+
+std::string to_hex(const fr& value)
+{
+    std::ostringstream stream;
+    stream << uint256_t(value);
+    return stream.str();
+}
+
+// Writes `w0 * w0 == w1` (w1 public) and a witness for it, gzipped like nargo does.
+void write_square_circuit(const fs::path& bytecode_path, const fs::path& witness_path, uint64_t x)
+{
+    Acir::Expression expression{ .mul_terms = { { to_hex(fr(1)), Acir::Witness{ 0 }, Acir::Witness{ 0 } } },
+                                 .linear_combinations = { { to_hex(-fr(1)), Acir::Witness{ 1 } } },
+                                 .q_c = to_hex(fr(0)) };
+    Acir::Circuit circuit{ .current_witness_index = 1,
+                           .opcodes = { Acir::Opcode{ .value = Acir::Opcode::AssertZero{ .value = expression } } },
+                           .expression_width = Acir::ExpressionWidth{ .value = Acir::ExpressionWidth::Unbounded{} },
+                           .private_parameters = { Acir::Witness{ 0 } },
+                           .public_parameters = Acir::PublicInputs{ .value = { Acir::Witness{ 1 } } },
+                           .return_values = {},
+                           .assert_messages = {} };
+    Acir::Program program{ .functions = { circuit }, .unconstrained_functions = {} };
+
+    Witnesses::WitnessMap witness{ .value = { { Witnesses::Witness{ 0 }, to_hex(fr(x)) },
+                                              { Witnesses::Witness{ 1 }, to_hex(fr(x * x)) } } };
+    Witnesses::WitnessStack witness_stack{ .stack = { Witnesses::StackItem{ .index = 0, .witness = witness } } };
+
+    for (const auto& [path, data] : { std::make_pair(bytecode_path, program.bincodeSerialize()),
+                                      std::make_pair(witness_path, witness_stack.bincodeSerialize()) }) {
+        const fs::path raw_path = path.string() + ".raw";
+        write_file(raw_path, data);
+        exec_pipe("gzip -c \"" + raw_path.string() + "\" > \"" + path.string() + "\"");
+    }
+}
+
+class ProverServerTest : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { srs::init_file_crs_factory(srs::bb_crs_path()); }
+
+    void SetUp() override
+    {
+        dir = fs::temp_directory_path() /
+              ("prover_server_" + std::to_string(getpid()) + "_" +
+               ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::create_directories(dir);
+    }
+
+    void TearDown() override { fs::remove_all(dir); }
+
+    ProverServerOptions options(size_t max_concurrent_requests = 1) const
+    {
+        return { .socket_path = dir / "bb.sock", .max_concurrent_requests = max_concurrent_requests };
+    }
+
+    fs::path dir;
+};
+
+TEST_F(ProverServerTest, PingAndTerminate)
+{
+    ProverServer server(options());
+    std::thread server_thread([&] { server.run(); });
+
+    Client client(dir / "bb.sock");
+    client.ping();
+    client.ping();
+    client.terminate();
+    EXPECT_TRUE(client.closed_by_server());
+
+    server_thread.join();
+    EXPECT_FALSE(fs::exists(dir / "bb.sock"));
+}
+
+TEST_F(ProverServerTest, SurvivesMalformedMessages)
+{
+    ProverServer server(options());
+    std::thread server_thread([&] { server.run(); });
+
+    const std::vector<std::vector<uint8_t>> malformed_messages = {
+        // 0xc1 is never used by msgpack.
+        { 0xc1, 0x00, 0x01 },
+        // An array of 2^32 - 1 elements.
+        { 0xdd, 0xff, 0xff, 0xff, 0xff },
+        // A string of 2^32 - 1 bytes.
+        { 0xdb, 0xff, 0xff, 0xff, 0xff },
+        // A valid message that is not a request.
+        { 0x93, 0x01, 0x02, 0x03 },
+    };
+    for (const auto& message : malformed_messages) {
+        Client client(dir / "bb.sock");
+        client.write_raw(message);
+        EXPECT_TRUE(client.closed_by_server());
+
+        Client other_client(dir / "bb.sock");
+        other_client.ping();
+    }
+
+    server.stop();
+    server_thread.join();
+}
+
+TEST_F(ProverServerTest, ProveAndVerify)
+{
+    write_square_circuit(dir / "program.gz", dir / "witness.gz", 7);
+    ProverServer server(options());
+    std::thread server_thread([&] { server.run(); });
+
+    Client client(dir / "bb.sock");
+    ProverServerFlags flags{ .write_vk = true };
+    auto proved = client.send(
+        PROVE,
+        ProveRequest{ (dir / "program.gz").string(), (dir / "witness.gz").string(), (dir / "out").string(), flags });
+    ASSERT_TRUE(proved.success) << proved.error;
+
+    auto verified = client.send(VERIFY,
+                                VerifyRequest{ (dir / "out" / "public_inputs").string(),
+                                               (dir / "out" / "proof").string(),
+                                               (dir / "out" / "vk").string(),
+                                               flags });
+    EXPECT_TRUE(verified.success) << verified.error;
+    EXPECT_TRUE(verified.verified);
+
+    // A failing request is reported and does not take the connection down.
+    auto failed = client.send(PROVE,
+                              ProveRequest{ (dir / "missing.gz").string(),
+                                            (dir / "witness.gz").string(),
+                                            (dir / "out_missing").string(),
+                                            flags });
+    EXPECT_FALSE(failed.success);
+    EXPECT_FALSE(failed.error.empty());
+    client.ping();
+
+    server.stop();
+    server_thread.join();
+}
+
+// Blocks the PROVE requests until released, to observe how many run at the same time.
+class BlockingProverServer : public ProverServer {
+  public:
+    using ProverServer::ProverServer;
+
+    void wait_for_running(size_t expected)
+    {
+        std::unique_lock lock(mutex);
+        ASSERT_TRUE(changed.wait_for(lock, std::chrono::seconds(30), [&] { return running == expected; }));
+    }
+
+    size_t get_running()
+    {
+        std::unique_lock lock(mutex);
+        return running;
+    }
+
+    void release()
+    {
+        {
+            std::unique_lock lock(mutex);
+            released = true;
+        }
+        changed.notify_all();
+    }
+
+  protected:
+    ProverServerResponse prove(const ProveRequest&) override
+    {
+        std::unique_lock lock(mutex);
+        ++running;
+        changed.notify_all();
+        changed.wait(lock, [&] { return released; });
+        --running;
+        return {};
+    }
+
+  private:
+    std::mutex mutex;
+    std::condition_variable changed;
+    size_t running = 0;
+    bool released = false;
+};
+
+TEST_F(ProverServerTest, LimitsConcurrentRequests)
+{
+    BlockingProverServer server(options(/*max_concurrent_requests=*/2));
+    std::thread server_thread([&] { server.run(); });
+
+    const size_t NUM_CLIENTS = 4;
+    std::vector<std::thread> clients;
+    for (size_t i = 0; i < NUM_CLIENTS; ++i) {
+        clients.emplace_back([&] {
+            Client client(dir / "bb.sock");
+            EXPECT_TRUE(client.send(PROVE, ProveRequest{}).success);
+        });
+    }
+
+    server.wait_for_running(2);
+    // Give the other requests a chance to (wrongly) start.
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_EQ(server.get_running(), 2);
+    server.release();
+    for (auto& client : clients) {
+        client.join();
+    }
+
+    server.stop();
+    server_thread.join();
+}
+
+TEST_F(ProverServerTest, StopFinishesRunningRequestsAndClosesConnections)
+{
+    BlockingProverServer server(options());
+    std::thread server_thread([&] { server.run(); });
+
+    Client idle_client(dir / "bb.sock");
+    idle_client.ping();
+    std::thread busy_client([&] {
+        Client client(dir / "bb.sock");
+        EXPECT_TRUE(client.send(PROVE, ProveRequest{}).success);
+    });
+    server.wait_for_running(1);
+
+    server.stop();
+    EXPECT_TRUE(idle_client.closed_by_server());
+    // The running request is answered before its connection is closed.
+    server.release();
+    busy_client.join();
+    server_thread.join();
+    EXPECT_FALSE(fs::exists(dir / "bb.sock"));
+}
+
+TEST_F(ProverServerTest, ServesManyConnections)
+{
+    ProverServer server(options());
+    std::thread server_thread([&] { server.run(); });
+    for (size_t i = 0; i < 100; ++i) {
+        Client client(dir / "bb.sock");
+        client.ping();
+    }
+    server.stop();
+    server_thread.join();
+}
+
+} // namespace
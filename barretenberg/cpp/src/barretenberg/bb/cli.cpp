@@ -19,6 +19,7 @@
 #include "barretenberg/api/api_ultra_honk.hpp"
 #include "barretenberg/api/gate_count.hpp"
 #include "barretenberg/api/prove_tube.hpp"
+#include "barretenberg/api/prover_server.hpp"
 #include "barretenberg/bb/cli11_formatter.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/honk/types/aggregation_object_type.hpp"
@@ -268,6 +269,15 @@ int parse_and_run_cli_command(int argc, char* argv[])
         return subcommand->add_flag("--debug_logging, -d", flags.debug, "Output debug logs to stderr.");
     };
 
+    const auto add_shard_constraints_flag = [&](CLI::App* subcommand) {
+        return subcommand->add_flag(
+            "--shard_constraints",
+            flags.shard_constraints,
+            "Build the hash and signature constraints of an UltraHonk circuit in parallel. The gates are ordered "
+            "differently, so the verification key only verifies proofs built with the same setting: pass it to both "
+            "write_vk and prove, or to neither.");
+    };
+
     const auto add_include_gates_per_opcode_flag = [&](CLI::App* subcommand) {
         return subcommand->add_flag("--include_gates_per_opcode",
                                     flags.include_gates_per_opcode,
@@ -335,6 +345,7 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_ipa_accumulation_flag(prove);
     add_recursive_flag(prove);
     add_honk_recursion_option(prove);
+    add_shard_constraints_flag(prove);
 
     prove->add_flag("--verify", "Verify the proof natively, resulting in a boolean output. Useful for testing.");
 
@@ -361,6 +372,7 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_ipa_accumulation_flag(write_vk);
     add_honk_recursion_option(write_vk);
     add_recursive_flag(write_vk);
+    add_shard_constraints_flag(write_vk);
     add_verifier_type_option(write_vk)->default_val("standalone");
 
     /***************************************************************************************************************
@@ -400,6 +412,27 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_zk_option(write_solidity_verifier);
     add_crs_path_option(write_solidity_verifier);
 
+    /***************************************************************************************************************
+     * Subcommand: serve
+     ***************************************************************************************************************/
+    CLI::App* serve_command =
+        app.add_subcommand("serve",
+                           "Run a long-lived UltraHonk prover that serves prove, verify and write_vk requests (msgpack "
+                           "messages, see api/prover_server.hpp) on a Unix domain socket. The CRS and lookup tables are "
+                           "kept in memory between requests.");
+    ProverServerOptions serve_options{ .socket_path = "./bb.sock" };
+    serve_command->add_option("--socket_path", serve_options.socket_path, "Path of the Unix domain socket to listen on.");
+    serve_command->add_option("--max_concurrent_requests",
+                              serve_options.max_concurrent_requests,
+                              "Number of requests that are served at the same time. Further requests wait.");
+    serve_command->add_option("--warm_crs_log_size",
+                              serve_options.warm_crs_log_size,
+                              "Load the CRS for circuits of up to 2^warm_crs_log_size gates before serving requests.");
+
+    add_verbose_flag(serve_command);
+    add_debug_flag(serve_command);
+    add_crs_path_option(serve_command);
+
     /***************************************************************************************************************
      * Subcommand: OLD_API
      ***************************************************************************************************************/
@@ -488,6 +521,13 @@ int parse_and_run_cli_command(int argc, char* argv[])
     const auto add_avm_inputs_option = [&](CLI::App* subcommand) {
         return subcommand->add_option("--avm-inputs", avm_inputs_path, "");
     };
+    std::filesystem::path avm_precomputed_snapshot_path;
+    const auto add_avm_precomputed_snapshot_option = [&](CLI::App* subcommand) {
+        return subcommand->add_option("--avm-precomputed-snapshot",
+                                      avm_precomputed_snapshot_path,
+                                      "Path to a file with the precomputed columns and their commitments. It is "
+                                      "built if it is missing or outdated, and reused by later runs.");
+    };
     std::filesystem::path avm_public_inputs_path{ "./target/avm_public_inputs.bin" };
     const auto add_avm_public_inputs_option = [&](CLI::App* subcommand) {
         return subcommand->add_option("--avm-public-inputs", avm_public_inputs_path, "");
@@ -504,6 +544,29 @@ int parse_and_run_cli_command(int argc, char* argv[])
     std::filesystem::path avm2_prove_output_path{ "./proofs" };
     add_output_path_option(avm2_prove_command, avm2_prove_output_path);
     add_avm_inputs_option(avm2_prove_command);
+    add_avm_precomputed_snapshot_option(avm2_prove_command);
+
+    /***************************************************************************************************************
+     * Subcommand: avm2_prove_batch
+     ***************************************************************************************************************/
+    CLI::App* avm2_prove_batch_command = app.add_subcommand("avm2_prove_batch", "");
+    avm2_prove_batch_command->group(""); // hide from list of subcommands
+    add_verbose_flag(avm2_prove_batch_command);
+    add_debug_flag(avm2_prove_batch_command);
+    add_crs_path_option(avm2_prove_batch_command);
+    std::filesystem::path avm2_prove_batch_output_path{ "./proofs" };
+    add_output_path_option(avm2_prove_batch_command, avm2_prove_batch_output_path);
+    std::vector<std::filesystem::path> avm_batch_inputs_paths;
+    avm2_prove_batch_command
+        ->add_option("--avm-inputs",
+                     avm_batch_inputs_paths,
+                     "Inputs of the txs to prove. The proof of the i-th one is written to <output_path>/i.")
+        ->required();
+    size_t avm_max_pending_traces = 1;
+    avm2_prove_batch_command->add_option("--max-pending-traces",
+                                         avm_max_pending_traces,
+                                         "Number of txs simulated and traced ahead of the one being proven.");
+    add_avm_precomputed_snapshot_option(avm2_prove_batch_command);
 
     /***************************************************************************************************************
      * Subcommand: avm2_check_circuit
@@ -514,6 +577,7 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_debug_flag(avm2_check_circuit_command);
     add_crs_path_option(avm2_check_circuit_command);
     add_avm_inputs_option(avm2_check_circuit_command);
+    add_avm_precomputed_snapshot_option(avm2_check_circuit_command);
 
     /***************************************************************************************************************
      * Subcommand: avm2_verify
@@ -640,8 +704,12 @@ int parse_and_run_cli_command(int argc, char* argv[])
     };
 
     try {
+        // SERVER
+        if (serve_command->parsed()) {
+            serve(serve_options);
+        }
         // TUBE
-        if (prove_tube_command->parsed()) {
+        else if (prove_tube_command->parsed()) {
             // TODO(https://github.com/AztecProtocol/barretenberg/issues/1201): Potentially remove this extra logic.
             prove_tube(prove_tube_output_path, vk_path);
         } else if (verify_tube_command->parsed()) {
@@ -657,9 +725,14 @@ int parse_and_run_cli_command(int argc, char* argv[])
 #ifndef DISABLE_AZTEC_VM
         else if (avm2_prove_command->parsed()) {
             // This outputs both files: proof and vk, under the given directory.
-            avm2_prove(avm_inputs_path, avm2_prove_output_path);
+            avm2_prove(avm_inputs_path, avm2_prove_output_path, avm_precomputed_snapshot_path);
+        } else if (avm2_prove_batch_command->parsed()) {
+            avm2_prove_batch(avm_batch_inputs_paths,
+                             avm2_prove_batch_output_path,
+                             avm_precomputed_snapshot_path,
+                             avm_max_pending_traces);
         } else if (avm2_check_circuit_command->parsed()) {
-            avm2_check_circuit(avm_inputs_path);
+            avm2_check_circuit(avm_inputs_path, avm_precomputed_snapshot_path);
         } else if (avm2_verify_command->parsed()) {
             return avm2_verify(proof_path, avm_public_inputs_path, vk_path) ? 0 : 1;
         } else if (avm_check_circuit_command->parsed()) {
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/dsl/acir_format/acir_format.hpp"
+#include "barretenberg/dsl/acir_format/acir_format_mocks.hpp"
+
+using namespace benchmark;
+using namespace bb;
+using namespace acir_format;
+
+namespace {
+
+/**
+ * @brief An ACIR program of the shape of hash-heavy Noir programs: for each of num_rounds, a sha256 compression, a
+ * keccak permutation and a poseidon2 permutation, and an ECDSA secp256k1 verification every 4 rounds
+ * @details It has no witness, as when computing a verification key.
+ */
+AcirFormat construct_hash_heavy_program(size_t num_rounds)
+{
+    AcirFormat constraint_system{};
+    uint32_t next_witness = 0;
+    const auto witness = [&]() { return WitnessOrConstant<fr>::from_index(next_witness++); };
+    for (size_t round = 0; round < num_rounds; ++round) {
+        Sha256Compression sha256_compression;
+        for (auto& input : sha256_compression.inputs) {
+            input = witness();
+        }
+        for (auto& hash_value : sha256_compression.hash_values) {
+            hash_value = witness();
+        }
+        for (auto& result : sha256_compression.result) {
+            result = next_witness++;
+        }
+        constraint_system.sha256_compression.emplace_back(sha256_compression);
+
+        Keccakf1600 keccak_permutation;
+        for (auto& input : keccak_permutation.state) {
+            input = witness();
+        }
+        for (auto& result : keccak_permutation.result) {
+            result = next_witness++;
+        }
+        constraint_system.keccak_permutations.emplace_back(keccak_permutation);
+
+        Poseidon2Constraint poseidon2_constraint{ .state = {}, .result = {}, .len = 4 };
+        for (size_t i = 0; i < 4; ++i) {
+            poseidon2_constraint.state.emplace_back(witness());
+            poseidon2_constraint.result.emplace_back(next_witness++);
+        }
+        constraint_system.poseidon2_constraints.emplace_back(poseidon2_constraint);
+
+        if (round % 4 == 0) {
+            EcdsaSecp256k1Constraint ecdsa_constraint;
+            for (auto* indices : { &ecdsa_constraint.hashed_message,
+                                   &ecdsa_constraint.pub_x_indices,
+                                   &ecdsa_constraint.pub_y_indices }) {
+                for (auto& index : *indices) {
+                    index = next_witness++;
+                }
+            }
+            for (auto& index : ecdsa_constraint.signature) {
+                index = next_witness++;
+            }
+            ecdsa_constraint.result = next_witness++;
+            constraint_system.ecdsa_k1_constraints.emplace_back(ecdsa_constraint);
+        }
+    }
+    constraint_system.varnum = next_witness;
+    constraint_system.num_acir_opcodes = static_cast<uint32_t>(
+        constraint_system.sha256_compression.size() + constraint_system.keccak_permutations.size() +
+        constraint_system.poseidon2_constraints.size() + constraint_system.ecdsa_k1_constraints.size());
+    constraint_system.original_opcode_indices = create_empty_original_opcode_indices();
+    mock_opcode_indices(constraint_system);
+    return constraint_system;
+}
+
+/**
+ * @brief Benchmark: Construction of the Ultra circuit of a hash-heavy ACIR program with 2**n rounds, with its
+ * constraints added directly or built in shards
+ */
+void construct_circuit(State& state, bool shard_constraints) noexcept
+{
+    const auto constraint_system = construct_hash_heavy_program(size_t(1) << state.range(0));
+    for (auto _ : state) {
+        AcirProgram program{ constraint_system, /*witness=*/{} };
+        auto builder = create_circuit(program, ProgramMetadata{ .shard_constraints = shard_constraints });
+        state.counters["gates"] = static_cast<double>(builder.get_estimated_num_finalized_gates());
+        DoNotOptimize(builder);
+    }
+}
+
+void construct_circuit_sequential(State& state) noexcept
+{
+    construct_circuit(state, /*shard_constraints=*/false);
+}
+
+void construct_circuit_sharded(State& state) noexcept
+{
+    construct_circuit(state, /*shard_constraints=*/true);
+}
+
+} // namespace
+
+BENCHMARK(construct_circuit_sequential)->DenseRange(4, 7)->Unit(kMillisecond);
+BENCHMARK(construct_circuit_sharded)->DenseRange(4, 7)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "barretenberg/honk/composer/permutation_lib.hpp"
 #include "barretenberg/stdlib/primitives/biggroup/biggroup.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
@@ -40,7 +41,37 @@ void biggroup_construction_bench(State& state)
         state.PauseTiming();
     }
 }
+
+/**
+ * @brief Construction of the copy cycles of a circuit of about 2^n gates, whose variables are mostly used several
+ * times
+ */
+void copy_cycles_construction_bench(State& state)
+{
+    UltraCircuitBuilder builder;
+    stdlib::field_t a(stdlib::witness_t(&builder, fr::random_element()));
+    stdlib::field_t b(stdlib::witness_t(&builder, fr::random_element()));
+    stdlib::field_t c(&builder);
+    const size_t num_iterations = (size_t(1) << state.range(0)) / 4;
+    for (size_t i = 0; i < num_iterations; ++i) {
+        c = a + b;
+        c = a * c;
+        a = b * b;
+        b = c * c;
+    }
+    builder.finalize_circuit(/*ensure_nonzero=*/true);
+    builder.blocks.compute_offsets(/*is_structured=*/false);
+    std::vector<uint32_t> block_offsets;
+    for (auto& block : builder.blocks.get()) {
+        block_offsets.push_back(block.trace_offset);
+    }
+
+    for (auto _ : state) {
+        DoNotOptimize(construct_copy_cycles(builder, block_offsets));
+    }
+}
 } // namespace
 BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK(copy_cycles_construction_bench)->Unit(kMillisecond)->DenseRange(16, 20, 2);
 
 BENCHMARK_MAIN();
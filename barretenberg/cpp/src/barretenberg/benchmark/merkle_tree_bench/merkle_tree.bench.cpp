@@ -1,8 +1,16 @@
 #include "barretenberg/crypto/merkle_tree/merkle_tree.hpp"
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/crypto/merkle_tree/append_only_tree/content_addressed_append_only_tree.hpp"
 #include "barretenberg/crypto/merkle_tree/hash.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_node_cache.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/memory_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/cached_content_addressed_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include <benchmark/benchmark.h>
+#include <filesystem>
+#include <unistd.h>
 
 using namespace benchmark;
 using namespace bb;
@@ -74,4 +82,71 @@ void update_random_elements(State& state) noexcept
 }
 BENCHMARK(update_random_elements)->Unit(benchmark::kMillisecond)->Range(100, 100)->Iterations(1);
 
+using LMDBStoreType = ContentAddressedCachedTreeStore<bb::fr>;
+using LMDBTreeType = ContentAddressedAppendOnlyTree<LMDBStoreType, Poseidon2HashPolicy>;
+
+/**
+ * @brief Benchmark: Sibling paths of random leaves of a committed LMDB backed tree of depth 40 with 2**14 leaves,
+ * read 64 at a time by (arg 0) threads, with or without the store's node cache
+ */
+void lmdb_sibling_paths(State& state, bool cached) noexcept
+{
+    constexpr uint32_t LMDB_DEPTH = 40;
+    constexpr size_t NUM_LEAVES = 1 << 14;
+    constexpr uint32_t NUM_REQUESTS = 64;
+    const auto num_threads = static_cast<uint32_t>(state.range(0));
+
+    const auto directory =
+        std::filesystem::temp_directory_path() / ("bb-merkle-tree-bench-" + std::to_string(getpid()));
+    const std::string name = "tree";
+    std::filesystem::create_directories(directory);
+    LMDBNodeCacheOptions cache_options;
+    if (!cached) {
+        cache_options.maxUpperNodes = 0;
+        cache_options.maxLowerNodes = 0;
+    }
+    auto db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads, cache_options);
+    auto workers = std::make_shared<ThreadPool>(num_threads);
+    LMDBTreeType tree(std::make_unique<LMDBStoreType>(name, LMDB_DEPTH, db), workers);
+    {
+        std::vector<fr> leaves(NUM_LEAVES);
+        for (auto& leaf : leaves) {
+            leaf = fr(engine.get_random_uint256());
+        }
+        Signal signal;
+        tree.add_values(leaves, [&](const TypedResponse<AddDataResponse>&) { signal.signal_level(0); });
+        signal.wait_for_level(0);
+        signal.signal_level(1);
+        tree.commit([&](const TypedResponse<CommitResponse>&) { signal.signal_level(0); });
+        signal.wait_for_level(0);
+    }
+
+    for (auto _ : state) {
+        Signal signal(NUM_REQUESTS);
+        for (uint32_t i = 0; i < NUM_REQUESTS; ++i) {
+            const index_t index = engine.get_random_uint64() % NUM_LEAVES;
+            tree.get_sibling_path(
+                index, [&](const TypedResponse<GetSiblingPathResponse>&) { signal.signal_decrement(); }, false);
+        }
+        signal.wait_for_level(0);
+    }
+    state.counters["paths/s"] = Counter(NUM_REQUESTS, Counter::kIsIterationInvariantRate);
+    const auto stats = db->get_node_cache_stats();
+    state.counters["hit_rate"] = static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses + 1);
+
+    std::filesystem::remove_all(directory);
+}
+
+void lmdb_sibling_paths_uncached(State& state) noexcept
+{
+    lmdb_sibling_paths(state, /*cached=*/false);
+}
+
+void lmdb_sibling_paths_cached(State& state) noexcept
+{
+    lmdb_sibling_paths(state, /*cached=*/true);
+}
+BENCHMARK(lmdb_sibling_paths_uncached)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(1, 16);
+BENCHMARK(lmdb_sibling_paths_cached)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(1, 16);
+
 BENCHMARK_MAIN();
@@ -1,5 +1,6 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
@@ -79,6 +80,29 @@ int pippenger()
     return 0;
 }
 
+// The same MSM over the fixed SRS bases, with `precompute_factor` precomputed multiples per base
+int fixed_base_pippenger(const size_t precompute_factor)
+{
+    std::chrono::steady_clock::time_point precompute_start = std::chrono::steady_clock::now();
+    scalar_multiplication::FixedBaseMSM<curve::BN254> msm(
+        srs::get_bn254_crs_factory()->get_crs(NUM_POINTS)->get_monomial_points().subspan(0, NUM_POINTS * 2),
+        precompute_factor,
+        /*window_bits=*/0,
+        /*base_stride=*/2);
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    g1::element result =
+        msm.msm(PolynomialSpan<const curve::BN254::ScalarField>{ /*start_index*/ 0, { &scalars[0], NUM_POINTS } });
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+    std::chrono::microseconds precompute_diff =
+        std::chrono::duration_cast<std::chrono::microseconds>(time_start - precompute_start);
+    std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+    std::cout << "precompute factor " << msm.precompute_factor() << ", window " << msm.window_bits() << ", "
+              << msm.num_rounds() << " rounds, precompute time: " << precompute_diff.count()
+              << "us, run time: " << diff.count() << "us" << std::endl;
+    std::cout << result.normalize().x << std::endl;
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -114,5 +138,9 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "executing fixed-base pippenger algorithm" << std::endl;
+    for (size_t precompute_factor : { 1, 2, 4, 8, 32 }) {
+        fixed_base_pippenger(precompute_factor);
+    }
     return 0;
 }
@@ -41,4 +41,80 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+using Permutation = bb::crypto::Poseidon2Permutation<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+
+/**
+ * @brief Benchmark: Permutation of 2**n states, one at a time or batched
+ */
+void poseidon2_permutation_bench(State& state, bool batched) noexcept
+{
+    std::vector<Permutation::State> states(size_t(1) << state.range(0));
+    for (auto& permutation_state : states) {
+        for (auto& element : permutation_state) {
+            element = fr::random_element();
+        }
+    }
+    for (auto _ : state) {
+        if (batched) {
+            Permutation::permutation_batch(states);
+        } else {
+            for (auto& permutation_state : states) {
+                permutation_state = Permutation::permutation(permutation_state);
+            }
+        }
+        DoNotOptimize(states.data());
+    }
+    state.counters["permutations/s"] =
+        Counter(static_cast<double>(states.size()), Counter::kIsIterationInvariantRate);
+}
+
+void poseidon2_permutation_single_bench(State& state) noexcept
+{
+    poseidon2_permutation_bench(state, /*batched=*/false);
+}
+
+void poseidon2_permutation_batch_bench(State& state) noexcept
+{
+    poseidon2_permutation_bench(state, /*batched=*/true);
+}
+BENCHMARK(poseidon2_permutation_single_bench)->DenseRange(10, 14, 4)->Unit(kMicrosecond);
+BENCHMARK(poseidon2_permutation_batch_bench)->DenseRange(10, 14, 4)->Unit(kMicrosecond);
+
+/**
+ * @brief Benchmark: Hashing of a level of 2**n pairs of a Merkle tree, pair by pair or with hash_pairs (single core)
+ */
+void poseidon2_hash_pairs_bench(State& state, bool batched) noexcept
+{
+    const size_t num_pairs = size_t(1) << state.range(0);
+    std::vector<fr> inputs(num_pairs * 2);
+    for (auto& input : inputs) {
+        input = fr::random_element();
+    }
+    std::vector<fr> outputs(num_pairs);
+    for (auto _ : state) {
+        if (batched) {
+            Poseidon2::hash_pairs(inputs, outputs);
+        } else {
+            for (size_t i = 0; i < num_pairs; ++i) {
+                outputs[i] = Poseidon2::hash({ inputs[2 * i], inputs[2 * i + 1] });
+            }
+        }
+        DoNotOptimize(outputs.data());
+    }
+    state.counters["hashes/s"] = Counter(static_cast<double>(num_pairs), Counter::kIsIterationInvariantRate);
+}
+
+void poseidon2_hash_pair_loop_bench(State& state) noexcept
+{
+    poseidon2_hash_pairs_bench(state, /*batched=*/false);
+}
+
+void poseidon2_hash_pairs_batch_bench(State& state) noexcept
+{
+    poseidon2_hash_pairs_bench(state, /*batched=*/true);
+}
+BENCHMARK(poseidon2_hash_pair_loop_bench)->DenseRange(10, 14, 4)->Unit(kMicrosecond);
+BENCHMARK(poseidon2_hash_pairs_batch_bench)->DenseRange(10, 14, 4)->Unit(kMicrosecond);
+
 BENCHMARK_MAIN();
\ No newline at end of file
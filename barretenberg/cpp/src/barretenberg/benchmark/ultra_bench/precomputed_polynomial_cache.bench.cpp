@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <unistd.h>
+
+#include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include "barretenberg/ultra_honk/precomputed_polynomial_cache.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+/**
+ * @brief Benchmark: Construction of an Ultra Honk proving key with 2**n gates, with the precomputed polynomials either
+ * computed (cold) or loaded from a PrecomputedPolynomialCache (warm)
+ */
+void construct_proving_key(State& state, bool warm) noexcept
+{
+    const auto log2_of_gates = static_cast<size_t>(state.range(0));
+    const auto directory =
+        std::filesystem::temp_directory_path() / ("bb-precomputed-cache-bench-" + std::to_string(getpid()));
+    auto cache = std::make_shared<PrecomputedPolynomialCache>(directory);
+    set_precomputed_polynomial_cache(cache);
+
+    UltraCircuitBuilder circuit;
+    mock_circuits::generate_basic_arithmetic_circuit(circuit, log2_of_gates);
+    circuit.finalize_circuit(/* ensure_nonzero = */ true);
+    if (warm) {
+        UltraCircuitBuilder builder = circuit;
+        DeciderProvingKey_<UltraFlavor> proving_key(builder);
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (!warm) {
+            std::filesystem::remove_all(directory);
+            std::filesystem::create_directories(directory);
+        }
+        UltraCircuitBuilder builder = circuit;
+        state.ResumeTiming();
+
+        DeciderProvingKey_<UltraFlavor> proving_key(builder);
+        DoNotOptimize(proving_key);
+    }
+
+    const auto stats = cache->get_stats();
+    state.counters["hits"] = static_cast<double>(stats.hits);
+    state.counters["misses"] = static_cast<double>(stats.misses);
+    set_precomputed_polynomial_cache(nullptr);
+    std::filesystem::remove_all(directory);
+}
+
+void construct_proving_key_cold(State& state) noexcept
+{
+    construct_proving_key(state, /*warm=*/false);
+}
+
+void construct_proving_key_warm(State& state) noexcept
+{
+    construct_proving_key(state, /*warm=*/true);
+}
+
+} // namespace
+
+BENCHMARK(construct_proving_key_cold)->DenseRange(15, 20, 5)->Unit(kMillisecond);
+BENCHMARK(construct_proving_key_warm)->DenseRange(15, 20, 5)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -73,12 +73,38 @@ BB_PROFILE static void test_round(State& state, size_t index) noexcept
         // NOTE: google bench is very finnicky, must end in ResumeTiming() for correctness
     }
 }
+/**
+ * @details Same as test_round, but the circuit is laid out in a structured trace of 2^20 rows (EXAMPLE_20) of which only
+ * the arithmetic block is in use, as for the small circuits of a client IVC. Sumcheck only visits the active rows.
+ **/
+BB_PROFILE static void test_round_structured(State& state, size_t index) noexcept
+{
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+    bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
+
+    MegaCircuitBuilder builder;
+    bb::mock_circuits::generate_basic_arithmetic_circuit(builder, log2_num_gates);
+    auto proving_key = std::make_shared<DeciderProvingKey_<MegaFlavor>>(builder, TraceSettings{ EXAMPLE_20 });
+    MegaProver prover(proving_key);
+    for (auto _ : state) {
+        state.PauseTiming();
+        test_round_inner(state, prover, index);
+        state.ResumeTiming();
+        // NOTE: google bench is very finnicky, must end in ResumeTiming() for correctness
+    }
+}
 #define ROUND_BENCHMARK(round)                                                                                         \
     static void ROUND_##round(State& state) noexcept                                                                   \
     {                                                                                                                  \
         test_round(state, round);                                                                                      \
     }                                                                                                                  \
     BENCHMARK(ROUND_##round)->DenseRange(12, 19)->Unit(kMillisecond)
+#define STRUCTURED_ROUND_BENCHMARK(round)                                                                              \
+    static void STRUCTURED_ROUND_##round(State& state) noexcept                                                        \
+    {                                                                                                                  \
+        test_round_structured(state, round);                                                                           \
+    }                                                                                                                  \
+    BENCHMARK(STRUCTURED_ROUND_##round)->DenseRange(12, 18)->Unit(kMillisecond)
 
 // Fast rounds take a long time to benchmark because of how we compute statistical significance.
 // Limit to one iteration so we don't spend a lot of time redoing full proofs just to measure this part.
@@ -89,5 +115,6 @@ ROUND_BENCHMARK(LOG_DERIVATIVE_INVERSE)->Iterations(1);
 ROUND_BENCHMARK(GRAND_PRODUCT_COMPUTATION)->Iterations(1);
 ROUND_BENCHMARK(GENERATE_ALPHAS)->Iterations(1);
 ROUND_BENCHMARK(RELATION_CHECK);
+STRUCTURED_ROUND_BENCHMARK(RELATION_CHECK);
 
 BENCHMARK_MAIN();
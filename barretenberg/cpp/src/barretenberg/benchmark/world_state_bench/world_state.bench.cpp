@@ -0,0 +1,113 @@
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/world_state/types.hpp"
+#include "barretenberg/world_state/world_state.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::world_state;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+
+const size_t NUM_BLOCKS = 64;
+const size_t NUM_NOTE_HASHES = 64;
+const size_t NUM_NULLIFIERS = 64;
+const size_t NUM_PUBLIC_DATA_WRITES = 16;
+const uint64_t MAP_SIZE = 1024 * 1024;
+const uint64_t NUM_THREADS = 16;
+
+const std::unordered_map<MerkleTreeId, uint32_t> TREE_HEIGHTS{
+    { MerkleTreeId::NULLIFIER_TREE, 40 },   { MerkleTreeId::NOTE_HASH_TREE, 40 },
+    { MerkleTreeId::PUBLIC_DATA_TREE, 40 }, { MerkleTreeId::L1_TO_L2_MESSAGE_TREE, 39 },
+    { MerkleTreeId::ARCHIVE, 29 },
+};
+const std::unordered_map<MerkleTreeId, index_t> TREE_PREFILL{
+    { MerkleTreeId::NULLIFIER_TREE, 128 },
+    { MerkleTreeId::PUBLIC_DATA_TREE, 128 },
+};
+const uint32_t INITIAL_HEADER_GENERATOR_POINT = 28;
+
+// Builds the blocks of a chain, each one computed on a fork of the world state that synced the previous ones
+std::vector<SyncBlockData> build_blocks()
+{
+    std::string directory = random_temp_directory();
+    std::filesystem::create_directories(directory);
+    std::vector<SyncBlockData> blocks;
+    {
+        WorldState ws(NUM_THREADS, directory, MAP_SIZE, TREE_HEIGHTS, TREE_PREFILL, INITIAL_HEADER_GENERATOR_POINT);
+        uint64_t value = 1000;
+        for (size_t i = 0; i < NUM_BLOCKS; i++) {
+            SyncBlockData block;
+            block.blockHeaderHash = fr(value++);
+            for (size_t j = 0; j < NUM_NOTE_HASHES; j++) {
+                block.noteHashes.emplace_back(value++);
+            }
+            block.l1ToL2Messages.emplace_back(value++);
+            for (size_t j = 0; j < NUM_NULLIFIERS; j++) {
+                block.nullifiers.emplace_back(value++);
+            }
+            for (size_t j = 0; j < NUM_PUBLIC_DATA_WRITES; j++) {
+                block.publicDataWrites.emplace_back(value++, 1);
+            }
+
+            auto fork_id = ws.create_fork(std::nullopt);
+            ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, block.noteHashes, fork_id);
+            ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, block.l1ToL2Messages, fork_id);
+            ws.batch_insert_indexed_leaves<NullifierLeafValue>(
+                MerkleTreeId::NULLIFIER_TREE, block.nullifiers, 0, fork_id);
+            ws.insert_indexed_leaves<PublicDataLeafValue>(
+                MerkleTreeId::PUBLIC_DATA_TREE, block.publicDataWrites, fork_id);
+            block.blockStateRef =
+                ws.get_state_reference(WorldStateRevision{ .forkId = fork_id, .includeUncommitted = true });
+            ws.delete_fork(fork_id);
+
+            ws.sync_blocks({ block });
+            blocks.push_back(block);
+        }
+    }
+    std::filesystem::remove_all(directory);
+    return blocks;
+}
+
+/**
+ * @brief Sync of a chain of NUM_BLOCKS blocks to an empty world state, in groups of 2**n blocks, each group being
+ * flushed to disk once
+ */
+void sync_blocks_bench(State& state) noexcept
+{
+    static const std::vector<SyncBlockData> blocks = build_blocks();
+    const size_t group_size = size_t(1) << state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::string directory = random_temp_directory();
+        std::filesystem::create_directories(directory);
+        {
+            WorldState ws(
+                NUM_THREADS, directory, MAP_SIZE, TREE_HEIGHTS, TREE_PREFILL, INITIAL_HEADER_GENERATOR_POINT);
+            state.ResumeTiming();
+            for (auto group_start = blocks.begin(); group_start != blocks.end();) {
+                auto group_end = group_start + std::min<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(group_size),
+                                                                        blocks.end() - group_start);
+                ws.sync_blocks({ group_start, group_end });
+                group_start = group_end;
+            }
+            state.PauseTiming();
+        }
+        std::filesystem::remove_all(directory);
+        state.ResumeTiming();
+    }
+    state.counters["blocks"] =
+        Counter(static_cast<double>(blocks.size()) * static_cast<double>(state.iterations()), Counter::kIsRate);
+}
+
+} // namespace
+
+BENCHMARK(sync_blocks_bench)->DenseRange(0, 6, 2)->Unit(kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
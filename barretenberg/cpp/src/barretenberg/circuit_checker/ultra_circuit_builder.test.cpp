@@ -907,4 +907,91 @@ TEST(UltraCircuitBuilder, CheckCircuitShowcase)
     EXPECT_EQ(CircuitChecker::check(builder), true);
 }
 
+namespace {
+/**
+ * @brief Add a few gates of each kind using the shared witnesses, with constants and range lists that are both shared
+ * between calls and specific to each
+ */
+void add_shardable_gates(UltraCircuitBuilder& builder, const std::array<uint32_t, 2>& shared, size_t i)
+{
+    const uint64_t left_value = engine.get_random_uint32();
+    const uint64_t right_value = engine.get_random_uint32();
+    const uint32_t left = builder.add_variable(left_value);
+    const uint32_t right = builder.add_variable(right_value);
+    const auto accumulators = plookup::get_lookup_accumulators(
+        plookup::MultiTableId::UINT32_XOR, left_value, right_value, /*is_2_to_1_lookup=*/true);
+    const auto lookup_witnesses =
+        builder.create_gates_from_plookup_accumulators(plookup::MultiTableId::UINT32_XOR, accumulators, left, right);
+
+    // The sum of the shared witnesses, and its copy
+    const fr sum_value = builder.get_variable(shared[0]) + builder.get_variable(shared[1]);
+    const uint32_t sum = builder.add_variable(sum_value);
+    builder.create_add_gate({ shared[0], shared[1], sum, 1, 1, -1, 0 });
+    const uint32_t sum_copy = builder.add_variable(sum_value);
+    builder.assert_equal(sum, sum_copy);
+    builder.create_new_range_constraint(sum_copy, (1 << 14) - 1);
+    builder.create_new_range_constraint(lookup_witnesses[plookup::ColumnIdx::C3].back(), 1000 + (i % 3));
+
+    const fr constant_value = fr(i % 5) + 7;
+    const uint32_t constant = builder.put_constant_variable(constant_value);
+    builder.create_add_gate({ constant, sum, builder.zero_idx, 1, -1, 0, sum_value - constant_value });
+
+    const size_t rom_id = builder.create_ROM_array(2);
+    builder.set_ROM_element(rom_id, 0, sum);
+    builder.set_ROM_element(rom_id, 1, constant);
+    const uint32_t read = builder.read_ROM_array(rom_id, builder.add_variable(1));
+    builder.assert_equal(read, constant);
+}
+} // namespace
+
+/**
+ * @brief Gates built in shards and merged give a valid circuit with the same number of gates as when built directly
+ */
+TEST(UltraCircuitBuilder, MergeShards)
+{
+    constexpr size_t num_calls = 12;
+    constexpr size_t num_shards = 4;
+    const auto build = [&](bool sharded) {
+        numeric::get_debug_randomness(/*reset=*/true);
+        UltraCircuitBuilder builder;
+        const std::array<uint32_t, 2> shared{ builder.add_variable(100), builder.add_variable(200) };
+        builder.create_new_range_constraint(shared[0], 1000);
+        if (!sharded) {
+            for (size_t i = 0; i < num_calls; ++i) {
+                add_shardable_gates(builder, shared, i);
+            }
+            return builder;
+        }
+        std::vector<UltraCircuitBuilder::Shard> shards(num_shards, builder.create_shard());
+        for (size_t i = 0; i < num_calls; ++i) {
+            add_shardable_gates(shards[i * num_shards / num_calls].builder, shared, i);
+        }
+        for (const auto& shard : shards) {
+            builder.merge_shard(shard);
+        }
+        return builder;
+    };
+
+    auto builder = build(/*sharded=*/false);
+    auto sharded_builder = build(/*sharded=*/true);
+    EXPECT_EQ(sharded_builder.get_estimated_num_finalized_gates(), builder.get_estimated_num_finalized_gates());
+    EXPECT_EQ(sharded_builder.get_num_variables(), builder.get_num_variables());
+    EXPECT_EQ(sharded_builder.lookup_tables.size(), builder.lookup_tables.size());
+    EXPECT_TRUE(CircuitChecker::check(sharded_builder));
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
+
+// A failing constraint of a shard makes the merged circuit fail
+TEST(UltraCircuitBuilder, MergeFailingShard)
+{
+    UltraCircuitBuilder builder;
+    const uint32_t a = builder.add_variable(100);
+    auto shard = builder.create_shard();
+    shard.builder.create_new_range_constraint(a, 99);
+    EXPECT_TRUE(shard.builder.failed());
+
+    builder.merge_shard(shard);
+    EXPECT_TRUE(builder.failed());
+    EXPECT_FALSE(CircuitChecker::check(builder));
+}
 } // namespace bb
@@ -252,6 +252,45 @@ template <typename Curve> void bench_commit_mock_z_perm_preprocessed(::benchmark
     }
 }
 
+constexpr size_t BATCH_COMMIT_NUM_POLYS = 8;
+
+// Commit to several dense random polynomials one after the other
+template <typename Curve> void bench_sequential_commits(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t i = 0; i < BATCH_COMMIT_NUM_POLYS; i++) {
+        polynomials.emplace_back(Polynomial<Fr>::random(num_points));
+    }
+    for (auto _ : state) {
+        for (const auto& polynomial : polynomials) {
+            key->commit(polynomial);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(BATCH_COMMIT_NUM_POLYS));
+}
+
+// Commit to the same polynomials with concurrent MSMs using batch_commit
+template <typename Curve> void bench_batch_commit(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t i = 0; i < BATCH_COMMIT_NUM_POLYS; i++) {
+        polynomials.emplace_back(Polynomial<Fr>::random(num_points));
+    }
+    std::vector<PolynomialSpan<const Fr>> spans(polynomials.begin(), polynomials.end());
+    for (auto _ : state) {
+        key->batch_commit(spans);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(BATCH_COMMIT_NUM_POLYS));
+}
+
 BENCHMARK(bench_commit_zero<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
@@ -277,6 +316,12 @@ BENCHMARK(bench_commit_structured_random_poly<curve::BN254>)->Unit(benchmark::kM
 BENCHMARK(bench_commit_structured_random_poly_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_sequential_commits<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_batch_commit<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
 
 } // namespace bb
 
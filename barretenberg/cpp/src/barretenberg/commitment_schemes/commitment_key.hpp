@@ -14,7 +14,9 @@
  */
 
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/task_group.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
@@ -23,9 +25,12 @@
 #include "barretenberg/srs/factories/crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -44,6 +49,9 @@ template <class Curve> class CommitmentKey {
     using G1 = typename Curve::AffineElement;
     static constexpr size_t EXTRA_SRS_POINTS_FOR_ECCVM_IPA = 1;
 
+    // Upper bound on the memory batch_commit spends on additional pippenger runtime states by default.
+    static constexpr size_t BATCH_COMMIT_MEMORY_BUDGET = size_t(1) << 30;
+
     static size_t get_num_needed_srs_points(size_t num_points)
     {
         // NOTE 1: Currently we must round up internal space for points as our pippenger algorithm (specifically,
@@ -54,10 +62,96 @@ template <class Curve> class CommitmentKey {
         return numeric::round_up_power_2(num_points) + EXTRA_SRS_POINTS_FOR_ECCVM_IPA;
     }
 
+    /**
+     * @brief The window of SRS points a commitment to a polynomial is computed over
+     * @details Because pippenger prefers a power-of-2 size, we must choose a starting index for the points so that we
+     * don't exceed the dyadic_circuit_size. The actual start index of the points will be the smallest it can be so
+     * that the window of points is a power of 2 and still contains the scalars. The best we can do is pick a start
+     * index that ends at the end of the polynomial, which would be polynomial.end_index() - dyadic_poly_size. However,
+     * our polynomial might defined too close to 0, so we set the start_index to 0 in that case.
+     */
+    struct MsmWindow {
+        // Index of the first SRS point of the window
+        size_t actual_start_index;
+        // Offset of the scalars from the start of the window
+        size_t relative_start_index;
+        // Number of points in the window, a power of 2
+        size_t size;
+        // Number of SRS points the window requires
+        size_t consumed_srs;
+    };
+
+    MsmWindow get_msm_window(PolynomialSpan<const Fr> polynomial) const
+    {
+        // We must have a power-of-2 SRS points *after* subtracting by start_index.
+        size_t dyadic_poly_size = numeric::round_up_power_2(polynomial.size());
+        BB_ASSERT_LTE(dyadic_poly_size, dyadic_size, "Polynomial size exceeds commitment key size.");
+        size_t actual_start_index =
+            polynomial.end_index() > dyadic_poly_size ? polynomial.end_index() - dyadic_poly_size : 0;
+        // The relative start index is the offset of the scalars from the start of the points window, i.e.
+        // [actual_start_index, actual_start_index + dyadic_poly_size), so we subtract actual_start_index from the start
+        // index.
+        size_t relative_start_index = polynomial.start_index - actual_start_index;
+        return { actual_start_index, relative_start_index, dyadic_poly_size, actual_start_index + dyadic_poly_size };
+    }
+
+    /**
+     * @brief Runs the commitment MSM of a polynomial over its window of the point table using the given runtime state
+     */
+    static Commitment commit_in_window(PolynomialSpan<const Fr> polynomial,
+                                       const MsmWindow& window,
+                                       std::span<G1> monomial_points,
+                                       scalar_multiplication::pippenger_runtime_state<Curve>& state)
+    {
+        if (window.consumed_srs * 2 > monomial_points.size()) {
+            throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                  window.consumed_srs,
+                                  " points with an SRS of size ",
+                                  monomial_points.size() / 2));
+        }
+        // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
+        // endomorphism point (\beta*x, -y) at odd indices). We offset by the window start to align with our polynomial
+        // span.
+        std::span<G1> point_table = monomial_points.subspan(window.actual_start_index * 2);
+        return scalar_multiplication::pippenger_unsafe_optimized_for_non_dyadic_polys<Curve>(
+            { window.relative_start_index, polynomial.span }, point_table, state);
+    }
+
+    // Approximate size of a pippenger runtime state for MSMs over `num_initial_points` points, see runtime_states.cpp
+    static size_t get_runtime_state_bytes(size_t num_initial_points)
+    {
+        const size_t num_points = num_initial_points * 2;
+        // The point schedule holds one entry per point per round; the two point pair buffers and the scratch space
+        // hold 2 * num_points, 2 * num_points and num_points elements respectively.
+        return num_points * (scalar_multiplication::get_num_rounds(num_points) * sizeof(uint64_t) + 5 * sizeof(G1));
+    }
+
+    // Runtime states of the concurrent MSMs of batch_commit() other than the calling thread's. They are allocated on
+    // first use and reused by later calls. Like pippenger_runtime_state, they are shared between copies of the key.
+    std::vector<std::shared_ptr<scalar_multiplication::pippenger_runtime_state<Curve>>> batch_commit_states;
+
+    // Makes sure there are `num_states` batch_commit_states for MSMs over `num_initial_points` points.
+    void reserve_batch_commit_states(size_t num_states, size_t num_initial_points)
+    {
+        if (batch_commit_states.size() < num_states) {
+            batch_commit_states.resize(num_states);
+        }
+        for (size_t i = 0; i < num_states; ++i) {
+            auto& state = batch_commit_states[i];
+            if (state == nullptr || state->num_points < num_initial_points * 2) {
+                // Free the state that is too small before allocating the new one, which matters for peak memory.
+                state = nullptr;
+                state = std::make_shared<scalar_multiplication::pippenger_runtime_state<Curve>>(num_initial_points);
+            }
+        }
+    }
+
   public:
     scalar_multiplication::PippengerReference<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::Crs<Curve>> srs;
     size_t dyadic_size;
+    // Set by enable_fixed_base_msm(); shared, read-only, between copies of the key
+    std::shared_ptr<const scalar_multiplication::FixedBaseMSM<Curve>> fixed_base_msm;
 
     CommitmentKey() = delete;
 
@@ -74,6 +168,30 @@ template <class Curve> class CommitmentKey {
         , dyadic_size(get_num_needed_srs_points(num_points))
     {}
 
+    /**
+     * @brief Opts into fixed-base MSMs: precomputes multiples of the SRS points so that commit() needs fewer pippenger
+     * rounds, using as large a table as fits into `memory_budget` bytes.
+     * @details The table costs a multiple of the SRS size in memory (see FixedBaseMSM) and takes a while to build, so
+     * this only pays off for keys that commit to many polynomials.
+     * @return false (and fixed-base MSMs stay disabled) if no useful table fits into the budget
+     */
+    bool enable_fixed_base_msm(size_t memory_budget)
+    {
+        PROFILE_THIS_NAME("enable_fixed_base_msm");
+        // A table holding only the bases themselves would not save a single round over pippenger.
+        const size_t precompute_factor =
+            scalar_multiplication::FixedBaseMSM<Curve>::get_max_precompute_factor(dyadic_size, memory_budget);
+        if (precompute_factor < 2) {
+            return false;
+        }
+        fixed_base_msm = std::make_shared<const scalar_multiplication::FixedBaseMSM<Curve>>(
+            srs->get_monomial_points().subspan(0, dyadic_size * 2),
+            precompute_factor,
+            /*window_bits=*/0,
+            /*base_stride=*/2);
+        return true;
+    }
+
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
@@ -83,39 +201,73 @@ template <class Curve> class CommitmentKey {
     Commitment commit(PolynomialSpan<const Fr> polynomial)
     {
         PROFILE_THIS_NAME("commit");
-        // We must have a power-of-2 SRS points *after* subtracting by start_index.
-        size_t dyadic_poly_size = numeric::round_up_power_2(polynomial.size());
-        BB_ASSERT_LTE(dyadic_poly_size, dyadic_size, "Polynomial size exceeds commitment key size.");
-        // Because pippenger prefers a power-of-2 size, we must choose a starting index for the points so that we don't
-        // exceed the dyadic_circuit_size. The actual start index of the points will be the smallest it can be so that
-        // the window of points is a power of 2 and still contains the scalars. The best we can do is pick a start index
-        // that ends at the end of the polynomial, which would be polynomial.end_index() - dyadic_poly_size. However,
-        // our polynomial might defined too close to 0, so we set the start_index to 0 in that case.
-        size_t actual_start_index =
-            polynomial.end_index() > dyadic_poly_size ? polynomial.end_index() - dyadic_poly_size : 0;
-        // The relative start index is the offset of the scalars from the start of the points window, i.e.
-        // [actual_start_index, actual_start_index + dyadic_poly_size), so we subtract actual_start_index from the start
-        // index.
-        size_t relative_start_index = polynomial.start_index - actual_start_index;
-        const size_t consumed_srs = actual_start_index + dyadic_poly_size;
-        auto srs = srs::get_crs_factory<Curve>()->get_crs(consumed_srs);
-        // We only need the
-        if (consumed_srs > srs->get_monomial_size()) {
-            throw_or_abort(format("Attempting to commit to a polynomial that needs ",
-                                  consumed_srs,
-                                  " points with an SRS of size ",
-                                  srs->get_monomial_size()));
+        if (fixed_base_msm != nullptr && polynomial.end_index() <= fixed_base_msm->num_bases()) {
+            return fixed_base_msm->msm(polynomial);
+        }
+        const MsmWindow window = get_msm_window(polynomial);
+        auto srs = srs::get_crs_factory<Curve>()->get_crs(window.consumed_srs);
+        return commit_in_window(polynomial, window, srs->get_monomial_points(), pippenger_runtime_state.get());
+    };
+
+    /**
+     * @brief Commits to several polynomials, running their MSMs concurrently
+     * @details Committing one polynomial at a time re-streams the same SRS prefix from DRAM for every MSM and pays the
+     * fork-join overhead of every pippenger phase separately. Here up to `max_concurrent_msms` MSMs (each with its own
+     * pippenger runtime state) claim polynomials from a shared counter and run as tasks on the work-stealing
+     * scheduler, so their pippenger phases interleave on one set of threads and concurrently read the shared point
+     * table. By default the concurrency is bounded by the cpu count and BATCH_COMMIT_MEMORY_BUDGET, since every
+     * extra runtime state costs roughly get_runtime_state_bytes() of memory. The extra states are kept by the key for
+     * later calls.
+     *
+     * @param polynomials univariate polynomials p_i(X)
+     * @return Commitments [p_i(x)], in the order of the input
+     */
+    std::vector<Commitment> batch_commit(std::span<const PolynomialSpan<const Fr>> polynomials,
+                                         size_t max_concurrent_msms = 0)
+    {
+        PROFILE_THIS_NAME("batch_commit");
+        std::vector<Commitment> commitments(polynomials.size());
+        if (polynomials.empty()) {
+            return commitments;
         }
 
-        // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
-        // endomorphism point (\beta*x, -y) at odd indices). We offset by polynomial.start_index * 2 to align
-        // with our polynomial span.
+        // Fetch the SRS once, up front: the CRS factory may (re)load points and must not be used concurrently.
+        std::vector<MsmWindow> windows;
+        windows.reserve(polynomials.size());
+        size_t max_consumed_srs = 0;
+        size_t max_window_size = 0;
+        for (const auto& polynomial : polynomials) {
+            windows.emplace_back(get_msm_window(polynomial));
+            max_consumed_srs = std::max(max_consumed_srs, windows.back().consumed_srs);
+            max_window_size = std::max(max_window_size, windows.back().size);
+        }
+        auto srs = srs::get_crs_factory<Curve>()->get_crs(max_consumed_srs);
+        std::span<G1> point_table = srs->get_monomial_points();
 
-        std::span<G1> point_table = srs->get_monomial_points().subspan(actual_start_index * 2);
-        Commitment point = scalar_multiplication::pippenger_unsafe_optimized_for_non_dyadic_polys<Curve>(
-            { relative_start_index, polynomial.span }, point_table, pippenger_runtime_state.get());
-        return point;
-    };
+        if (max_concurrent_msms == 0) {
+            const size_t max_extra_states = BATCH_COMMIT_MEMORY_BUDGET / get_runtime_state_bytes(max_window_size);
+            max_concurrent_msms = std::min(get_num_cpus(), max_extra_states + 1);
+        }
+        const size_t num_concurrent_msms = std::min(max_concurrent_msms, polynomials.size());
+
+        // The calling thread uses the key's own runtime state, every other concurrent MSM one of batch_commit_states.
+        const size_t num_extra_states = num_concurrent_msms - 1;
+        reserve_batch_commit_states(num_extra_states, max_window_size);
+
+        std::atomic<size_t> next_polynomial = 0;
+        auto commit_remaining = [&](scalar_multiplication::pippenger_runtime_state<Curve>& state) {
+            for (size_t i = next_polynomial++; i < polynomials.size(); i = next_polynomial++) {
+                commitments[i] = commit_in_window(polynomials[i], windows[i], point_table, state);
+            }
+        };
+        task_group group;
+        for (size_t i = 0; i < num_extra_states; ++i) {
+            group.run([&commit_remaining, &state = *batch_commit_states[i]]() { commit_remaining(state); });
+        }
+        commit_remaining(pippenger_runtime_state.get());
+        group.wait();
+        return commitments;
+    }
 
     /**
      * @brief Efficiently commit to a sparse polynomial
@@ -178,6 +178,77 @@ TYPED_TEST(CommitmentKeyTest, CommitSRSCheck)
     EXPECT_EQ(commit_result, full_commit_result);
 }
 
+// Check that batch_commit returns the same commitments as committing to each polynomial individually
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 4096;
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+
+    // A mix of full, shifted, small and zero polynomials, so that the MSM windows differ
+    std::vector<Polynomial> polys;
+    polys.emplace_back(Polynomial::random(num_points));
+    polys.emplace_back(Polynomial::random(num_points - 1, num_points, /*start_index=*/1));
+    polys.emplace_back(Polynomial::random(1392, num_points, /*start_index=*/1402));
+    polys.emplace_back(Polynomial::random(17, num_points, /*start_index=*/15));
+    polys.emplace_back(Polynomial(num_points));
+    polys.emplace_back(Polynomial::random(num_points / 2));
+
+    std::vector<PolynomialSpan<const Fr>> spans(polys.begin(), polys.end());
+    // The key keeps the runtime states of the concurrent MSMs. These are sized for a small window, so the calls below
+    // have to grow them.
+    const std::vector<PolynomialSpan<const Fr>> small_spans{ spans[3], spans[3] };
+    const G1 small_commitment = key->commit(polys[3]);
+    EXPECT_EQ(key->batch_commit(small_spans, 2), std::vector<G1>(2, small_commitment));
+
+    // Exercise the default concurrency, a single MSM at a time and more MSMs than polynomials
+    for (size_t max_concurrent_msms : { 0UL, 1UL, 2UL, 16UL }) {
+        std::vector<G1> results = key->batch_commit(spans, max_concurrent_msms);
+        ASSERT_EQ(results.size(), polys.size());
+        for (size_t i = 0; i < polys.size(); ++i) {
+            EXPECT_EQ(results[i], G1(key->commit(polys[i])));
+        }
+    }
+    EXPECT_TRUE(key->batch_commit({}).empty());
+}
+
+// Check that commitments computed with the precomputed fixed-base MSM match the pippenger ones
+TYPED_TEST(CommitmentKeyTest, CommitFixedBase)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 4096;
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+
+    std::vector<Polynomial> polys;
+    polys.emplace_back(Polynomial::random(num_points));
+    polys.emplace_back(Polynomial::random(1392, num_points, /*start_index=*/1402));
+    polys.emplace_back(Polynomial(num_points));
+    std::vector<G1> expected;
+    for (const auto& poly : polys) {
+        expected.emplace_back(key->commit(poly));
+    }
+
+    // Too small a budget leaves the key unchanged
+    EXPECT_FALSE(key->enable_fixed_base_msm(0));
+    EXPECT_EQ(key->fixed_base_msm, nullptr);
+
+    EXPECT_TRUE(key->enable_fixed_base_msm(size_t(1) << 26));
+    EXPECT_GE(key->fixed_base_msm->precompute_factor(), 2);
+    for (size_t i = 0; i < polys.size(); ++i) {
+        EXPECT_EQ(key->commit(polys[i]), expected[i]);
+    }
+}
+
 // Check that commit and commit_sparse return the same result for a random sparse polynomial
 TYPED_TEST(CommitmentKeyTest, CommitSparse)
 {
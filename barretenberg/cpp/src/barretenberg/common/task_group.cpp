@@ -0,0 +1,333 @@
+#include "task_group.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#ifndef NO_MULTITHREADING
+#include "barretenberg/common/compiler_hints.hpp"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Task {
+    std::function<void()> function;
+    // The task_group the task belongs to. Waiters only run the tasks of their own group.
+    const void* owner = nullptr;
+};
+
+/**
+ * A work-stealing scheduler. Every worker owns a deque: it pushes and pops its own tasks at the back (LIFO, so nested
+ * tasks run while their data is hot in cache) and idle workers steal from the front of other deques (FIFO, so thieves
+ * take the oldest, usually largest, pieces of work). Threads that are not workers (e.g. the main thread) push into a
+ * shared injection deque. A thread waiting on a task_group runs the queued tasks of that group itself, wherever they
+ * are, so there is no barrier and nesting is safe. Once all of them are running elsewhere it blocks.
+ */
+class WorkStealingScheduler {
+  public:
+    WorkStealingScheduler(size_t num_workers);
+    WorkStealingScheduler(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler(WorkStealingScheduler&& other) = delete;
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler& operator=(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler& operator=(WorkStealingScheduler&& other) = delete;
+
+    size_t num_workers() const { return workers_.size(); }
+
+    void spawn(Task task)
+    {
+        auto& queue = *queues_[worker_index_ == NOT_A_WORKER ? injection_queue_index() : worker_index_];
+        // Count the task before publishing it, so that a thief never decrements below zero.
+        num_pending_.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        if (num_sleeping_.load() > 0) {
+            // Taking the lock orders this notify after a sleeper's predicate check (see worker_loop).
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_condition_.notify_one();
+        }
+    }
+
+    /**
+     * @brief Runs one pending task if there is any: first our own newest task, then the injection queue, then the
+     * oldest task of another worker. If owner is given, only its tasks are considered.
+     */
+    bool try_run_one(const void* owner = nullptr)
+    {
+        Task task;
+        if (!try_pop(task, owner)) {
+            return false;
+        }
+        task.function();
+        return true;
+    }
+
+    /**
+     * @brief Blocks a task_group waiter until done() holds. Whatever done() depends on must be changed before calling
+     * notify_waiters().
+     */
+    void wait_until(const std::function<bool()>& done)
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        num_waiting_.fetch_add(1);
+        wait_condition_.wait(lock, done);
+        num_waiting_.fetch_sub(1);
+    }
+
+    void notify_waiters()
+    {
+        if (num_waiting_.load() > 0) {
+            // Taking the lock orders this notify after a waiter's predicate check (see wait_until).
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            wait_condition_.notify_all();
+        }
+    }
+
+  private:
+    static constexpr size_t NOT_A_WORKER = std::numeric_limits<size_t>::max();
+    static thread_local size_t worker_index_;
+
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // One deque per worker, followed by the injection deque for non-worker threads.
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> num_pending_ = 0;
+    std::atomic<size_t> num_sleeping_ = 0;
+    std::atomic<size_t> num_waiting_ = 0;
+    std::mutex sleep_mutex_;
+    // Idle workers and blocked task_group waiters wait on separate conditions, so that a notify_one of spawn() always
+    // reaches a worker.
+    std::condition_variable sleep_condition_;
+    std::condition_variable wait_condition_;
+    bool stop_ = false;
+
+    size_t injection_queue_index() const { return queues_.size() - 1; }
+
+    static bool is_owned_by(const Task& task, const void* owner)
+    {
+        return owner == nullptr || task.owner == owner;
+    }
+
+    // Pops the newest task (of owner, if given).
+    static bool try_pop_back(TaskQueue& queue, Task& task, const void* owner)
+    {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        auto it = std::find_if(
+            queue.tasks.rbegin(), queue.tasks.rend(), [owner](const Task& t) { return is_owned_by(t, owner); });
+        if (it == queue.tasks.rend()) {
+            return false;
+        }
+        task = std::move(*it);
+        queue.tasks.erase(std::next(it).base());
+        return true;
+    }
+
+    // Pops the oldest task (of owner, if given).
+    static bool try_pop_front(TaskQueue& queue, Task& task, const void* owner)
+    {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        auto it = std::find_if(
+            queue.tasks.begin(), queue.tasks.end(), [owner](const Task& t) { return is_owned_by(t, owner); });
+        if (it == queue.tasks.end()) {
+            return false;
+        }
+        task = std::move(*it);
+        queue.tasks.erase(it);
+        return true;
+    }
+
+    bool try_pop(Task& task, const void* owner)
+    {
+        if (num_pending_.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+        const size_t self = worker_index_;
+        bool found = self != NOT_A_WORKER && try_pop_back(*queues_[self], task, owner);
+        found = found || try_pop_front(*queues_[injection_queue_index()], task, owner);
+        // Steal, starting from our neighbour so that thieves spread over the victims.
+        const size_t num_queues = workers_.size();
+        const size_t first_victim = self == NOT_A_WORKER ? 0 : self + 1;
+        for (size_t i = 0; !found && i < num_queues; ++i) {
+            const size_t victim = (first_victim + i) % num_queues;
+            found = victim != self && try_pop_front(*queues_[victim], task, owner);
+        }
+        if (found) {
+            num_pending_.fetch_sub(1);
+        }
+        return found;
+    }
+
+    BB_NO_PROFILE void worker_loop(size_t thread_index);
+};
+
+thread_local size_t WorkStealingScheduler::worker_index_ = WorkStealingScheduler::NOT_A_WORKER;
+
+WorkStealingScheduler::WorkStealingScheduler(size_t num_workers)
+{
+    queues_.reserve(num_workers + 1);
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        queues_.emplace_back(std::make_unique<TaskQueue>());
+    }
+    workers_.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers_.emplace_back(&WorkStealingScheduler::worker_loop, this, i);
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    sleep_condition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkStealingScheduler::worker_loop(size_t thread_index)
+{
+    worker_index_ = thread_index;
+    while (true) {
+        if (try_run_one(/*owner=*/nullptr)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        num_sleeping_.fetch_add(1);
+        sleep_condition_.wait(lock, [this] { return stop_ || num_pending_.load() > 0; });
+        num_sleeping_.fetch_sub(1);
+        if (stop_) {
+            break;
+        }
+    }
+}
+
+WorkStealingScheduler& get_scheduler()
+{
+    // The calling thread always participates, so we need one worker less than the number of cpus.
+    static WorkStealingScheduler scheduler(bb::get_num_cpus() - 1);
+    return scheduler;
+}
+
+} // namespace
+#endif
+
+namespace bb {
+
+void task_group::run(std::function<void()> task)
+{
+#ifdef NO_MULTITHREADING
+    execute(task);
+#else
+    auto& scheduler = get_scheduler();
+    pending_.fetch_add(1);
+    scheduler.spawn({ .function =
+                          [this, &scheduler, task = std::move(task)]() {
+                              execute(task);
+                              // Nothing may touch the group after this: the waiter is free to destroy it.
+                              if (pending_.fetch_sub(1) == 1) {
+                                  scheduler.notify_waiters();
+                              }
+                          },
+                      .owner = this });
+    // A blocked waiter wakes up to run the new task itself.
+    num_runs_.fetch_add(1);
+    scheduler.notify_waiters();
+#endif
+}
+
+void task_group::execute(const std::function<void()>& task)
+{
+#ifndef BB_NO_EXCEPTIONS
+    try {
+        task();
+    } catch (...) {
+        std::unique_lock<std::mutex> lock(error_mutex_);
+        if (!error_) {
+            error_ = std::current_exception();
+        }
+    }
+#else
+    task();
+#endif
+}
+
+void task_group::wait_for_tasks()
+{
+#ifndef NO_MULTITHREADING
+    auto& scheduler = get_scheduler();
+    while (pending_.load() != 0) {
+        // Run our queued tasks ourselves. We never run the tasks of other groups: the caller may be holding locks
+        // that they need. Once all our tasks are running elsewhere, we block until they are done or new ones are
+        // queued (tasks may run() into their own group).
+        const size_t num_runs = num_runs_.load();
+        if (scheduler.try_run_one(this)) {
+            continue;
+        }
+        scheduler.wait_until([&] { return pending_.load() == 0 || num_runs_.load() != num_runs; });
+    }
+#endif
+}
+
+void task_group::wait()
+{
+    wait_for_tasks();
+#ifndef BB_NO_EXCEPTIONS
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(error_mutex_);
+        std::swap(error, error_);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+#endif
+}
+
+/**
+ * A work-stealing strategy. The caller spawns up to one helper task per worker onto the scheduler, then all of them
+ * (caller included) claim iterations from a shared atomic counter until none are left. Iterations are thus balanced
+ * dynamically, helpers that start late simply find no work, and parallel_for may be nested or called concurrently from
+ * several threads.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+#ifdef NO_MULTITHREADING
+    for (size_t i = 0; i < num_iterations; ++i) {
+        func(i);
+    }
+#else
+    if (num_iterations == 0) {
+        return;
+    }
+    std::atomic<size_t> next_iteration = 0;
+    auto claim_iterations = [&]() {
+        for (size_t i = next_iteration.fetch_add(1, std::memory_order_relaxed); i < num_iterations;
+             i = next_iteration.fetch_add(1, std::memory_order_relaxed)) {
+            func(i);
+        }
+    };
+    const size_t num_helpers = std::min(num_iterations, get_scheduler().num_workers() + 1) - 1;
+    task_group group;
+    for (size_t i = 0; i < num_helpers; ++i) {
+        group.run(claim_iterations);
+    }
+    claim_iterations();
+    group.wait();
+#endif
+}
+
+} // namespace bb
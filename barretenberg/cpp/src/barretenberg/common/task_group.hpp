@@ -0,0 +1,50 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+namespace bb {
+
+/**
+ * @brief A set of tasks executed by the process-wide work-stealing scheduler, that can be waited on as a whole.
+ *
+ * @details Tasks may themselves spawn tasks (or call parallel_for), so independent phases of a prover can overlap
+ * instead of being serialized behind a barrier, e.g.
+ *
+ *     task_group group;
+ *     group.run([&] { commitment = ck->commit(poly_a); });
+ *     group.run([&] { compute_inverses(poly_b); });
+ *     group.wait();
+ *
+ * The waiting thread runs the queued tasks of the group itself, so nesting never deadlocks, and blocks once they are
+ * all running elsewhere. It never runs the tasks of other groups, so locks held around wait() are only ever needed by
+ * the group's own tasks. The first exception thrown by a task is rethrown from wait().
+ * Without multithreading, run() executes the task immediately.
+ */
+class task_group {
+  public:
+    task_group() = default;
+    task_group(const task_group& other) = delete;
+    task_group(task_group&& other) = delete;
+    task_group& operator=(const task_group& other) = delete;
+    task_group& operator=(task_group&& other) = delete;
+    // Tasks reference the group, so it can not go out of scope before they are done. Exceptions are dropped here.
+    ~task_group() { wait_for_tasks(); }
+
+    void run(std::function<void()> task);
+    void wait();
+
+  private:
+    std::atomic<size_t> pending_ = 0;
+    // Number of tasks ever run(), for a blocked waiter to notice new ones.
+    std::atomic<size_t> num_runs_ = 0;
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+
+    void execute(const std::function<void()>& task);
+    void wait_for_tasks();
+};
+
+} // namespace bb
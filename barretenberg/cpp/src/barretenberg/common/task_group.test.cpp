@@ -0,0 +1,165 @@
+#include "task_group.hpp"
+#include "thread.hpp"
+#include <chrono>
+#include <ctime>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+using namespace bb;
+
+TEST(TaskGroup, RunsAllTasks)
+{
+    constexpr size_t num_tasks = 1000;
+    std::vector<size_t> results(num_tasks, 0);
+    task_group group;
+    for (size_t i = 0; i < num_tasks; ++i) {
+        group.run([&results, i] { results[i] = i * i; });
+    }
+    group.wait();
+    for (size_t i = 0; i < num_tasks; ++i) {
+        EXPECT_EQ(results[i], i * i);
+    }
+}
+
+TEST(TaskGroup, NestedSpawningAndParallelFor)
+{
+    constexpr size_t num_outer = 16;
+    constexpr size_t num_inner = 257;
+    std::vector<std::vector<size_t>> results(num_outer, std::vector<size_t>(num_inner, 0));
+    task_group outer;
+    for (size_t i = 0; i < num_outer; ++i) {
+        outer.run([&results, i] {
+            // Half of the tasks spawn a nested group, the other half run a nested parallel_for.
+            if (i % 2 == 0) {
+                task_group inner;
+                for (size_t j = 0; j < num_inner; ++j) {
+                    inner.run([&results, i, j] { results[i][j] = i + j; });
+                }
+                inner.wait();
+            } else {
+                parallel_for(num_inner, [&results, i](size_t j) { results[i][j] = i + j; });
+            }
+        });
+    }
+    outer.wait();
+    for (size_t i = 0; i < num_outer; ++i) {
+        for (size_t j = 0; j < num_inner; ++j) {
+            EXPECT_EQ(results[i][j], i + j);
+        }
+    }
+}
+
+TEST(TaskGroup, ConcurrentParallelForFromSeveralThreads)
+{
+    constexpr size_t num_threads = 4;
+    constexpr size_t num_iterations = 10000;
+    std::vector<std::vector<size_t>> results(num_threads, std::vector<size_t>(num_iterations, 0));
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&results, t] {
+            parallel_for_range(num_iterations, [&results, t](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i) {
+                    results[t][i] = 1;
+                }
+            });
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& result : results) {
+        EXPECT_EQ(std::accumulate(result.begin(), result.end(), size_t(0)), num_iterations);
+    }
+}
+
+TEST(TaskGroup, RethrowsTaskException)
+{
+    task_group group;
+    std::atomic<size_t> num_completed = 0;
+    for (size_t i = 0; i < 64; ++i) {
+        group.run([&num_completed, i] {
+            if (i == 17) {
+                throw std::runtime_error("task failed");
+            }
+            num_completed++;
+        });
+    }
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(num_completed, 63);
+}
+
+TEST(TaskGroup, WaiterOnlyRunsItsOwnTasks)
+{
+    // While the main thread waits on its group, another thread keeps queueing tasks of an unrelated group. These could
+    // e.g. need a lock held around our wait(), so we must never run them.
+    const auto waiter_id = std::this_thread::get_id();
+    std::atomic<bool> ran_foreign_task = false;
+    std::atomic<bool> done = false;
+    std::thread other([&] {
+        while (!done) {
+            task_group foreign;
+            for (size_t i = 0; i < 16; ++i) {
+                foreign.run([&] { ran_foreign_task = ran_foreign_task || std::this_thread::get_id() == waiter_id; });
+            }
+            foreign.wait();
+        }
+    });
+
+    task_group group;
+    std::atomic<size_t> num_completed = 0;
+    for (size_t i = 0; i < 64; ++i) {
+        group.run([&num_completed] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            num_completed++;
+        });
+    }
+    group.wait();
+    done = true;
+    other.join();
+    EXPECT_EQ(num_completed, 64);
+    EXPECT_FALSE(ran_foreign_task);
+}
+
+TEST(TaskGroup, WaiterBlocksWhileTasksRunElsewhere)
+{
+    // The only task is picked up by a second waiter (or a worker), the main thread has nothing to run and must block
+    // instead of spinning.
+    std::atomic<bool> started = false;
+    task_group group;
+    group.run([&started] {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    });
+    std::thread helper([&group] { group.wait(); });
+    while (!started) {
+        std::this_thread::yield();
+    }
+
+    timespec before{};
+    timespec after{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &before);
+    group.wait();
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &after);
+    helper.join();
+    const double cpu_seconds = static_cast<double>(after.tv_sec - before.tv_sec) +
+                               static_cast<double>(after.tv_nsec - before.tv_nsec) * 1e-9;
+    EXPECT_LT(cpu_seconds, 0.1);
+}
+
+TEST(TaskGroup, WaiterRunsTasksQueuedWhileBlocked)
+{
+    // A task of the group queues more tasks of the same group while the waiter may be blocked.
+    task_group group;
+    std::atomic<size_t> num_completed = 0;
+    group.run([&group, &num_completed] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        for (size_t i = 0; i < 8; ++i) {
+            group.run([&num_completed] { num_completed++; });
+        }
+        num_completed++;
+    });
+    group.wait();
+    EXPECT_EQ(num_completed, 9);
+}
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -20,6 +21,7 @@
 #include <utility>
 #include <vector>
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/crypto/merkle_tree/hash_path.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
@@ -28,6 +30,7 @@
 #include "barretenberg/crypto/merkle_tree/response.hpp"
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 
 namespace bb::crypto::merkle_tree {
@@ -271,6 +274,13 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     void add_batch_internal(
         std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
+    uint32_t get_num_hashing_subtrees(uint32_t batch_size) const;
+
+    void hash_subtree_in_place(fr* hashes, uint32_t size, uint32_t level, index_t index);
+
+    // Batches are only split for hashing if every subtree has at least this many leaves
+    static constexpr uint32_t MIN_HASHING_SUBTREE_SIZE = 64;
+
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
@@ -547,7 +557,7 @@ std::optional<fr> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_lea
 
         // Extract the node data
         NodePayload nodePayload;
-        bool success = store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted);
+        bool success = store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted, i);
         if (!success) {
             // std::cout << "No root " << hash << std::endl;
             return std::nullopt;
@@ -627,7 +637,7 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::OptionalSiblingPath Conten
 
     for (uint32_t level = 0; level < depth_ - subtree_depth; ++level) {
         NodePayload nodePayload;
-        store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted);
+        store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted, level);
         bool is_right = static_cast<bool>(leaf_index & mask);
         // std::cout << "Level: " << level << ", mask: " << mask << ", is right: " << is_right << ", parent: " << hash
         //           << ", left has value: " << nodePayload.left.has_value()
@@ -995,7 +1005,6 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     index_t index = meta.size;
     new_size = meta.size + number_to_insert;
 
-    // std::cout << "Appending new leaves" << std::endl;
     if (values.empty()) {
         return;
     }
@@ -1007,8 +1016,6 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
 
     // Add the values at the leaf nodes of the tree
     for (uint32_t i = 0; i < number_to_insert; ++i) {
-        // write_node(level, index + i, hashes_local[i]);
-        // std::cout << "Writing leaf hash: " << hashes_local[i] << " level " << level << std::endl;
         store_->put_node_by_hash(hashes_local[i], { .left = std::nullopt, .right = std::nullopt, .ref = 1 });
         store_->put_cached_node_by_index(level, i + index, hashes_local[i]);
     }
@@ -1020,32 +1027,37 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
             if (hashes_local[i] == fr::zero()) {
                 continue;
             }
-            // std::cout << "Updating index " << index + i << " : " << hashes_local[i] << std::endl;
             store_->update_index(index + i, hashes_local[i]);
         }
     }
 
     // Hash the values as a sub tree and insert them
-    while (number_to_insert > 1) {
-        number_to_insert >>= 1;
-        index >>= 1;
-        --level;
-        // std::cout << "To INSERT " << number_to_insert << std::endl;
-        for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
+    // The lower levels of large batches are split into independent subtrees that are hashed concurrently, each one in
+    // its own slice of hashes_local. Their roots are then gathered at the front and the top levels are hashed serially.
+    const uint32_t num_subtrees = get_num_hashing_subtrees(number_to_insert);
+    if (num_subtrees > 1) {
+        const uint32_t subtree_size = number_to_insert / num_subtrees;
+        parallel_for(num_subtrees, [&](size_t subtree) {
+            hash_subtree_in_place(&hashes_local[subtree * subtree_size],
+                                  subtree_size,
+                                  level,
+                                  index + static_cast<index_t>(subtree * subtree_size));
+        });
+        for (uint32_t i = 1; i < num_subtrees; ++i) {
+            hashes_local[i] = hashes_local[static_cast<size_t>(i) * subtree_size];
         }
+        const auto subtree_depth = static_cast<uint32_t>(numeric::get_msb(subtree_size));
+        number_to_insert = num_subtrees;
+        index >>= subtree_depth;
+        level -= subtree_depth;
     }
+    hash_subtree_in_place(hashes_local.data(), number_to_insert, level, index);
+    const auto top_depth = static_cast<uint32_t>(numeric::get_msb(number_to_insert));
+    index >>= top_depth;
+    level -= top_depth;
 
     fr new_hash = hashes_local[0];
 
-    // std::cout << "LEVEL: " << level << " hash " << new_hash << std::endl;
     RequestContext requestContext;
     requestContext.includeUncommitted = true;
     requestContext.root = store_->get_current_root(tx, true);
@@ -1055,13 +1067,8 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     size_t sibling_path_index = 0;
 
     // Hash from the root of the sub-tree to the root of the overall tree
-
-    // std::cout << "Root hash: " << new_hash << std::endl;
     while (level > 0) {
         bool is_right = static_cast<bool>(index & 0x01);
-        // std::cout << "index: " << index << " sibling path index: " << sibling_path_index << ", is right: " <<
-        // is_right
-        //           << std::endl;
         fr left_hash = is_right ? sibling_path_to_root[sibling_path_index] : new_hash;
         fr right_hash = is_right ? new_hash : sibling_path_to_root[sibling_path_index];
 
@@ -1069,21 +1076,55 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         std::optional<fr> right_op = is_right ? new_hash : optional_sibling_path_to_root[sibling_path_index];
 
         new_hash = HashingPolicy::hash_pair(left_hash, right_hash);
-        // std::cout << "Left: " << left_hash << ", right: " << right_hash << ", parent: " << new_hash << std::endl;
 
         index >>= 1;
         --level;
         ++sibling_path_index;
         store_->put_cached_node_by_index(level, index, new_hash);
         store_->put_node_by_hash(new_hash, { .left = left_op, .right = right_op, .ref = 1 });
-        // std::cout << "Writing node hash " << new_hash << " level " << level << " index " << index << std::endl;
     }
 
     new_root = new_hash;
     meta.root = new_hash;
     meta.size = new_size;
-    // std::cout << "New size: " << meta.size << ", root " << meta.root << std::endl;
     store_->put_meta(meta);
 }
 
+template <typename Store, typename HashingPolicy>
+uint32_t ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_num_hashing_subtrees(uint32_t batch_size) const
+{
+    // Batches are powers of 2, so are the number of subtrees and their size
+    const size_t max_subtrees = std::min<size_t>(workers_->num_threads(), batch_size / MIN_HASHING_SUBTREE_SIZE);
+    if (max_subtrees < 2) {
+        return 1;
+    }
+    return static_cast<uint32_t>(1ULL << numeric::get_msb(static_cast<uint64_t>(max_subtrees)));
+}
+
+/**
+ * @brief Hashes the 'size' (a power of 2) leaves of the subtree at 'level' and 'index' up to its root, writing the nodes
+ * to the store. The hashes are reduced in place, the root ends up in hashes[0].
+ * Distinct subtrees can be hashed concurrently, the store serialises the writes.
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::hash_subtree_in_place(fr* hashes,
+                                                                                 uint32_t size,
+                                                                                 uint32_t level,
+                                                                                 index_t index)
+{
+    std::vector<fr> parents(size / 2);
+    while (size > 1) {
+        size >>= 1;
+        index >>= 1;
+        --level;
+        // Hash the whole level at once, which the hashing policy can batch
+        HashingPolicy::hash_pairs(std::span<const fr>(hashes, size * 2), std::span<fr>(parents.data(), size));
+        for (uint32_t i = 0; i < size; ++i) {
+            store_->put_node_by_hash(parents[i], { .left = hashes[i * 2], .right = hashes[i * 2 + 1], .ref = 1 });
+            store_->put_cached_node_by_index(level, index + i, parents[i]);
+        }
+        std::copy(parents.begin(), parents.begin() + size, hashes);
+    }
+}
+
 } // namespace bb::crypto::merkle_tree
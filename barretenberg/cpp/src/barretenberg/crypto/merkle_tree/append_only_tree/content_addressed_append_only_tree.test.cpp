@@ -724,6 +724,41 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_multiple_values_in_a
     check_sibling_path(tree, 4 - 1, memdb.get_sibling_path(4 - 1));
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_large_batches_hashed_as_parallel_subtrees)
+{
+    constexpr size_t depth = 12;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(8);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // The first append leaves the tree unaligned, the second one is split into batches of 1, 4, 8, ..., 1024 leaves.
+    // The largest of them are hashed as several subtrees.
+    std::vector<size_t> append_sizes = { 3, 2045 };
+    index_t tree_size = 0;
+    for (size_t append_size : append_sizes) {
+        std::vector<fr> to_add;
+        for (size_t i = 0; i < append_size; ++i) {
+            fr value = fr(tree_size + i + 1);
+            memdb.update_element(tree_size + i, value);
+            to_add.push_back(value);
+        }
+        add_values(tree, to_add);
+        tree_size += append_size;
+        check_size(tree, tree_size);
+        check_root(tree, memdb.root());
+    }
+
+    for (index_t i : { 0UL, 3UL, 1023UL, 1024UL, 1500UL, tree_size - 1 }) {
+        check_sibling_path(tree, i, memdb.get_sibling_path(i));
+    }
+    commit_tree(tree);
+    check_root(tree, memdb.root(), false);
+    check_sibling_path(tree, 1024, memdb.get_sibling_path(1024), false);
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_pad_with_zero_leaves)
 {
     constexpr size_t depth = 10;
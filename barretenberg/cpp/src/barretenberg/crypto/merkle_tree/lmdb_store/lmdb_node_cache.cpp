@@ -0,0 +1,97 @@
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_node_cache.hpp"
+
+namespace bb::crypto::merkle_tree {
+
+LMDBNodeCache::LMDBNodeCache(const LMDBNodeCacheOptions& options)
+    : numUpperLevels_(options.numUpperLevels)
+{
+    for (auto& shard : shards_) {
+        shard.upper.capacity = (options.maxUpperNodes + NUM_SHARDS - 1) / NUM_SHARDS;
+        shard.lower.capacity = (options.maxLowerNodes + NUM_SHARDS - 1) / NUM_SHARDS;
+    }
+}
+
+LMDBNodeCache::Shard& LMDBNodeCache::get_shard(const fr& nodeHash)
+{
+    return shards_[nodeHash.data[0] % NUM_SHARDS];
+}
+
+void LMDBNodeCache::erase(Partition& partition, const fr& nodeHash)
+{
+    auto it = partition.index.find(nodeHash);
+    if (it == partition.index.end()) {
+        return;
+    }
+    partition.entries.erase(it->second);
+    partition.index.erase(it);
+}
+
+bool LMDBNodeCache::get(const fr& nodeHash, uint64_t snapshotId, NodePayload& nodeData)
+{
+    if (snapshotId < minSnapshotId_) {
+        ++bypassed_;
+        return false;
+    }
+    Shard& shard = get_shard(nodeHash);
+    std::unique_lock lock(shard.mtx);
+    // Checked again under the lock, invalidate may have raised it
+    if (snapshotId < minSnapshotId_) {
+        ++bypassed_;
+        return false;
+    }
+    for (Partition* partition : { &shard.upper, &shard.lower }) {
+        auto it = partition->index.find(nodeHash);
+        if (it != partition->index.end()) {
+            partition->entries.splice(partition->entries.begin(), partition->entries, it->second);
+            nodeData = it->second->second;
+            ++hits_;
+            return true;
+        }
+    }
+    ++misses_;
+    return false;
+}
+
+void LMDBNodeCache::put(const fr& nodeHash,
+                        uint64_t snapshotId,
+                        std::optional<uint32_t> level,
+                        const NodePayload& nodeData)
+{
+    Shard& shard = get_shard(nodeHash);
+    Partition& partition = level.has_value() && level.value() < numUpperLevels_ ? shard.upper : shard.lower;
+    if (partition.capacity == 0) {
+        return;
+    }
+    std::unique_lock lock(shard.mtx);
+    if (snapshotId < minSnapshotId_) {
+        return;
+    }
+    // A node can be read at different levels by different trees, it is only cached once
+    if (shard.upper.index.contains(nodeHash) || shard.lower.index.contains(nodeHash)) {
+        return;
+    }
+    if (partition.entries.size() == partition.capacity) {
+        partition.index.erase(partition.entries.back().first);
+        partition.entries.pop_back();
+    }
+    partition.entries.emplace_front(nodeHash, nodeData);
+    partition.index[nodeHash] = partition.entries.begin();
+}
+
+void LMDBNodeCache::invalidate(const fr& nodeHash, uint64_t writeSnapshotId)
+{
+    Shard& shard = get_shard(nodeHash);
+    std::unique_lock lock(shard.mtx);
+    uint64_t current = minSnapshotId_;
+    while (current < writeSnapshotId && !minSnapshotId_.compare_exchange_weak(current, writeSnapshotId)) {
+    }
+    erase(shard.upper, nodeHash);
+    erase(shard.lower, nodeHash);
+}
+
+LMDBNodeCacheStats LMDBNodeCache::get_stats() const
+{
+    return { .hits = hits_, .misses = misses_, .bypassed = bypassed_ };
+}
+
+} // namespace bb::crypto::merkle_tree
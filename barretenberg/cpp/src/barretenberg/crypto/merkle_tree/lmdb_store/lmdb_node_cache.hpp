@@ -0,0 +1,88 @@
+#pragma once
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace bb::crypto::merkle_tree {
+
+struct LMDBNodeCacheOptions {
+    // Maximum number of cached nodes of the upper levels of the trees, and of the other levels
+    size_t maxUpperNodes = 1 << 14;
+    size_t maxLowerNodes = 1 << 16;
+    // Number of levels below the root (included) that are upper levels
+    uint32_t numUpperLevels = 12;
+};
+
+struct LMDBNodeCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    // Reads of snapshots older than the last write to the nodes, which can not use the cache
+    uint64_t bypassed = 0;
+};
+
+/**
+ * A bounded cache of the nodes read from the nodes database of an LMDBTreeStore, shared by all the forks and readers
+ * of the store. Nodes of the upper levels of the trees are held apart from the others, so that reads of lower nodes do
+ * not evict them; both partitions evict the least recently used nodes first.
+ *
+ * A node written or deleted by a write transaction (new reference, unwind, removal of a historical block) is erased
+ * from the cache, and the cache is then only used by reads of snapshots that include that transaction. Readers of
+ * older snapshots, which could see a stale node, read the database directly.
+ */
+class LMDBNodeCache {
+  public:
+    LMDBNodeCache(const LMDBNodeCacheOptions& options);
+    LMDBNodeCache(const LMDBNodeCache& other) = delete;
+    LMDBNodeCache(LMDBNodeCache&& other) = delete;
+    LMDBNodeCache& operator=(const LMDBNodeCache& other) = delete;
+    LMDBNodeCache& operator=(LMDBNodeCache&& other) = delete;
+    ~LMDBNodeCache() = default;
+
+    bool get(const fr& nodeHash, uint64_t snapshotId, NodePayload& nodeData);
+
+    // Caches a node read from the given snapshot, at the given level of its tree (0 is the root) if known
+    void put(const fr& nodeHash, uint64_t snapshotId, std::optional<uint32_t> level, const NodePayload& nodeData);
+
+    // Must be called before the write transaction with the given snapshot id writes or deletes the node
+    void invalidate(const fr& nodeHash, uint64_t writeSnapshotId);
+
+    LMDBNodeCacheStats get_stats() const;
+
+  private:
+    static constexpr size_t NUM_SHARDS = 16;
+
+    struct Partition {
+        using Entry = std::pair<fr, NodePayload>;
+        // Most recently used first
+        std::list<Entry> entries;
+        std::unordered_map<fr, std::list<Entry>::iterator> index;
+        size_t capacity = 0;
+    };
+
+    struct Shard {
+        std::mutex mtx;
+        Partition upper;
+        Partition lower;
+    };
+
+    Shard& get_shard(const fr& nodeHash);
+    static void erase(Partition& partition, const fr& nodeHash);
+
+    uint32_t numUpperLevels_;
+    std::array<Shard, NUM_SHARDS> shards_;
+    // Reads of snapshots older than this can not use the cache
+    std::atomic<uint64_t> minSnapshotId_ = 0;
+    std::atomic<uint64_t> hits_ = 0;
+    std::atomic<uint64_t> misses_ = 0;
+    std::atomic<uint64_t> bypassed_ = 0;
+};
+
+} // namespace bb::crypto::merkle_tree
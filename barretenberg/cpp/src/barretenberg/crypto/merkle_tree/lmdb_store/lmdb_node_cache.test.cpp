@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "lmdb_node_cache.hpp"
+
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+NodePayload make_node(size_t i)
+{
+    return { .left = VALUES[i], .right = VALUES[i + 1], .ref = 1 };
+}
+} // namespace
+
+TEST(LMDBNodeCacheTest, returns_cached_nodes)
+{
+    LMDBNodeCache cache(LMDBNodeCacheOptions{});
+    NodePayload node;
+    EXPECT_FALSE(cache.get(VALUES[0], 1, node));
+    cache.put(VALUES[0], 1, 0, make_node(1));
+    EXPECT_TRUE(cache.get(VALUES[0], 1, node));
+    EXPECT_EQ(node, make_node(1));
+    EXPECT_TRUE(cache.get(VALUES[0], 5, node));
+    EXPECT_EQ(cache.get_stats().hits, 2);
+    EXPECT_EQ(cache.get_stats().misses, 1);
+}
+
+// Snapshots older than a write to a node can not read or insert it
+TEST(LMDBNodeCacheTest, bypasses_snapshots_older_than_writes)
+{
+    LMDBNodeCache cache(LMDBNodeCacheOptions{});
+    NodePayload node;
+    cache.put(VALUES[0], 1, 0, make_node(1));
+    cache.invalidate(VALUES[0], 2);
+    EXPECT_FALSE(cache.get(VALUES[0], 1, node));
+    EXPECT_EQ(cache.get_stats().bypassed, 1);
+
+    cache.put(VALUES[0], 1, 0, make_node(1));
+    EXPECT_FALSE(cache.get(VALUES[0], 2, node));
+    cache.put(VALUES[0], 2, 0, make_node(2));
+    EXPECT_TRUE(cache.get(VALUES[0], 2, node));
+    EXPECT_EQ(node, make_node(2));
+}
+
+// Lower nodes are evicted least recently used first, without evicting upper nodes
+TEST(LMDBNodeCacheTest, evicts_lower_nodes_only)
+{
+    // One node per shard and partition
+    LMDBNodeCache cache(LMDBNodeCacheOptions{ .maxUpperNodes = 1, .maxLowerNodes = 1, .numUpperLevels = 1 });
+    NodePayload node;
+    cache.put(VALUES[0], 1, 0, make_node(0));
+    for (size_t i = 1; i < 64; ++i) {
+        cache.put(VALUES[i], 1, 20, make_node(i));
+        cache.put(VALUES[i + 64], 1, std::nullopt, make_node(i));
+    }
+    EXPECT_TRUE(cache.get(VALUES[0], 1, node));
+    size_t numCachedLower = 0;
+    for (size_t i = 1; i < 128; ++i) {
+        if (cache.get(VALUES[i], 1, node)) {
+            ++numCachedLower;
+        }
+    }
+    EXPECT_LE(numCachedLower, 16);
+    EXPECT_TRUE(cache.get(VALUES[63 + 64], 1, node));
+}
@@ -7,6 +7,7 @@
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_node_cache.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/lmdblib/lmdb_db_transaction.hpp"
@@ -55,8 +56,17 @@ int index_key_cmp(const MDB_val* a, const MDB_val* b)
 }
 
 LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders)
+    : LMDBTreeStore(std::move(directory), std::move(name), mapSizeKb, maxNumReaders, LMDBNodeCacheOptions{})
+{}
+
+LMDBTreeStore::LMDBTreeStore(std::string directory,
+                             std::string name,
+                             uint64_t mapSizeKb,
+                             uint64_t maxNumReaders,
+                             const LMDBNodeCacheOptions& nodeCacheOptions)
     : LMDBStoreBase(directory, mapSizeKb, maxNumReaders, 5)
     , _name(std::move(name))
+    , _nodeCache(std::make_unique<LMDBNodeCache>(nodeCacheOptions))
 {
 
     {
@@ -95,6 +105,8 @@ LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t m
     }
 }
 
+LMDBTreeStore::~LMDBTreeStore() = default;
+
 const std::string& LMDBTreeStore::get_name() const
 {
     return _name;
@@ -281,6 +293,7 @@ void LMDBTreeStore::decrement_node_reference_count(const fr& nodeHash, NodePaylo
     }
     if (--nodeData.ref == 0) {
         // std::cout << "Deleting node at " << nodeHash << std::endl;
+        _nodeCache->invalidate(nodeHash, tx.snapshot_id());
         tx.delete_value(nodeHash, *_nodeDatabase);
         return;
     }
@@ -313,19 +326,33 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
     return key;
 }
 
-bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
+bool LMDBTreeStore::read_node(const fr& nodeHash,
+                              NodePayload& nodeData,
+                              ReadTransaction& tx,
+                              std::optional<uint32_t> level)
 {
+    const uint64_t snapshotId = tx.snapshot_id();
+    if (_nodeCache->get(nodeHash, snapshotId, nodeData)) {
+        return true;
+    }
     FrKeyType key(nodeHash);
     std::vector<uint8_t> data;
     bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
         msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        _nodeCache->put(nodeHash, snapshotId, level, nodeData);
     }
     return success;
 }
 
+LMDBNodeCacheStats LMDBTreeStore::get_node_cache_stats() const
+{
+    return _nodeCache->get_stats();
+}
+
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
+    _nodeCache->invalidate(nodeHash, tx.snapshot_id());
     msgpack::sbuffer buffer;
     msgpack::pack(buffer, nodeData);
     std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
@@ -159,6 +159,10 @@ struct BlockIndexPayload {
         blockNumbers[1] = blockNumber;
     }
 };
+class LMDBNodeCache;
+struct LMDBNodeCacheOptions;
+struct LMDBNodeCacheStats;
+
 /**
  * Creates an abstraction against a collection of LMDB databases within a single environment used to store merkle tree
  * data
@@ -171,11 +175,16 @@ class LMDBTreeStore : public LMDBStoreBase {
     using ReadTransaction = LMDBReadTransaction;
     using WriteTransaction = LMDBWriteTransaction;
     LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders);
+    LMDBTreeStore(std::string directory,
+                  std::string name,
+                  uint64_t mapSizeKb,
+                  uint64_t maxNumReaders,
+                  const LMDBNodeCacheOptions& nodeCacheOptions);
     LMDBTreeStore(const LMDBTreeStore& other) = delete;
     LMDBTreeStore(LMDBTreeStore&& other) = delete;
     LMDBTreeStore& operator=(const LMDBTreeStore& other) = delete;
     LMDBTreeStore& operator=(LMDBTreeStore&& other) = delete;
-    ~LMDBTreeStore() override = default;
+    ~LMDBTreeStore() override;
 
     const std::string& get_name() const;
 
@@ -206,7 +215,13 @@ class LMDBTreeStore : public LMDBStoreBase {
 
     void delete_leaf_index(const fr& leafValue, WriteTransaction& tx);
 
-    bool read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx);
+    // Reads through the node cache, level is the level of the node in its tree if known
+    bool read_node(const fr& nodeHash,
+                   NodePayload& nodeData,
+                   ReadTransaction& tx,
+                   std::optional<uint32_t> level = std::nullopt);
+
+    LMDBNodeCacheStats get_node_cache_stats() const;
 
     void write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx);
 
@@ -245,6 +260,7 @@ class LMDBTreeStore : public LMDBStoreBase {
     LMDBDatabase::Ptr _leafKeyToIndexDatabase;
     LMDBDatabase::Ptr _leafHashToPreImageDatabase;
     LMDBDatabase::Ptr _indexToBlockDatabase;
+    std::unique_ptr<LMDBNodeCache> _nodeCache;
 
     template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
 };
@@ -20,6 +20,7 @@
 #include "barretenberg/numeric/uint128/uint128.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include "lmdb_node_cache.hpp"
 #include "lmdb_tree_store.hpp"
 
 using namespace bb::stdlib;
@@ -275,6 +276,71 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_nodes)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, reads_nodes_through_the_node_cache)
+{
+    NodePayload nodePayload{ .left = VALUES[4], .right = VALUES[5], .ref = 1 };
+    bb::fr key = VALUES[6];
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_node(key, nodePayload, *transaction);
+        transaction->commit();
+    }
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        NodePayload readBack;
+        EXPECT_TRUE(store.read_node(key, readBack, *transaction, 0));
+        EXPECT_EQ(readBack, nodePayload);
+    }
+    EXPECT_EQ(store.get_node_cache_stats().misses, 1);
+    EXPECT_EQ(store.get_node_cache_stats().hits, 2);
+
+    // A new reference is seen by the next readers
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.increment_node_reference_count(key, *transaction);
+        transaction->commit();
+    }
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        NodePayload readBack;
+        EXPECT_TRUE(store.read_node(key, readBack, *transaction, 0));
+        EXPECT_EQ(readBack.ref, 2);
+    }
+}
+
+// A reader of a snapshot taken before a node is deleted still finds it, and can not make it visible to later readers
+TEST_F(LMDBTreeStoreTest, node_cache_is_invalidated_by_deletes)
+{
+    NodePayload nodePayload{ .left = VALUES[4], .right = VALUES[5], .ref = 1 };
+    bb::fr key = VALUES[6];
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_node(key, nodePayload, *transaction);
+        transaction->commit();
+    }
+
+    LMDBReadTransaction::Ptr staleTransaction = store.create_read_transaction();
+    NodePayload readBack;
+    EXPECT_TRUE(store.read_node(key, readBack, *staleTransaction, 0));
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.decrement_node_reference_count(key, readBack, *transaction);
+        EXPECT_EQ(readBack.ref, 0);
+        // Read by the older snapshot while the delete is pending
+        EXPECT_TRUE(store.read_node(key, readBack, *staleTransaction, 0));
+        transaction->commit();
+    }
+    EXPECT_TRUE(store.read_node(key, readBack, *staleTransaction, 0));
+    EXPECT_EQ(readBack, nodePayload);
+    staleTransaction->abort();
+
+    LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+    EXPECT_FALSE(store.read_node(key, readBack, *transaction, 0));
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
 {
     PublicDataLeafValue leafData;
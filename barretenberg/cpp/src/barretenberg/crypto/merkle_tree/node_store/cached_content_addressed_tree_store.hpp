@@ -95,11 +95,13 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     /**
      * @brief Returns the data at the given node coordinates if available. Reads from uncommitted state if requested.
+     * The level of the node (0 is the root), if known, lets the store keep the upper nodes cached.
      */
     bool get_node_by_hash(const fr& nodeHash,
                           NodePayload& payload,
                           ReadTransaction& transaction,
-                          bool includeUncommitted) const;
+                          bool includeUncommitted,
+                          std::optional<uint32_t> level = std::nullopt) const;
 
     /**
      * @brief Writes the provided data at the given node coordinates. Only writes to uncommitted data.
@@ -500,7 +502,8 @@ template <typename LeafValueType>
 bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr& nodeHash,
                                                                       NodePayload& payload,
                                                                       ReadTransaction& transaction,
-                                                                      bool includeUncommitted) const
+                                                                      bool includeUncommitted,
+                                                                      std::optional<uint32_t> level) const
 {
     if (includeUncommitted) {
         // Accessing nodes_ under a lock
@@ -509,7 +512,7 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
             return true;
         }
     }
-    return dataStore_->read_node(nodeHash, payload, transaction);
+    return dataStore_->read_node(nodeHash, payload, transaction, level);
 }
 
 template <typename LeafValueType>
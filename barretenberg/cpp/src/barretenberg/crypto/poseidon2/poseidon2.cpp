@@ -16,6 +16,27 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_internal(input);
 }
 
+template <typename Params>
+void Poseidon2<Params>::hash_pairs(std::span<const FF> inputs, std::span<FF> outputs)
+{
+    using Permutation = Poseidon2Permutation<Params>;
+    ASSERT(inputs.size() == 2 * outputs.size());
+    // The sponge state after absorbing two elements, for one output (see FieldSponge::hash_internal)
+    const FF iv = static_cast<uint256_t>(2) << 64;
+    constexpr size_t CHUNK_SIZE = 64;
+    std::array<typename Permutation::State, CHUNK_SIZE> states;
+    for (size_t start = 0; start < outputs.size(); start += CHUNK_SIZE) {
+        const size_t num_states = std::min(CHUNK_SIZE, outputs.size() - start);
+        for (size_t i = 0; i < num_states; ++i) {
+            states[i] = { inputs[2 * (start + i)], inputs[2 * (start + i) + 1], 0, iv };
+        }
+        Permutation::permutation_batch(std::span(states.data(), num_states));
+        for (size_t i = 0; i < num_states; ++i) {
+            outputs[start + i] = states[i][0];
+        }
+    }
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
@@ -10,6 +10,8 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -23,6 +25,12 @@ template <typename Params> class Poseidon2 {
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes consecutive pairs of field elements, outputs[i] = hash({ inputs[2i], inputs[2i + 1] }), batching
+     * their permutations
+     * @details outputs can be the first half of inputs.
+     */
+    static void hash_pairs(std::span<const FF> inputs, std::span<FF> outputs);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
@@ -64,3 +64,23 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashPairsMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    // More pairs than hash_pairs permutes at once
+    constexpr size_t num_pairs = 100;
+    std::vector<fr> inputs(num_pairs * 2);
+    for (auto& input : inputs) {
+        input = fr::random_element(&engine);
+    }
+    std::vector<fr> outputs(num_pairs);
+    Poseidon2::hash_pairs(inputs, outputs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        EXPECT_EQ(outputs[i], Poseidon2::hash({ inputs[2 * i], inputs[2 * i + 1] }));
+    }
+
+    // In place, as when hashing a level of a tree
+    Poseidon2::hash_pairs(inputs, std::span(inputs.data(), num_pairs));
+    EXPECT_EQ(std::vector<fr>(inputs.begin(), inputs.begin() + num_pairs), outputs);
+}
@@ -10,9 +10,11 @@
 
 #include "barretenberg/common/throw_or_abort.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace bb::crypto {
 
@@ -166,5 +168,134 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    // The number of states permutation_batch permutes together with scalar multiplications
+    static constexpr size_t BATCH_SIZE = 4;
+    // The number of states permutation_batch permutes together when the field has a vectorized batch_mul, one per
+    // lane of its kernel
+    static constexpr size_t VECTORIZED_BATCH_SIZE = 8;
+
+    /**
+     * @brief Applies the permutation to each of the states, in place
+     * @details Each internal round applies one s-box, on which the next round depends, so permuting a single state
+     * mostly waits on the latency of its multiplications. If the field has a vectorized batch_mul (AVX-512 IFMA, see
+     * field_impl_batch.hpp), the s-boxes of VECTORIZED_BATCH_SIZE states are computed together with batch_sqr and
+     * batch_mul. The remaining states are permuted BATCH_SIZE at a time, with the steps of each round interleaved
+     * between them so that their independent scalar multiplications overlap.
+     */
+    static void permutation_batch(std::span<State> states)
+    {
+        size_t offset = 0;
+        if (FF::has_vectorized_batch_mul()) {
+            for (; offset + VECTORIZED_BATCH_SIZE <= states.size(); offset += VECTORIZED_BATCH_SIZE) {
+                permutation_vectorized(&states[offset]);
+            }
+        }
+        for (; offset + BATCH_SIZE <= states.size(); offset += BATCH_SIZE) {
+            permutation_interleaved(&states[offset]);
+        }
+        for (State& state : states.subspan(offset)) {
+            state = permutation(state);
+        }
+    }
+
+  private:
+    static void permutation_interleaved(State* states)
+    {
+        const auto for_each_state = [&](auto&& function) {
+            for (size_t j = 0; j < BATCH_SIZE; ++j) {
+                function(states[j]);
+            }
+        };
+        for_each_state(matrix_multiplication_external);
+
+        // The s-boxes of an external round are independent already
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        const auto external_round = [&](size_t i) {
+            for_each_state([&](State& state) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            });
+        };
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            external_round(i);
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        std::array<FF, BATCH_SIZE> squares;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (size_t j = 0; j < BATCH_SIZE; ++j) {
+                states[j][0] += round_constants[i][0];
+                squares[j] = states[j][0].sqr();
+            }
+            for (size_t j = 0; j < BATCH_SIZE; ++j) {
+                squares[j].self_sqr();
+            }
+            for (size_t j = 0; j < BATCH_SIZE; ++j) {
+                states[j][0] *= squares[j];
+            }
+            for_each_state(matrix_multiplication_internal);
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            external_round(i);
+        }
+    }
+
+    // Computes x^5 for each of the elements, in place
+    static void apply_sbox_batch(std::span<FF> inputs, std::span<FF> scratch)
+    {
+        // hardcoded assumption that d = 5, as in apply_single_sbox
+        FF::batch_sqr(inputs, scratch);
+        FF::batch_sqr(scratch, scratch);
+        FF::batch_mul(inputs, scratch, inputs);
+    }
+
+    static void permutation_vectorized(State* states)
+    {
+        constexpr size_t N = VECTORIZED_BATCH_SIZE;
+        // All the elements of the states, for the s-boxes of the external rounds
+        std::array<FF, N * t> elements;
+        std::array<FF, N * t> scratch;
+        const auto external_round = [&](size_t i) {
+            for (size_t j = 0; j < N; ++j) {
+                add_round_constants(states[j], round_constants[i]);
+                std::copy(states[j].begin(), states[j].end(), &elements[j * t]);
+            }
+            apply_sbox_batch(elements, scratch);
+            for (size_t j = 0; j < N; ++j) {
+                std::copy_n(&elements[j * t], t, states[j].begin());
+                matrix_multiplication_external(states[j]);
+            }
+        };
+
+        for (size_t j = 0; j < N; ++j) {
+            matrix_multiplication_external(states[j]);
+        }
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            external_round(i);
+        }
+
+        // Internal rounds: one s-box per state, i.e. one per lane
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        const std::span<FF> lanes(elements.data(), N);
+        const std::span<FF> lane_scratch(scratch.data(), N);
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                lanes[j] = states[j][0] + round_constants[i][0];
+            }
+            apply_sbox_batch(lanes, lane_scratch);
+            for (size_t j = 0; j < N; ++j) {
+                states[j][0] = lanes[j];
+                matrix_multiplication_internal(states[j]);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            external_round(i);
+        }
+    }
 };
 } // namespace bb::crypto
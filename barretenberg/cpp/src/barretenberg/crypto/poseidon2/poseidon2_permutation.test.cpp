@@ -59,3 +59,21 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+// The batched permutation of any number of states (including a partial batch) matches the permutation of each state.
+// With a vectorized field backend, the states go through both batch kernels and the single permutation.
+TEST(Poseidon2Permutation, BatchMatchesPermutation)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    std::vector<Permutation::State> states(Permutation::VECTORIZED_BATCH_SIZE * 2 + Permutation::BATCH_SIZE + 3);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = fr::random_element(&engine);
+        }
+    }
+    auto batched_states = states;
+    Permutation::permutation_batch(batched_states);
+    for (size_t i = 0; i < states.size(); ++i) {
+        EXPECT_EQ(batched_states[i], Permutation::permutation(states[i]));
+    }
+}
@@ -8,6 +8,7 @@
 
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/dsl/acir_format/ivc_recursion_constraint.hpp"
 #include "barretenberg/dsl/acir_format/proof_surgeon.hpp"
@@ -23,7 +24,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 
 namespace acir_format {
 
@@ -46,6 +49,44 @@ template <typename Builder> struct HonkRecursionConstraintsOutput {
     bool is_root_rollup = false;
 };
 
+namespace {
+/**
+ * @brief Add independent constraints to the circuit by building them in parallel, in shards of it
+ * @details The constraints are split into a fixed number of contiguous ranges, whatever the number of threads, and the
+ * shards are merged in order, so the circuit only depends on the constraints. It has the same number of gates as when
+ * the constraints are added directly, but not in the same order: its verification key is different.
+ */
+void build_constraints_in_shards(
+    UltraCircuitBuilder& builder,
+    const std::vector<std::pair<std::function<void(UltraCircuitBuilder&)>, size_t>>& constraints)
+{
+    constexpr size_t MAX_NUM_SHARDS = 32;
+    const size_t num_shards = std::min(constraints.size(), MAX_NUM_SHARDS);
+    if (num_shards == 0) {
+        return;
+    }
+    const auto initial_shard = builder.create_shard();
+    // Only build as many shards at a time as there are threads, since each holds a copy of the circuit's variables
+    const size_t num_shards_per_round = get_num_cpus();
+    for (size_t round_start = 0; round_start < num_shards; round_start += num_shards_per_round) {
+        const size_t round_end = std::min(round_start + num_shards_per_round, num_shards);
+        std::vector<std::optional<UltraCircuitBuilder::Shard>> shards(round_end - round_start);
+        parallel_for(shards.size(), [&](size_t i) {
+            const size_t shard_index = round_start + i;
+            auto& shard = shards[i].emplace(initial_shard);
+            for (size_t j = shard_index * constraints.size() / num_shards;
+                 j < (shard_index + 1) * constraints.size() / num_shards;
+                 ++j) {
+                constraints[j].first(shard.builder);
+            }
+        });
+        for (auto& shard : shards) {
+            builder.merge_shard(*shard);
+        }
+    }
+}
+} // namespace
+
 template <typename Builder>
 void build_constraints(Builder& builder, AcirProgram& program, const ProgramMetadata& metadata)
 {
@@ -123,67 +164,61 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
                                 constraint_system.original_opcode_indices.range_constraints.at(i));
     }
 
-    // Add aes128 constraints
+    // The constraints of the hash and signature verification opcodes only involve their own witnesses, so they can be
+    // built in shards of the circuit.
+    std::vector<std::pair<std::function<void(Builder&)>, size_t>> independent_constraints;
+    const auto& opcode_indices = constraint_system.original_opcode_indices;
     for (size_t i = 0; i < constraint_system.aes128_constraints.size(); ++i) {
         const auto& constraint = constraint_system.aes128_constraints.at(i);
-        create_aes128_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.aes128_constraints.at(i));
+        independent_constraints.emplace_back([&](Builder& b) { create_aes128_constraints(b, constraint); },
+                                             opcode_indices.aes128_constraints.at(i));
     }
-
-    // Add sha256 constraints
     for (size_t i = 0; i < constraint_system.sha256_compression.size(); ++i) {
         const auto& constraint = constraint_system.sha256_compression[i];
-        create_sha256_compression_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.sha256_compression[i]);
+        independent_constraints.emplace_back([&](Builder& b) { create_sha256_compression_constraints(b, constraint); },
+                                             opcode_indices.sha256_compression[i]);
     }
-
-    // Add ECDSA k1 constraints
     for (size_t i = 0; i < constraint_system.ecdsa_k1_constraints.size(); ++i) {
         const auto& constraint = constraint_system.ecdsa_k1_constraints.at(i);
-        create_ecdsa_k1_verify_constraints(builder, constraint, has_valid_witness_assignments);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.ecdsa_k1_constraints.at(i));
+        independent_constraints.emplace_back(
+            [&](Builder& b) { create_ecdsa_k1_verify_constraints(b, constraint, has_valid_witness_assignments); },
+            opcode_indices.ecdsa_k1_constraints.at(i));
     }
-
-    // Add ECDSA r1 constraints
     for (size_t i = 0; i < constraint_system.ecdsa_r1_constraints.size(); ++i) {
         const auto& constraint = constraint_system.ecdsa_r1_constraints.at(i);
-        create_ecdsa_r1_verify_constraints(builder, constraint, has_valid_witness_assignments);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.ecdsa_r1_constraints.at(i));
+        independent_constraints.emplace_back(
+            [&](Builder& b) { create_ecdsa_r1_verify_constraints(b, constraint, has_valid_witness_assignments); },
+            opcode_indices.ecdsa_r1_constraints.at(i));
     }
-
-    // Add blake2s constraints
     for (size_t i = 0; i < constraint_system.blake2s_constraints.size(); ++i) {
         const auto& constraint = constraint_system.blake2s_constraints.at(i);
-        create_blake2s_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.blake2s_constraints.at(i));
+        independent_constraints.emplace_back([&](Builder& b) { create_blake2s_constraints(b, constraint); },
+                                             opcode_indices.blake2s_constraints.at(i));
     }
-
-    // Add blake3 constraints
     for (size_t i = 0; i < constraint_system.blake3_constraints.size(); ++i) {
         const auto& constraint = constraint_system.blake3_constraints.at(i);
-        create_blake3_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.blake3_constraints.at(i));
+        independent_constraints.emplace_back([&](Builder& b) { create_blake3_constraints(b, constraint); },
+                                             opcode_indices.blake3_constraints.at(i));
     }
-
-    // Add keccak permutations
     for (size_t i = 0; i < constraint_system.keccak_permutations.size(); ++i) {
         const auto& constraint = constraint_system.keccak_permutations[i];
-        create_keccak_permutations(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.keccak_permutations[i]);
+        independent_constraints.emplace_back([&](Builder& b) { create_keccak_permutations(b, constraint); },
+                                             opcode_indices.keccak_permutations[i]);
     }
-
     for (size_t i = 0; i < constraint_system.poseidon2_constraints.size(); ++i) {
         const auto& constraint = constraint_system.poseidon2_constraints.at(i);
-        create_poseidon2_permutations(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.poseidon2_constraints.at(i));
+        independent_constraints.emplace_back([&](Builder& b) { create_poseidon2_permutations(b, constraint); },
+                                             opcode_indices.poseidon2_constraints.at(i));
+    }
+    if constexpr (IsUltraBuilder<Builder>) {
+        if (metadata.shard_constraints && !collect_gates_per_opcode) {
+            build_constraints_in_shards(builder, independent_constraints);
+            independent_constraints.clear();
+        }
+    }
+    for (const auto& [add_constraint, opcode_index] : independent_constraints) {
+        add_constraint(builder);
+        gate_counter.track_diff(constraint_system.gates_per_opcode, opcode_index);
     }
 
     // Add multi scalar mul constraints
@@ -217,6 +217,11 @@ struct ProgramMetadata {
                                  // 2 means we are using the UltraRollupHonk flavor
     bool collect_gates_per_opcode = false;
     size_t size_hint = 0;
+    // Build the hash and signature verification constraints of an Ultra circuit in parallel. The circuit has the same
+    // number of gates, but they are ordered differently: the verification key is only valid for proofs of circuits
+    // built with the same setting, so write_vk and prove must be given the same --shard_constraints flag. Ignored when
+    // collecting gates per opcode.
+    bool shard_constraints = false;
 };
 
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/1161) Refactor this function
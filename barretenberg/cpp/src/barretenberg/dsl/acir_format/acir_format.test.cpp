@@ -5,6 +5,9 @@
 #include "acir_format.hpp"
 #include "acir_format_mocks.hpp"
 #include "barretenberg/common/streams.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
 #include "barretenberg/op_queue/ecc_op_queue.hpp"
 
 #include "barretenberg/serialize/test_helper.hpp"
@@ -450,3 +453,86 @@ TEST_F(AcirFormatTests, TestBigAdd)
 
     EXPECT_TRUE(CircuitChecker::check(builder));
 }
+
+/**
+ * @brief Building the hash constraints in shards gives a valid circuit with the same number of gates
+ */
+TEST_F(AcirFormatTests, TestShardedConstraintsMatchGateCount)
+{
+    constexpr size_t num_permutations = 6;
+    constexpr uint32_t keccak_state_size = 25;
+    constexpr uint32_t poseidon2_state_size = 4;
+
+    // All the permutations have the same input, the first witnesses
+    WitnessVector witness;
+    std::array<uint64_t, keccak_state_size> keccak_state;
+    for (uint32_t i = 0; i < keccak_state_size; ++i) {
+        keccak_state[i] = i + 1;
+        witness.emplace_back(keccak_state[i]);
+    }
+    ethash_keccakf1600(keccak_state.data());
+    using Poseidon2 = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    const auto poseidon2_state = Poseidon2::permutation({ witness[0], witness[1], witness[2], witness[3] });
+
+    std::vector<Keccakf1600> keccak_permutations;
+    std::vector<Poseidon2Constraint> poseidon2_constraints;
+    for (size_t i = 0; i < num_permutations; ++i) {
+        Keccakf1600 keccak_permutation;
+        for (uint32_t j = 0; j < keccak_state_size; ++j) {
+            keccak_permutation.state[j] = WitnessOrConstant<bb::fr>::from_index(j);
+            keccak_permutation.result[j] = static_cast<uint32_t>(witness.size());
+            witness.emplace_back(keccak_state[j]);
+        }
+        keccak_permutations.emplace_back(keccak_permutation);
+
+        Poseidon2Constraint poseidon2_constraint{ .state = {}, .result = {}, .len = poseidon2_state_size };
+        for (uint32_t j = 0; j < poseidon2_state_size; ++j) {
+            poseidon2_constraint.state.emplace_back(WitnessOrConstant<bb::fr>::from_index(j));
+            poseidon2_constraint.result.emplace_back(static_cast<uint32_t>(witness.size()));
+            witness.emplace_back(poseidon2_state[j]);
+        }
+        poseidon2_constraints.emplace_back(poseidon2_constraint);
+    }
+
+    AcirFormat constraint_system{
+        .varnum = static_cast<uint32_t>(witness.size()),
+        .num_acir_opcodes = static_cast<uint32_t>(2 * num_permutations),
+        .public_inputs = {},
+        .logic_constraints = {},
+        .range_constraints = {},
+        .aes128_constraints = {},
+        .sha256_compression = {},
+        .ecdsa_k1_constraints = {},
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .blake3_constraints = {},
+        .keccak_permutations = keccak_permutations,
+        .poseidon2_constraints = poseidon2_constraints,
+        .multi_scalar_mul_constraints = {},
+        .ec_add_constraints = {},
+        .recursion_constraints = {},
+        .honk_recursion_constraints = {},
+        .avm_recursion_constraints = {},
+        .ivc_recursion_constraints = {},
+        .bigint_from_le_bytes_constraints = {},
+        .bigint_to_le_bytes_constraints = {},
+        .bigint_operations = {},
+        .assert_equalities = {},
+        .poly_triple_constraints = {},
+        .quad_constraints = {},
+        .big_quad_constraints = {},
+        .block_constraints = {},
+        .original_opcode_indices = create_empty_original_opcode_indices(),
+    };
+    mock_opcode_indices(constraint_system);
+
+    AcirProgram program{ constraint_system, witness };
+    auto builder = create_circuit(program);
+    AcirProgram sharded_program{ constraint_system, witness };
+    auto sharded_builder = create_circuit(sharded_program, ProgramMetadata{ .shard_constraints = true });
+
+    EXPECT_EQ(sharded_builder.get_estimated_num_finalized_gates(), builder.get_estimated_num_finalized_gates());
+    EXPECT_EQ(sharded_builder.get_num_variables(), builder.get_num_variables());
+    EXPECT_TRUE(CircuitChecker::check(builder));
+    EXPECT_TRUE(CircuitChecker::check(sharded_builder));
+}
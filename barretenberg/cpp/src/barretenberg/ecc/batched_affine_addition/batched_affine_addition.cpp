@@ -7,6 +7,7 @@
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include <algorithm>
+#include <array>
 #include <execution>
 #include <set>
 
@@ -149,10 +150,9 @@ std::span<typename BatchedAffineAddition<Curve>::Fq> BatchedAffineAddition<
     // Define scratch space for batched inverse computations and eventual storage of denominators
     ASSERT(add_sequences.scratch_space.size() >= 2 * total_num_pairs);
     std::span<Fq> denominators = add_sequences.scratch_space.subspan(0, total_num_pairs);
-    std::span<Fq> differences = add_sequences.scratch_space.subspan(total_num_pairs, 2 * total_num_pairs);
+    std::span<Fq> differences = add_sequences.scratch_space.subspan(total_num_pairs, total_num_pairs);
 
-    // Compute and store successive products of differences (x_2 - x_1)
-    Fq accumulator = 1;
+    // Compute the differences (x_2 - x_1)
     size_t point_idx = 0;
     size_t pair_idx = 0;
     for (auto& count : sequence_counts) {
@@ -165,25 +165,35 @@ std::span<typename BatchedAffineAddition<Curve>::Fq> BatchedAffineAddition<
             // It is assumed that the input points are random and thus w/h/p do not share an x-coordinate
             ASSERT(x1 != x2);
 
-            auto diff = x2 - x1;
-            differences[pair_idx] = diff;
-
-            // Store and update the running product of differences at each stage
-            denominators[pair_idx++] = accumulator;
-            accumulator *= diff;
+            differences[pair_idx++] = x2 - x1;
         }
         // If number of points in the sequence is odd, we skip the last one since it has no pair
         point_idx += (count & 0x01ULL);
     }
 
-    // Invert the full product of differences
-    Fq inverse = accumulator.invert();
+    // Compute and store successive products of the differences, with lane l accumulating the differences l, l + L, l +
+    // 2L, ... for L = BATCH_INVERSION_LANES so that each step multiplies independent elements
+    std::array<Fq, BATCH_INVERSION_LANES> accumulators;
+    accumulators.fill(Fq::one());
+    for (size_t block = 0; block < total_num_pairs; block += BATCH_INVERSION_LANES) {
+        const size_t num_lanes = std::min(BATCH_INVERSION_LANES, total_num_pairs - block);
+        std::span<Fq> lanes = std::span(accumulators).first(num_lanes);
+        std::copy(lanes.begin(), lanes.end(), denominators.begin() + static_cast<std::ptrdiff_t>(block));
+        Fq::batch_mul(lanes, differences.subspan(block, num_lanes), lanes);
+    }
+
+    // Invert the full product of differences of every lane
+    Fq::batch_invert(accumulators);
 
     // Compute the individual point-pair addition denominators 1/(x2 - x1)
-    for (size_t i = 0; i < total_num_pairs; ++i) {
-        size_t idx = total_num_pairs - 1 - i;
-        denominators[idx] *= inverse;
-        inverse *= differences[idx];
+    const size_t num_blocks = (total_num_pairs + BATCH_INVERSION_LANES - 1) / BATCH_INVERSION_LANES;
+    for (size_t i = 0; i < num_blocks; ++i) {
+        const size_t block = (num_blocks - 1 - i) * BATCH_INVERSION_LANES;
+        const size_t num_lanes = std::min(BATCH_INVERSION_LANES, total_num_pairs - block);
+        std::span<Fq> lanes = std::span(accumulators).first(num_lanes);
+        std::span<Fq> block_denominators = denominators.subspan(block, num_lanes);
+        Fq::batch_mul(block_denominators, lanes, block_denominators);
+        Fq::batch_mul(lanes, differences.subspan(block, num_lanes), lanes);
     }
 
     return denominators;
@@ -202,23 +212,53 @@ void BatchedAffineAddition<Curve>::batched_affine_add_in_place(AdditionSequences
 
     auto points = add_sequences.points;
     auto sequence_counts = add_sequences.sequence_counts;
-
-    // Compute pairwise in-place additions for all sequences with more than 1 point
+    const size_t num_pairs_total = denominators.size();
+    std::span<Fq> scratch = add_sequences.scratch_space.subspan(num_pairs_total, num_pairs_total);
+
+    // Apply f(pair_idx, point_1, point_2) to every pair of points in order
+    auto for_each_pair = [&](auto&& f) {
+        size_t point_idx = 0;
+        size_t pair_idx = 0;
+        for (auto& count : sequence_counts) {
+            const auto num_pairs = count >> 1;
+            for (size_t j = 0; j < num_pairs; ++j) {
+                f(pair_idx++, points[point_idx], points[point_idx + 1]);
+                point_idx += 2;
+            }
+            point_idx += (count & 0x01ULL);
+        }
+    };
+
+    // Compute the slopes \lambda = (y2 - y1)/(x2 - x1) and their squares for all pairs
+    for_each_pair([&](size_t pair_idx, const G1& point_1, const G1& point_2) {
+        scratch[pair_idx] = point_2.y - point_1.y;
+    });
+    std::span<Fq> lambdas = denominators;
+    Fq::batch_mul(lambdas, scratch, lambdas);
+    Fq::batch_sqr(lambdas, scratch);
+
+    // Compute x3 = \lambda^2 - x2 - x1, which is stored in place of x2 (not needed anymore), and x1 - x3
+    for_each_pair([&](size_t pair_idx, const G1& point_1, G1& point_2) {
+        point_2.x = scratch[pair_idx] - point_2.x - point_1.x;
+        scratch[pair_idx] = point_1.x - point_2.x;
+    });
+    Fq::batch_mul(lambdas, scratch, scratch);
+
+    // Compute y3 = \lambda*(x1 - x3) - y1 and write the pairwise sums in place, for all sequences with more than 1
+    // point
     size_t point_idx = 0;        // index for points to be summed
     size_t result_point_idx = 0; // index for result points
-    size_t pair_idx = 0;         // index into array of denominators for each pair
+    size_t pair_idx = 0;         // index into arrays of per-pair terms
     bool more_additions = false;
     for (auto& count : sequence_counts) {
         const auto num_pairs = count >> 1;
         const bool overflow = static_cast<bool>(count & 0x01ULL);
-        // Compute the sum of all pairs in the sequence and store the result in the same points array
+        // Store the sum of all pairs in the sequence in the same points array
         for (size_t j = 0; j < num_pairs; ++j) {
-            const auto& point_1 = points[point_idx++];          // first summand
-            const auto& point_2 = points[point_idx++];          // second summand
-            const auto& denominator = denominators[pair_idx++]; // denominator needed in add formula
-            auto& result = points[result_point_idx++];          // target for addition result
-
-            result = affine_add_with_denominator(point_1, point_2, denominator);
+            const Fq y3 = scratch[pair_idx++] - points[point_idx].y;
+            const Fq x3 = points[point_idx + 1].x;
+            point_idx += 2;
+            points[result_point_idx++] = G1(x3, y3); // target for addition result
         }
         // If the sequence had an odd number of points, simply carry the unpaired point over to the next round
         if (overflow) {
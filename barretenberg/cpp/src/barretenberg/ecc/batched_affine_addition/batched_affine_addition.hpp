@@ -25,6 +25,9 @@ template <typename Curve> class BatchedAffineAddition {
     using Fr = typename Curve::ScalarField;
     using Fq = typename Curve::BaseField;
 
+    // Number of interleaved running products in batch_compute_point_addition_slope_inverses
+    static constexpr size_t BATCH_INVERSION_LANES = 8;
+
     // Struct describing a set of points to be reduced to num-sequence-counts-many points via summation of each sequence
     struct AdditionSequences {
         std::vector<size_t> sequence_counts;
@@ -86,6 +89,8 @@ template <typename Curve> class BatchedAffineAddition {
      * @brief Batch compute inverses needed for a set of affine point addition sequences
      * @details Addition of points P_1, P_2 requires computation of a term of the form 1/(P_2.x - P_1.x). For
      * efficiency, these terms are computed all at once for a full set of addition sequences using batch inversion.
+     * The running products of the batch inversion are split into BATCH_INVERSION_LANES interleaved chains, so that
+     * each step is a single batch_mul over independent elements.
      *
      * @tparam Curve
      * @param add_sequences
@@ -94,37 +99,14 @@ template <typename Curve> class BatchedAffineAddition {
 
     /**
      * @brief Internal method for in-place summation of a single set of addition sequences
+     * @details The sum of two points (x1, y1), (x2, y2) is given by x3 = \lambda^2 - x1 - x2, y3 = \lambda*(x1 - x3) -
+     * y1, where \lambda = (y2 - y1)/(x2 - x1). The inverses are batch computed for all pairs of a round and the
+     * multiplications are performed in batch over all pairs as well (see Fq::batch_mul), using the scratch space.
      *
      * @tparam Curve
      * @param addition_sequences Set of points and counts indicating number of points in each addition chain
      */
     static void batched_affine_add_in_place(AdditionSequences add_sequences);
-
-    /**
-     * @brief Add two affine elements with the inverse in the slope term \lambda provided as input
-     * @details The sum of two points (x1, y1), (x2, y2) is given by x3 = \lambda^2 - x1 - x2, y3 = \lambda*(x1 - x3) -
-     * y1, where \lambda  = (y2 - y1)/(x2 - x1). When performing many additions at once, it is more efficient to batch
-     * compute the inverse component of \lambda for each pair of points. This gives rise to the need for a method like
-     * this one.
-     *
-     * @tparam Curve
-     * @param point_1 (x1, y1)
-     * @param point_2 (x2, y2)
-     * @param denominator 1/(x2 - x1)
-     * @return Curve::AffineElement
-     */
-    static inline G1 affine_add_with_denominator(const G1& point_1, const G1& point_2, const Fq& denominator)
-    {
-        const auto& x1 = point_1.x;
-        const auto& y1 = point_1.y;
-        const auto& x2 = point_2.x;
-        const auto& y2 = point_2.y;
-
-        const Fq lambda = denominator * (y2 - y1);
-        Fq x3 = lambda.sqr() - x2 - x1;
-        Fq y3 = lambda * (x1 - x3) - y1;
-        return { x3, y3 };
-    }
 };
 
 } // namespace bb
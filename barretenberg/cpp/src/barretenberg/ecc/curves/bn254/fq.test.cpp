@@ -474,6 +474,54 @@ TEST(fq, SerializeFromBuffer)
     EXPECT_EQ((result == expected), true);
 }
 
+TEST(fq, BatchArithmetic)
+{
+    // Lengths around the 8-lane width of the vectorized backend
+    for (size_t n : std::vector<size_t>{ 0, 1, 7, 8, 9, 37 }) {
+        std::vector<fq> a(n);
+        std::vector<fq> b(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = fq::random_element();
+            b[i] = fq::random_element();
+        }
+        if (n > 2) {
+            a[0] = 0;
+            a[1] = -fq(1);
+            b[1] = -fq(1);
+        }
+        const fq scalar = fq::random_element();
+
+        std::vector<fq> products(n);
+        std::vector<fq> scaled(n);
+        std::vector<fq> squares(n);
+        std::vector<fq> sums(n);
+        std::vector<fq> differences(n);
+        fq::batch_mul(a, b, products);
+        fq::batch_mul(a, scalar, scaled);
+        fq::batch_sqr(a, squares);
+        fq::batch_add(a, b, sums);
+        fq::batch_sub(a, b, differences);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(products[i], a[i] * b[i]);
+            EXPECT_EQ(scaled[i], a[i] * scalar);
+            EXPECT_EQ(squares[i], a[i].sqr());
+            EXPECT_EQ(sums[i], a[i] + b[i]);
+            EXPECT_EQ(differences[i], a[i] - b[i]);
+        }
+
+        // Repeated in-place multiplication, so that the inputs are not fully reduced
+        std::vector<fq> expected = a;
+        std::vector<fq> result = a;
+        for (size_t k = 0; k < 10; ++k) {
+            fq::batch_mul(result, b, result);
+            for (size_t i = 0; i < n; ++i) {
+                expected[i] *= b[i];
+            }
+        }
+        EXPECT_EQ(result, expected);
+    }
+}
+
 TEST(fq, MultiplicativeGenerator)
 {
     EXPECT_EQ(fq::multiplicative_generator(), fq(3));
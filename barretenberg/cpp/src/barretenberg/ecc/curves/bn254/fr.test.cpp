@@ -361,6 +361,54 @@ TEST(fr, BatchInvert)
     }
 }
 
+TEST(fr, BatchArithmetic)
+{
+    // Lengths around the 8-lane width of the vectorized backend
+    for (size_t n : std::vector<size_t>{ 0, 1, 7, 8, 9, 37 }) {
+        std::vector<fr> a(n);
+        std::vector<fr> b(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = fr::random_element();
+            b[i] = fr::random_element();
+        }
+        if (n > 2) {
+            a[0] = 0;
+            a[1] = -fr(1);
+            b[1] = -fr(1);
+        }
+        const fr scalar = fr::random_element();
+
+        std::vector<fr> products(n);
+        std::vector<fr> scaled(n);
+        std::vector<fr> squares(n);
+        std::vector<fr> sums(n);
+        std::vector<fr> differences(n);
+        fr::batch_mul(a, b, products);
+        fr::batch_mul(a, scalar, scaled);
+        fr::batch_sqr(a, squares);
+        fr::batch_add(a, b, sums);
+        fr::batch_sub(a, b, differences);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(products[i], a[i] * b[i]);
+            EXPECT_EQ(scaled[i], a[i] * scalar);
+            EXPECT_EQ(squares[i], a[i].sqr());
+            EXPECT_EQ(sums[i], a[i] + b[i]);
+            EXPECT_EQ(differences[i], a[i] - b[i]);
+        }
+
+        // Repeated in-place multiplication, so that the inputs are not fully reduced
+        std::vector<fr> expected = a;
+        std::vector<fr> result = a;
+        for (size_t k = 0; k < 10; ++k) {
+            fr::batch_mul(result, b, result);
+            for (size_t i = 0; i < n; ++i) {
+                expected[i] *= b[i];
+            }
+        }
+        EXPECT_EQ(result, expected);
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
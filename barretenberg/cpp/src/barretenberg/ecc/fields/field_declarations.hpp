@@ -338,6 +338,17 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    /**
+     * @brief Element-wise arithmetic over spans: result[i] = a[i] op b[i]. result may alias a or b.
+     * @details batch_mul and batch_sqr use an 8-lane AVX-512 IFMA kernel when the cpu supports it (see
+     * field_impl_batch.hpp), otherwise they fall back to the scalar operators.
+     */
+    static void batch_mul(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept;
+    static void batch_mul(std::span<const field> a, const field& b, std::span<field> result) noexcept;
+    static void batch_sqr(std::span<const field> a, std::span<field> result) noexcept;
+    static void batch_add(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept;
+    static void batch_sub(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept;
+    static bool has_vectorized_batch_mul() noexcept;
     /**
      * @brief Compute square root of the field element.
      *
@@ -0,0 +1,324 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "./field_impl.hpp"
+
+#if defined(__x86_64__) && !defined(__wasm__) && !defined(DISABLE_IFMA)
+#define BB_FIELD_IFMA_BACKEND 1
+#include <immintrin.h>
+#else
+#define BB_FIELD_IFMA_BACKEND 0
+#endif
+
+/**
+ * @details Batch (element-wise, over spans) field arithmetic.
+ *
+ * On CPUs with AVX-512 IFMA, batch_mul and batch_sqr multiply 8 independent elements at a time. Every element is
+ * split into five 52-bit limbs, one 512-bit register holds the same limb of 8 elements, and the 52x52-bit products
+ * are accumulated with vpmadd52{l,h}uq. The Montgomery reduction uses four 52-bit rounds and one 48-bit round, so it
+ * divides by exactly R = 2^256 and the results are in the usual Montgomery form. Like the scalar asm multiplication,
+ * inputs and outputs are coarsely reduced (in [0, 2p)), which needs 4p < 2^256. The backend is thus only used for
+ * fields with moduli below 2^254 (e.g. the BN254 fields) and is selected at runtime via CPUID, with the scalar
+ * operators as fallback. batch_add and batch_sub are memory bound and always use the scalar operators.
+ */
+namespace bb {
+
+#if BB_FIELD_IFMA_BACKEND
+namespace field_ifma {
+
+#define BB_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+inline bool is_supported() noexcept
+{
+    static const bool supported = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    }();
+    return supported;
+}
+
+constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+
+// Shifts via vector extensions: GCC 12 reports -Wuninitialized inside _mm512_s{l,r}li_epi64.
+using u64x8 = uint64_t __attribute__((vector_size(64)));
+
+BB_IFMA_TARGET inline __m512i shift_right(__m512i x, int shift) noexcept
+{
+    return reinterpret_cast<__m512i>(reinterpret_cast<u64x8>(x) >> shift);
+}
+
+BB_IFMA_TARGET inline __m512i shift_left(__m512i x, int shift) noexcept
+{
+    return reinterpret_cast<__m512i>(reinterpret_cast<u64x8>(x) << shift);
+}
+
+/**
+ * @brief Loads 8 consecutive field elements and transposes them to 4 vectors of 64-bit limbs.
+ */
+BB_IFMA_TARGET inline void load_transposed(const uint64_t* data, __m512i (&limbs)[4]) noexcept
+{
+    // Each register holds two elements: [e0.0, e0.1, e0.2, e0.3, e1.0, e1.1, e1.2, e1.3]
+    const __m512i v0 = _mm512_loadu_si512(data);
+    const __m512i v1 = _mm512_loadu_si512(data + 8);
+    const __m512i v2 = _mm512_loadu_si512(data + 16);
+    const __m512i v3 = _mm512_loadu_si512(data + 24);
+    // [e0.0, e1.0, e2.0, e3.0, e0.1, e1.1, e2.1, e3.1] and the same for limbs 2, 3 and elements 4-7
+    const __m512i even = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i odd = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i t0 = _mm512_permutex2var_epi64(v0, even, v1);
+    const __m512i t1 = _mm512_permutex2var_epi64(v0, odd, v1);
+    const __m512i u0 = _mm512_permutex2var_epi64(v2, even, v3);
+    const __m512i u1 = _mm512_permutex2var_epi64(v2, odd, v3);
+    const __m512i low = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i high = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    limbs[0] = _mm512_permutex2var_epi64(t0, low, u0);
+    limbs[1] = _mm512_permutex2var_epi64(t0, high, u0);
+    limbs[2] = _mm512_permutex2var_epi64(t1, low, u1);
+    limbs[3] = _mm512_permutex2var_epi64(t1, high, u1);
+}
+
+/**
+ * @brief Inverse of load_transposed.
+ */
+BB_IFMA_TARGET inline void store_transposed(uint64_t* data, const __m512i (&limbs)[4]) noexcept
+{
+    // [e0.0, e0.1, e1.0, e1.1, e2.0, e2.1, e3.0, e3.1] and the same for limbs 2, 3 and elements 4-7
+    const __m512i interleave_low = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+    const __m512i interleave_high = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+    const __m512i a = _mm512_permutex2var_epi64(limbs[0], interleave_low, limbs[1]);
+    const __m512i b = _mm512_permutex2var_epi64(limbs[0], interleave_high, limbs[1]);
+    const __m512i c = _mm512_permutex2var_epi64(limbs[2], interleave_low, limbs[3]);
+    const __m512i d = _mm512_permutex2var_epi64(limbs[2], interleave_high, limbs[3]);
+    const __m512i first = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+    const __m512i second = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+    _mm512_storeu_si512(data, _mm512_permutex2var_epi64(a, first, c));
+    _mm512_storeu_si512(data + 8, _mm512_permutex2var_epi64(a, second, c));
+    _mm512_storeu_si512(data + 16, _mm512_permutex2var_epi64(b, first, d));
+    _mm512_storeu_si512(data + 24, _mm512_permutex2var_epi64(b, second, d));
+}
+
+BB_IFMA_TARGET inline void to_radix_52(const __m512i (&x)[4], __m512i (&l)[5]) noexcept
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    l[0] = _mm512_and_si512(x[0], mask);
+    l[1] = _mm512_and_si512(_mm512_or_si512(shift_right(x[0], 52), shift_left(x[1], 12)), mask);
+    l[2] = _mm512_and_si512(_mm512_or_si512(shift_right(x[1], 40), shift_left(x[2], 24)), mask);
+    l[3] = _mm512_and_si512(_mm512_or_si512(shift_right(x[2], 28), shift_left(x[3], 36)), mask);
+    l[4] = shift_right(x[3], 16);
+}
+
+BB_IFMA_TARGET inline void from_radix_52(const __m512i (&l)[5], __m512i (&x)[4]) noexcept
+{
+    x[0] = _mm512_or_si512(l[0], shift_left(l[1], 52));
+    x[1] = _mm512_or_si512(shift_right(l[1], 12), shift_left(l[2], 40));
+    x[2] = _mm512_or_si512(shift_right(l[2], 24), shift_left(l[3], 28));
+    x[3] = _mm512_or_si512(shift_right(l[3], 36), shift_left(l[4], 16));
+}
+
+/**
+ * @brief Splits a scalar into 52-bit limbs and broadcasts them.
+ */
+BB_IFMA_TARGET inline void broadcast_radix_52(const uint64_t* x, __m512i (&l)[5]) noexcept
+{
+    l[0] = _mm512_set1_epi64(static_cast<int64_t>(x[0] & LIMB_MASK));
+    l[1] = _mm512_set1_epi64(static_cast<int64_t>(((x[0] >> 52) | (x[1] << 12)) & LIMB_MASK));
+    l[2] = _mm512_set1_epi64(static_cast<int64_t>(((x[1] >> 40) | (x[2] << 24)) & LIMB_MASK));
+    l[3] = _mm512_set1_epi64(static_cast<int64_t>(((x[2] >> 28) | (x[3] << 36)) & LIMB_MASK));
+    l[4] = _mm512_set1_epi64(static_cast<int64_t>(x[3] >> 16));
+}
+
+/**
+ * @brief r = a * b / 2^256 mod p, for 8 pairs of elements in radix 2^52.
+ * @details The 10-limb product is computed first, then reduced limb by limb: round k adds m_k * p * 2^{52k} with m_k
+ * chosen to clear the low bits of limb k. The accumulators are 64 bits wide, so carries are only propagated when a
+ * limb is about to be cleared (and once at the end).
+ */
+template <class T>
+BB_IFMA_TARGET inline void montgomery_mul(const __m512i (&a)[5], const __m512i (&b)[5], __m512i (&r)[5]) noexcept
+{
+    constexpr uint64_t p[4] = { T::modulus_0, T::modulus_1, T::modulus_2, T::modulus_3 };
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    const __m512i r_inv = _mm512_set1_epi64(static_cast<int64_t>(T::r_inv & LIMB_MASK));
+    __m512i modulus[5];
+    broadcast_radix_52(p, modulus);
+
+    __m512i t[10];
+    for (auto& limb : t) {
+        limb = _mm512_setzero_si512();
+    }
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            t[i + j] = _mm512_madd52lo_epu64(t[i + j], a[i], b[j]);
+            t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a[i], b[j]);
+        }
+    }
+    for (size_t k = 0; k < 5; ++k) {
+        if (k > 0) {
+            t[k] = _mm512_add_epi64(t[k], shift_right(t[k - 1], 52));
+        }
+        __m512i m = _mm512_madd52lo_epu64(_mm512_setzero_si512(), t[k], r_inv);
+        if (k == 4) {
+            // The last round only clears 48 bits, for a total of 4 * 52 + 48 = 256
+            m = _mm512_and_si512(m, _mm512_set1_epi64((1LL << 48) - 1));
+        }
+        for (size_t j = 0; j < 5; ++j) {
+            t[k + j] = _mm512_madd52lo_epu64(t[k + j], m, modulus[j]);
+            t[k + j + 1] = _mm512_madd52hi_epu64(t[k + j + 1], m, modulus[j]);
+        }
+    }
+    for (size_t j = 4; j < 9; ++j) {
+        t[j + 1] = _mm512_add_epi64(t[j + 1], shift_right(t[j], 52));
+        t[j] = _mm512_and_si512(t[j], mask);
+    }
+    // r = t / 2^256, i.e. the limbs from bit 48 of t[4] onwards
+    for (size_t j = 0; j < 4; ++j) {
+        r[j] = _mm512_or_si512(shift_right(t[j + 4], 48),
+                               _mm512_and_si512(shift_left(t[j + 5], 4), mask));
+    }
+    r[4] = _mm512_or_si512(shift_right(t[8], 48), shift_left(t[9], 4));
+}
+
+/**
+ * @brief result[i] = a[i] * b[i] for the largest multiple of 8 elements. Returns the number of elements processed.
+ */
+template <class T>
+BB_IFMA_TARGET size_t batch_mul(const uint64_t* a, const uint64_t* b, uint64_t* result, size_t n) noexcept
+{
+    const size_t num_vectorized = n - (n % 8);
+    for (size_t i = 0; i < num_vectorized; i += 8) {
+        __m512i x[4];
+        __m512i a_limbs[5];
+        __m512i b_limbs[5];
+        __m512i r_limbs[5];
+        load_transposed(a + 4 * i, x);
+        to_radix_52(x, a_limbs);
+        load_transposed(b + 4 * i, x);
+        to_radix_52(x, b_limbs);
+        montgomery_mul<T>(a_limbs, b_limbs, r_limbs);
+        from_radix_52(r_limbs, x);
+        store_transposed(result + 4 * i, x);
+    }
+    return num_vectorized;
+}
+
+template <class T>
+BB_IFMA_TARGET size_t batch_mul_scalar(const uint64_t* a, const uint64_t* b, uint64_t* result, size_t n) noexcept
+{
+    const size_t num_vectorized = n - (n % 8);
+    __m512i b_limbs[5];
+    broadcast_radix_52(b, b_limbs);
+    for (size_t i = 0; i < num_vectorized; i += 8) {
+        __m512i x[4];
+        __m512i a_limbs[5];
+        __m512i r_limbs[5];
+        load_transposed(a + 4 * i, x);
+        to_radix_52(x, a_limbs);
+        montgomery_mul<T>(a_limbs, b_limbs, r_limbs);
+        from_radix_52(r_limbs, x);
+        store_transposed(result + 4 * i, x);
+    }
+    return num_vectorized;
+}
+
+template <class T> BB_IFMA_TARGET size_t batch_sqr(const uint64_t* a, uint64_t* result, size_t n) noexcept
+{
+    const size_t num_vectorized = n - (n % 8);
+    for (size_t i = 0; i < num_vectorized; i += 8) {
+        __m512i x[4];
+        __m512i a_limbs[5];
+        __m512i r_limbs[5];
+        load_transposed(a + 4 * i, x);
+        to_radix_52(x, a_limbs);
+        montgomery_mul<T>(a_limbs, a_limbs, r_limbs);
+        from_radix_52(r_limbs, x);
+        store_transposed(result + 4 * i, x);
+    }
+    return num_vectorized;
+}
+
+#undef BB_IFMA_TARGET
+
+} // namespace field_ifma
+#endif
+
+template <class T> bool field<T>::has_vectorized_batch_mul() noexcept
+{
+#if BB_FIELD_IFMA_BACKEND
+    if constexpr (T::modulus_3 < 0x4000000000000000ULL) {
+        return field_ifma::is_supported();
+    }
+#endif
+    return false;
+}
+
+template <class T>
+void field<T>::batch_mul(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept
+{
+    BB_ASSERT_EQ(a.size(), b.size());
+    BB_ASSERT_EQ(a.size(), result.size());
+    size_t start = 0;
+#if BB_FIELD_IFMA_BACKEND
+    if (has_vectorized_batch_mul()) {
+        start = field_ifma::batch_mul<T>(a.data()->data, b.data()->data, result.data()->data, a.size());
+    }
+#endif
+    for (size_t i = start; i < a.size(); ++i) {
+        result[i] = a[i] * b[i];
+    }
+}
+
+template <class T>
+void field<T>::batch_mul(std::span<const field> a, const field& b, std::span<field> result) noexcept
+{
+    BB_ASSERT_EQ(a.size(), result.size());
+    size_t start = 0;
+#if BB_FIELD_IFMA_BACKEND
+    if (has_vectorized_batch_mul()) {
+        start = field_ifma::batch_mul_scalar<T>(a.data()->data, b.data, result.data()->data, a.size());
+    }
+#endif
+    for (size_t i = start; i < a.size(); ++i) {
+        result[i] = a[i] * b;
+    }
+}
+
+template <class T> void field<T>::batch_sqr(std::span<const field> a, std::span<field> result) noexcept
+{
+    BB_ASSERT_EQ(a.size(), result.size());
+    size_t start = 0;
+#if BB_FIELD_IFMA_BACKEND
+    if (has_vectorized_batch_mul()) {
+        start = field_ifma::batch_sqr<T>(a.data()->data, result.data()->data, a.size());
+    }
+#endif
+    for (size_t i = start; i < a.size(); ++i) {
+        result[i] = a[i].sqr();
+    }
+}
+
+template <class T>
+void field<T>::batch_add(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept
+{
+    BB_ASSERT_EQ(a.size(), b.size());
+    BB_ASSERT_EQ(a.size(), result.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        result[i] = a[i] + b[i];
+    }
+}
+
+template <class T>
+void field<T>::batch_sub(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept
+{
+    BB_ASSERT_EQ(a.size(), b.size());
+    BB_ASSERT_EQ(a.size(), result.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        result[i] = a[i] - b[i];
+    }
+}
+
+} // namespace bb
@@ -0,0 +1,265 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "fixed_base_msm.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+// Below this, splitting the per-round work across threads costs more than it saves.
+constexpr size_t MIN_SCALARS_PER_THREAD = 1 << 10;
+constexpr size_t MIN_BUCKETS_PER_THREAD = 1 << 8;
+// Rough relative costs, in units of a batched affine addition, used to pick the window width.
+constexpr size_t MIXED_ADDITION_COST = 2;
+constexpr size_t DOUBLING_COST = 2;
+} // namespace
+
+template <typename Curve>
+FixedBaseMSM<Curve>::FixedBaseMSM(std::span<const AffineElement> bases,
+                                  size_t precompute_factor,
+                                  size_t window_bits,
+                                  size_t base_stride)
+    : num_bases_(bases.size() / base_stride)
+{
+    PROFILE_THIS_NAME("FixedBaseMSM::precompute");
+    BB_ASSERT_GTE(precompute_factor, 1UL);
+    window_bits_ = window_bits == 0 ? get_optimal_window_bits(num_bases_, precompute_factor) : window_bits;
+    BB_ASSERT_GTE(window_bits_, MIN_WINDOW_BITS);
+    BB_ASSERT_LTE(window_bits_, MAX_WINDOW_BITS);
+    num_windows_ = get_num_windows(window_bits_);
+    precompute_factor_ = std::min(precompute_factor, num_windows_);
+    num_rounds_ = (num_windows_ + precompute_factor_ - 1) / precompute_factor_;
+    table_.resize(num_bases_ * precompute_factor_);
+
+    // Consecutive multiples of a base are 2^{cR} apart. Normalize per chunk to amortize the inversion.
+    const size_t shift = window_bits_ * num_rounds_;
+    parallel_for_range(num_bases_, [&](size_t start, size_t end) {
+        std::vector<Element> multiples((end - start) * precompute_factor_);
+        for (size_t i = start; i < end; ++i) {
+            Element multiple = bases[i * base_stride];
+            for (size_t t = 0; t < precompute_factor_; ++t) {
+                multiples[(i - start) * precompute_factor_ + t] = multiple;
+                for (size_t k = 0; k < shift && t + 1 < precompute_factor_; ++k) {
+                    multiple.self_dbl();
+                }
+            }
+        }
+        Element::batch_normalize(multiples.data(), multiples.size());
+        for (size_t j = 0; j < multiples.size(); ++j) {
+            table_[start * precompute_factor_ + j] = AffineElement(multiples[j]);
+        }
+    });
+}
+
+template <typename Curve>
+size_t FixedBaseMSM<Curve>::get_optimal_window_bits(size_t num_bases, size_t precompute_factor)
+{
+    size_t best_window_bits = MIN_WINDOW_BITS;
+    size_t best_cost = std::numeric_limits<size_t>::max();
+    for (size_t c = MIN_WINDOW_BITS; c <= MAX_WINDOW_BITS; ++c) {
+        const size_t num_windows = get_num_windows(c);
+        const size_t factor = std::min(precompute_factor, num_windows);
+        const size_t num_rounds = (num_windows + factor - 1) / factor;
+        // Every nonzero digit is one bucket addition; every round reduces 2^{c-1} buckets with two mixed additions and
+        // is followed by c doublings.
+        const size_t cost =
+            num_bases * num_windows + num_rounds * ((size_t(1) << c) * MIXED_ADDITION_COST + c * DOUBLING_COST);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_window_bits = c;
+        }
+    }
+    return best_window_bits;
+}
+
+template <typename Curve>
+size_t FixedBaseMSM<Curve>::get_memory_bytes(size_t num_bases, size_t precompute_factor, size_t window_bits)
+{
+    const size_t num_windows = get_num_windows(window_bits);
+    const size_t factor = std::min(precompute_factor, num_windows);
+    const size_t num_buckets = size_t(1) << (window_bits - 1);
+    // The table, the per-round bucket points and their addition scratch space, the signed digits and the buckets
+    return num_bases * factor * (2 * sizeof(AffineElement) + sizeof(BaseField)) +
+           num_bases * num_windows * sizeof(int32_t) + num_buckets * (sizeof(AffineElement) + sizeof(size_t));
+}
+
+template <typename Curve> size_t FixedBaseMSM<Curve>::get_max_precompute_factor(size_t num_bases, size_t memory_budget)
+{
+    size_t best_factor = 0;
+    for (size_t factor = 1; factor <= get_num_windows(MIN_WINDOW_BITS); ++factor) {
+        const size_t window_bits = get_optimal_window_bits(num_bases, factor);
+        if (factor > get_num_windows(window_bits)) {
+            break;
+        }
+        if (get_memory_bytes(num_bases, factor, window_bits) > memory_budget) {
+            break;
+        }
+        best_factor = factor;
+    }
+    return best_factor;
+}
+
+/**
+ * @brief Recodes every scalar into num_windows_ signed digits in [-2^{c-1}, 2^{c-1}], stored scalar-major.
+ * @details A window value above 2^{c-1} is replaced by value - 2^c, carrying one into the next window. The top window
+ * covers fewer than c bits of the (reduced) scalar, so it can absorb the final carry without becoming negative.
+ */
+template <typename Curve>
+std::vector<int32_t> FixedBaseMSM<Curve>::compute_signed_digits(std::span<const ScalarField> scalars) const
+{
+    std::vector<int32_t> digits(scalars.size() * num_windows_);
+    const uint64_t window_bits = window_bits_;
+    const int64_t half_radix = int64_t(1) << (window_bits - 1);
+    parallel_for_range(scalars.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            uint256_t value = static_cast<uint256_t>(scalars[i]);
+            if (value >= ScalarField::modulus) {
+                value -= ScalarField::modulus;
+            }
+            int64_t carry = 0;
+            for (size_t j = 0; j < num_windows_; ++j) {
+                int64_t digit = static_cast<int64_t>(value.slice(j * window_bits, (j + 1) * window_bits).data[0]);
+                digit += carry;
+                carry = digit > half_radix ? 1 : 0;
+                digit -= carry << window_bits;
+                digits[i * num_windows_ + j] = static_cast<int32_t>(digit);
+            }
+        }
+    });
+    return digits;
+}
+
+/**
+ * @brief Computes Σ_{i,t} d_{i, tR + round} (2^{cRt} G_i) for the given round.
+ */
+template <typename Curve>
+typename Curve::Element FixedBaseMSM<Curve>::evaluate_round(size_t round,
+                                                            size_t start_index,
+                                                            std::span<const int32_t> digits,
+                                                            std::vector<AffineElement>& bucket_points) const
+{
+    const size_t num_scalars = digits.size() / num_windows_;
+    const size_t num_buckets = size_t(1) << (window_bits_ - 1);
+    // The multiples of a base that have a window in this round
+    const size_t num_multiples = std::min(precompute_factor_, (num_windows_ - round + num_rounds_ - 1) / num_rounds_);
+    auto get_digit = [&](size_t i, size_t t) { return digits[i * num_windows_ + t * num_rounds_ + round]; };
+    auto get_bucket = [](int32_t digit) { return static_cast<size_t>(digit > 0 ? digit : -digit) - 1; };
+
+    // Counting sort of the signed points by bucket. Every thread counts its slice of the scalars, so that it can then
+    // scatter its points into its own disjoint ranges of the buckets.
+    const MultithreadData thread_data = calculate_thread_data(num_scalars, MIN_SCALARS_PER_THREAD);
+    const size_t num_threads = thread_data.num_threads;
+    std::vector<std::vector<size_t>> offsets(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        auto& counts = offsets[thread_idx];
+        counts.assign(num_buckets, 0);
+        for (size_t i = thread_data.start[thread_idx]; i < thread_data.end[thread_idx]; ++i) {
+            for (size_t t = 0; t < num_multiples; ++t) {
+                if (const int32_t digit = get_digit(i, t); digit != 0) {
+                    counts[get_bucket(digit)]++;
+                }
+            }
+        }
+    });
+    std::vector<size_t> bucket_counts(num_buckets, 0);
+    size_t num_points = 0;
+    for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        for (auto& thread_offsets : offsets) {
+            const size_t count = thread_offsets[bucket];
+            thread_offsets[bucket] = num_points;
+            num_points += count;
+            bucket_counts[bucket] += count;
+        }
+    }
+    if (num_points == 0) {
+        return Element::infinity();
+    }
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        auto& thread_offsets = offsets[thread_idx];
+        for (size_t i = thread_data.start[thread_idx]; i < thread_data.end[thread_idx]; ++i) {
+            const AffineElement* multiples = &table_[(start_index + i) * precompute_factor_];
+            for (size_t t = 0; t < num_multiples; ++t) {
+                if (const int32_t digit = get_digit(i, t); digit != 0) {
+                    bucket_points[thread_offsets[get_bucket(digit)]++] = digit > 0 ? multiples[t] : -multiples[t];
+                }
+            }
+        }
+    });
+
+    // Sum every nonempty bucket with batched affine additions.
+    std::vector<size_t> sequence_counts;
+    for (const size_t count : bucket_counts) {
+        if (count != 0) {
+            sequence_counts.emplace_back(count);
+        }
+    }
+    std::vector<AffineElement> bucket_sums = BatchedAffineAddition<Curve>::add_in_place(
+        std::span<AffineElement>(bucket_points.data(), num_points), sequence_counts);
+
+    // Σ_b (b + 1) * S_b with running sums. Every thread reduces a range [lo, hi) of the buckets to
+    // Σ_{b in [lo, hi)} (b - lo + 1) * S_b plus lo times the plain sum of the range.
+    std::vector<size_t> sum_indices(num_buckets);
+    for (size_t bucket = 0, sum_index = 0; bucket < num_buckets; ++bucket) {
+        sum_indices[bucket] = bucket_counts[bucket] != 0 ? sum_index++ : std::numeric_limits<size_t>::max();
+    }
+    const MultithreadData bucket_thread_data = calculate_thread_data(num_buckets, MIN_BUCKETS_PER_THREAD);
+    std::vector<Element> thread_sums(bucket_thread_data.num_threads);
+    parallel_for(bucket_thread_data.num_threads, [&](size_t thread_idx) {
+        const size_t lo = bucket_thread_data.start[thread_idx];
+        const size_t hi = bucket_thread_data.end[thread_idx];
+        Element running_sum = Element::infinity();
+        Element accumulator = Element::infinity();
+        for (size_t bucket = hi; bucket-- > lo;) {
+            if (sum_indices[bucket] != std::numeric_limits<size_t>::max()) {
+                running_sum += bucket_sums[sum_indices[bucket]];
+            }
+            accumulator += running_sum;
+        }
+        if (lo != 0) {
+            accumulator += running_sum * ScalarField(lo);
+        }
+        thread_sums[thread_idx] = accumulator;
+    });
+    Element result = Element::infinity();
+    for (const auto& thread_sum : thread_sums) {
+        result += thread_sum;
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element FixedBaseMSM<Curve>::msm(PolynomialSpan<const ScalarField> scalars) const
+{
+    PROFILE_THIS_NAME("FixedBaseMSM::msm");
+    BB_ASSERT_LTE(scalars.end_index(), num_bases_, "Fixed-base MSM has too few bases for these scalars");
+    if (scalars.size() == 0) {
+        return Element::infinity();
+    }
+    const std::vector<int32_t> digits = compute_signed_digits(scalars.span);
+    std::vector<AffineElement> bucket_points(scalars.size() * precompute_factor_);
+
+    // Horner's rule over the rounds: result = Σ_r 2^{cr} * round_r
+    Element result = Element::infinity();
+    for (size_t round = num_rounds_; round-- > 0;) {
+        if (round != num_rounds_ - 1) {
+            for (size_t k = 0; k < window_bits_; ++k) {
+                result.self_dbl();
+            }
+        }
+        result += evaluate_round(round, scalars.start_index, digits, bucket_points);
+    }
+    return result;
+}
+
+template class FixedBaseMSM<curve::BN254>;
+template class FixedBaseMSM<curve::Grumpkin>;
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,100 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Multi-scalar multiplication over a fixed set of bases (e.g. the SRS) using precomputed multiples of the bases.
+ *
+ * @details Scalars are recoded into W signed digits of `window_bits` = c bits, d_j ∈ [-2^{c-1}, 2^{c-1}], so that
+ * a = Σ_j d_j 2^{cj} and only 2^{c-1} buckets are needed per round. Writing j = t * R + r for R = ⌈W / s⌉ rounds gives
+ *
+ *      Σ_i a_i G_i = Σ_r 2^{cr} Σ_{i,t} d_{i, tR + r} (2^{cRt} G_i),
+ *
+ * so with the s = `precompute_factor` multiples 2^{cRt} G_i (t < s) of every base computed once, an MSM takes R
+ * instead of W bucket rounds (and c(R - 1) instead of c(W - 1) doublings). In every round, the (signed) points are
+ * counting-sorted by bucket and each bucket is summed using batched affine addition. The memory/speed trade-off is set
+ * by s: the table holds s * num_bases affine points and s = W removes all rounds but one.
+ *
+ * Like pippenger_unsafe, bucket accumulation uses incomplete affine addition formulae, so the bases must not have
+ * known relations with each other (which holds for SRS points, but not e.g. for repeated bases).
+ */
+template <typename Curve> class FixedBaseMSM {
+  public:
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using ScalarField = typename Curve::ScalarField;
+    using BaseField = typename Curve::BaseField;
+
+    static constexpr size_t NUM_SCALAR_BITS = ScalarField::modulus.get_msb() + 1;
+    static constexpr size_t MIN_WINDOW_BITS = 2;
+    static constexpr size_t MAX_WINDOW_BITS = 20;
+
+    /**
+     * @brief Precomputes the table of multiples of the bases.
+     *
+     * @param bases the fixed bases G_i, read with a stride of `base_stride` (2 for a pippenger point table, whose odd
+     * entries hold the endomorphism points)
+     * @param precompute_factor the number of multiples s stored per base, clamped to the number of windows
+     * @param window_bits the digit width c, or 0 to choose the cheapest one for the number of bases and s
+     */
+    FixedBaseMSM(std::span<const AffineElement> bases,
+                 size_t precompute_factor,
+                 size_t window_bits = 0,
+                 size_t base_stride = 1);
+
+    /**
+     * @brief Computes Σ_i scalars[i] * G_i, with scalars.start_index offsetting into the bases.
+     * @details Safe to call concurrently, the table is only read.
+     */
+    Element msm(PolynomialSpan<const ScalarField> scalars) const;
+
+    size_t num_bases() const { return num_bases_; }
+    size_t window_bits() const { return window_bits_; }
+    size_t precompute_factor() const { return precompute_factor_; }
+    size_t num_rounds() const { return num_rounds_; }
+
+    static size_t get_num_windows(size_t window_bits) { return NUM_SCALAR_BITS / window_bits + 1; }
+    static size_t get_optimal_window_bits(size_t num_bases, size_t precompute_factor);
+    /**
+     * @brief Peak memory of the table plus the buffers of one msm() call over all bases.
+     */
+    static size_t get_memory_bytes(size_t num_bases, size_t precompute_factor, size_t window_bits);
+    /**
+     * @brief The largest useful precompute factor whose memory fits into `memory_budget`, or 0 if none does.
+     */
+    static size_t get_max_precompute_factor(size_t num_bases, size_t memory_budget);
+
+  private:
+    size_t num_bases_;
+    size_t window_bits_;
+    size_t num_windows_;
+    size_t precompute_factor_;
+    size_t num_rounds_;
+    // table_[i * precompute_factor_ + t] = 2^{window_bits_ * num_rounds_ * t} * G_i
+    std::vector<AffineElement> table_;
+
+    std::vector<int32_t> compute_signed_digits(std::span<const ScalarField> scalars) const;
+    Element evaluate_round(size_t round,
+                           size_t start_index,
+                           std::span<const int32_t> digits,
+                           std::vector<AffineElement>& bucket_points) const;
+};
+
+extern template class FixedBaseMSM<curve::BN254>;
+extern template class FixedBaseMSM<curve::Grumpkin>;
+
+} // namespace bb::scalar_multiplication
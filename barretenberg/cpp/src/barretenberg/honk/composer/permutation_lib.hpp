@@ -22,10 +22,14 @@
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <numeric>
+#include <span>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -124,7 +128,173 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a trace: for each (real) variable, the wire positions that hold it, in trace order.
+ * @details The cycles are stored back to back in a single array, bucketed by variable, rather than as a vector per
+ * variable: this avoids millions of small allocations and lets the cycles be built in parallel.
+ */
+struct CopyCycles {
+    std::vector<size_t> offsets;   // the nodes of cycle i are nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1]
+    std::vector<cycle_node> nodes; // all the nodes, grouped by cycle
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    std::span<const cycle_node> operator[](size_t cycle_idx) const
+    {
+        return { nodes.data() + offsets[cycle_idx], nodes.data() + offsets[cycle_idx + 1] };
+    }
+};
+
+/**
+ * @brief Construct the copy cycles of the trace of a circuit, in parallel
+ * @details Bucket sort of the wire positions by real variable index: the size of each bucket is counted, then every
+ * position is written to its bucket. Both passes run over chunks of rows in parallel. The nodes of a cycle must end up
+ * in trace order, i.e. by row and then by column, which is the order in which a serial pass over the blocks (laid out
+ * one after the other) would find them, and also the order of the chunks.
+ *
+ * On a single thread the chunks are processed in order, so every node can simply be written to the next free slot of
+ * its cycle. Otherwise, large cycles (e.g. the one of the zero variable, which holds the unused wires) are placed
+ * deterministically: their nodes are also counted per chunk, so that every chunk writes its nodes, in order, to a
+ * range of the cycle that starts after the nodes of the previous chunks. Per chunk counts for every cycle would take
+ * too much memory, so the other cycles claim their slots with an atomic counter and are sorted afterwards. Since they
+ * are small, sorting them is cheap and balances well over the threads.
+ *
+ * @param builder
+ * @param block_offsets The offset of each block of builder.blocks.get() in the trace
+ */
+template <typename Builder>
+CopyCycles construct_copy_cycles(const Builder& builder, std::span<const uint32_t> block_offsets)
+{
+    PROFILE_THIS_NAME("construct_copy_cycles");
+
+    constexpr uint32_t NUM_WIRES = Builder::NUM_WIRES;
+    constexpr uint32_t ROWS_PER_CHUNK = 1 << 12;
+    // Bounds the memory of the per chunk counts of the large cycles
+    constexpr size_t MAX_NUM_LARGE_CYCLES = 256;
+
+    // Split the rows of the blocks into chunks that are processed in parallel
+    struct Chunk {
+        size_t block_idx;
+        uint32_t start;
+        uint32_t end;
+    };
+    const auto blocks = builder.blocks.get();
+    std::vector<Chunk> chunks;
+    for (size_t block_idx = 0; block_idx < blocks.size(); ++block_idx) {
+        const auto block_size = static_cast<uint32_t>(blocks[block_idx].size());
+        for (uint32_t start = 0; start < block_size; start += ROWS_PER_CHUNK) {
+            chunks.push_back({ block_idx, start, std::min(start + ROWS_PER_CHUNK, block_size) });
+        }
+    }
+    // Calls func(chunk index, real variable index, node) for every wire position of the chunk, in trace order
+    const auto for_each_chunk_node = [&](size_t chunk_idx, const auto& func) {
+        const auto& [block_idx, start, end] = chunks[chunk_idx];
+        const auto& block = blocks[block_idx];
+        for (uint32_t row_idx = start; row_idx < end; ++row_idx) {
+            for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                const uint32_t var_idx = block.wires[wire_idx][row_idx];
+                const uint32_t trace_row_idx = row_idx + block_offsets[block_idx];
+                func(chunk_idx, builder.real_variable_index[var_idx], cycle_node{ wire_idx, trace_row_idx });
+            }
+        }
+    };
+    const auto for_each_node = [&](const auto& func) {
+        parallel_for(chunks.size(), [&](size_t chunk_idx) { for_each_chunk_node(chunk_idx, func); });
+    };
+
+    CopyCycles cycles;
+    cycles.offsets.assign(builder.variables.size() + 1, 0);
+
+    if (get_num_cpus() == 1) {
+        // Count the nodes of each cycle, then turn the counts into offsets
+        for (size_t chunk_idx = 0; chunk_idx < chunks.size(); ++chunk_idx) {
+            for_each_chunk_node(chunk_idx, [&](size_t, uint32_t cycle_idx, cycle_node) {
+                cycles.offsets[cycle_idx + 1]++;
+            });
+        }
+        std::partial_sum(cycles.offsets.begin(), cycles.offsets.end(), cycles.offsets.begin());
+        cycles.nodes.resize(cycles.offsets.back());
+
+        std::vector<size_t> next_free(cycles.offsets.begin(), cycles.offsets.end() - 1);
+        for (size_t chunk_idx = 0; chunk_idx < chunks.size(); ++chunk_idx) {
+            for_each_chunk_node(chunk_idx, [&](size_t, uint32_t cycle_idx, cycle_node node) {
+                cycles.nodes[next_free[cycle_idx]++] = node;
+            });
+        }
+        return cycles;
+    }
+
+    // Count the nodes of each cycle, then turn the counts into offsets
+    for_each_node([&](size_t, uint32_t cycle_idx, cycle_node) {
+        std::atomic_ref(cycles.offsets[cycle_idx + 1]).fetch_add(1, std::memory_order_relaxed);
+    });
+    std::partial_sum(cycles.offsets.begin(), cycles.offsets.end(), cycles.offsets.begin());
+    cycles.nodes.resize(cycles.offsets.back());
+
+    // The large cycles, by index. For them, next_free holds LARGE_CYCLE | their position in this list instead of a
+    // slot, so that writing a node only needs to look its cycle up once.
+    constexpr size_t LARGE_CYCLE = size_t(1) << (sizeof(size_t) * 8 - 1);
+    const size_t large_cycle_size = std::max<size_t>(ROWS_PER_CHUNK, cycles.nodes.size() / MAX_NUM_LARGE_CYCLES);
+    const auto is_large = [&](size_t cycle_idx) {
+        return cycles.offsets[cycle_idx + 1] - cycles.offsets[cycle_idx] >= large_cycle_size;
+    };
+    std::vector<size_t> next_free(cycles.offsets.begin(), cycles.offsets.end() - 1);
+    std::vector<size_t> large_cycles;
+    for (size_t cycle_idx = 0; cycle_idx < cycles.size(); ++cycle_idx) {
+        if (is_large(cycle_idx)) {
+            next_free[cycle_idx] = LARGE_CYCLE | large_cycles.size();
+            large_cycles.push_back(cycle_idx);
+        }
+    }
+
+    // Where each chunk writes its next node of each large cycle: count the nodes per chunk, then take the prefix sum
+    // over the chunks, starting at the offset of the cycle
+    const size_t num_large = large_cycles.size();
+    std::vector<size_t> chunk_next_free(chunks.size() * num_large, 0);
+    if (num_large > 0) {
+        for_each_node([&](size_t chunk_idx, uint32_t cycle_idx, cycle_node) {
+            if (const size_t slot = next_free[cycle_idx]; (slot & LARGE_CYCLE) != 0) {
+                chunk_next_free[chunk_idx * num_large + (slot & ~LARGE_CYCLE)]++;
+            }
+        });
+        parallel_for(num_large, [&](size_t large_idx) {
+            size_t next = cycles.offsets[large_cycles[large_idx]];
+            for (size_t chunk_idx = 0; chunk_idx < chunks.size(); ++chunk_idx) {
+                const size_t count = chunk_next_free[chunk_idx * num_large + large_idx];
+                chunk_next_free[chunk_idx * num_large + large_idx] = next;
+                next += count;
+            }
+        });
+    }
+
+    // Write every node to the next free slot of its cycle
+    for_each_node([&](size_t chunk_idx, uint32_t cycle_idx, cycle_node node) {
+        std::atomic_ref slot(next_free[cycle_idx]);
+        if (const size_t large_slot = slot.load(std::memory_order_relaxed); (large_slot & LARGE_CYCLE) != 0) {
+            cycles.nodes[chunk_next_free[chunk_idx * num_large + (large_slot & ~LARGE_CYCLE)]++] = node;
+        } else {
+            cycles.nodes[slot.fetch_add(1, std::memory_order_relaxed)] = node;
+        }
+    });
+
+    // Restore the trace order within the small cycles
+    parallel_for_range(cycles.size(), [&](size_t start, size_t end) {
+        const auto trace_order = [](const cycle_node& left, const cycle_node& right) {
+            return std::tie(left.gate_idx, left.wire_idx) < std::tie(right.gate_idx, right.wire_idx);
+        };
+        for (size_t cycle_idx = start; cycle_idx < end; ++cycle_idx) {
+            if (is_large(cycle_idx)) {
+                continue;
+            }
+            const auto cycle_begin = cycles.nodes.begin() + static_cast<ptrdiff_t>(cycles.offsets[cycle_idx]);
+            const auto cycle_end = cycles.nodes.begin() + static_cast<ptrdiff_t>(cycles.offsets[cycle_idx + 1]);
+            if (!std::is_sorted(cycle_begin, cycle_end, trace_order)) {
+                std::sort(cycle_begin, cycle_end, trace_order);
+            }
+        }
+    });
+    return cycles;
+}
 
 namespace {
 /**
@@ -143,7 +313,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    const std::vector<CyclicPermutation>& wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -152,43 +322,46 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Represents the idx of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
-        const CyclicPermutation& cycle = wire_copy_cycles[cycle_idx];
-        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
-            // Get the indices (column, row) of the current node in the cycle
-            const cycle_node& current_node = cycle[node_idx];
-            const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
-            const auto current_column = current_node.wire_idx;
-
-            // Get indices of next node; If the current node is last in the cycle, then the next is the first one
-            size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
-            const cycle_node& next_node = cycle[next_node_idx];
-            const auto next_row = next_node.gate_idx;
-            const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
-
-            // Point current node to the next node
-            mapping.sigmas[current_column].row_idx[current_row] = next_row;
-            mapping.sigmas[current_column].col_idx[current_row] = next_column;
-
-            if constexpr (generalized) {
-                const bool first_node = (node_idx == 0);
-                const bool last_node = (next_node_idx == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column].is_tag[current_row] = true;
-                    mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column].is_tag[current_row] = true;
+    // Go through each cycle. Every position of the trace is in exactly one cycle, so the cycles can be processed in
+    // parallel.
+    parallel_for_range(wire_copy_cycles.size(), [&](size_t start, size_t end) {
+        for (size_t cycle_idx = start; cycle_idx < end; ++cycle_idx) {
+            const std::span<const cycle_node> cycle = wire_copy_cycles[cycle_idx];
+            for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+                // Get the indices (column, row) of the current node in the cycle
+                const cycle_node& current_node = cycle[node_idx];
+                const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
+                const auto current_column = current_node.wire_idx;
+
+                // Get indices of next node; If the current node is last in the cycle, then the next is the first one
+                size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
+                const cycle_node& next_node = cycle[next_node_idx];
+                const auto next_row = next_node.gate_idx;
+                const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
+
+                // Point current node to the next node
+                mapping.sigmas[current_column].row_idx[current_row] = next_row;
+                mapping.sigmas[current_column].col_idx[current_row] = next_column;
+
+                if constexpr (generalized) {
+                    const bool first_node = (node_idx == 0);
+                    const bool last_node = (next_node_idx == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column].is_tag[current_row] = true;
+                        mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
+                    }
+                    if (last_node) {
+                        mapping.sigmas[current_column].is_tag[current_row] = true;
 
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column].row_idx[current_row] =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
+                        // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
+                        mapping.sigmas[current_column].row_idx[current_row] =
+                            circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
+                    }
                 }
             }
         }
-    }
+    });
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -282,7 +455,7 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              const std::vector<CyclicPermutation>& copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraOrMegaHonk<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
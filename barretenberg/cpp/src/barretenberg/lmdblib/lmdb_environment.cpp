@@ -67,6 +67,20 @@ MDB_env* LMDBEnvironment::underlying() const
     return _mdbEnv;
 }
 
+void LMDBEnvironment::set_sync_on_commit(bool syncOnCommit)
+{
+    call_lmdb_func("mdb_env_set_flags",
+                   mdb_env_set_flags,
+                   _mdbEnv,
+                   static_cast<unsigned int>(MDB_NOSYNC),
+                   static_cast<int>(!syncOnCommit));
+}
+
+void LMDBEnvironment::sync()
+{
+    call_lmdb_func("mdb_env_sync", mdb_env_sync, _mdbEnv, 1);
+}
+
 uint64_t LMDBEnvironment::get_map_size() const
 {
     MDB_envinfo info;
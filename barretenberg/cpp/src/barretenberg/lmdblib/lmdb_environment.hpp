@@ -50,6 +50,18 @@ class LMDBEnvironment {
 
     uint64_t get_data_file_size() const;
 
+    /**
+     * @brief Sets whether committing a write transaction flushes it to disk. If not, committed transactions are only
+     * durable once sync() is called; they may be lost on a system crash but the database stays consistent provided the
+     * filesystem preserves the order of writes.
+     */
+    void set_sync_on_commit(bool syncOnCommit);
+
+    /**
+     * @brief Flushes all the committed transactions to disk
+     */
+    void sync();
+
   private:
     std::atomic_uint64_t _id;
     std::string _directory;
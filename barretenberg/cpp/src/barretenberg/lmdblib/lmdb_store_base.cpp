@@ -43,4 +43,14 @@ void LMDBStoreBase::copy_store(const std::string& dstPath, bool compact)
                    static_cast<unsigned int>(compact ? MDB_CP_COMPACT : 0));
 }
 
-} // namespace bb::lmdblib
\ No newline at end of file
+void LMDBStoreBase::set_sync_on_commit(bool syncOnCommit)
+{
+    _environment->set_sync_on_commit(syncOnCommit);
+}
+
+void LMDBStoreBase::sync()
+{
+    _environment->sync();
+}
+
+} // namespace bb::lmdblib
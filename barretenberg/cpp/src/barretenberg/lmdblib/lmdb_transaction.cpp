@@ -27,6 +27,11 @@ uint64_t LMDBTransaction::id() const
     return _id;
 }
 
+uint64_t LMDBTransaction::snapshot_id() const
+{
+    return mdb_txn_id(_transaction);
+}
+
 void LMDBTransaction::abort()
 {
     if (state != TransactionState::OPEN) {
@@ -35,6 +35,12 @@ class LMDBTransaction {
 
     uint64_t id() const;
 
+    /*
+     * The LMDB id of the database snapshot read by the transaction.
+     * For a write transaction, the id of the snapshot it creates when committed.
+     */
+    uint64_t snapshot_id() const;
+
     /*
      * Rolls back the transaction.
      * Must be called by read transactions to signal the end of the transaction.
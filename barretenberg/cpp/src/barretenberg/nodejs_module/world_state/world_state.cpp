@@ -221,6 +221,10 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         WorldStateMessageType::SYNC_BLOCK,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return sync_block(obj, buffer); });
 
+    _dispatcher.register_target(
+        WorldStateMessageType::SYNC_BLOCKS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return sync_blocks(obj, buffer); });
+
     _dispatcher.register_target(
         WorldStateMessageType::CREATE_FORK,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return create_fork(obj, buffer); });
@@ -684,6 +688,30 @@ bool WorldStateWrapper::sync_block(msgpack::object& obj, msgpack::sbuffer& buf)
     return true;
 }
 
+bool WorldStateWrapper::sync_blocks(msgpack::object& obj, msgpack::sbuffer& buf)
+{
+    TypedMessage<SyncBlocksRequest> request;
+    obj.convert(request);
+
+    std::vector<SyncBlockData> blocks;
+    blocks.reserve(request.value.blocks.size());
+    for (auto& block : request.value.blocks) {
+        blocks.push_back({ .blockStateRef = std::move(block.blockStateRef),
+                           .blockHeaderHash = block.blockHeaderHash,
+                           .noteHashes = std::move(block.paddedNoteHashes),
+                           .l1ToL2Messages = std::move(block.paddedL1ToL2Messages),
+                           .nullifiers = std::move(block.paddedNullifiers),
+                           .publicDataWrites = std::move(block.publicDataWrites) });
+    }
+    WorldStateStatusFull status = _ws->sync_blocks(blocks);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<WorldStateStatusFull> resp_msg(WorldStateMessageType::SYNC_BLOCKS, header, { status });
+    msgpack::pack(buf, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::create_fork(msgpack::object& obj, msgpack::sbuffer& buf)
 {
     TypedMessage<CreateForkRequest> request;
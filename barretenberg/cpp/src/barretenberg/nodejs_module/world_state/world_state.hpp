@@ -53,6 +53,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool rollback(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool sync_block(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool sync_blocks(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool create_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool delete_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
@@ -54,6 +54,8 @@ enum WorldStateMessageType {
 
     COPY_STORES,
 
+    SYNC_BLOCKS,
+
     CLOSE = 999,
 };
 
@@ -233,6 +235,11 @@ struct SyncBlockRequest {
                    publicDataWrites);
 };
 
+struct SyncBlocksRequest {
+    std::vector<SyncBlockRequest> blocks;
+    MSGPACK_FIELDS(blocks);
+};
+
 struct CopyStoresRequest {
     std::string dstPath;
     std::optional<bool> compact;
@@ -0,0 +1,191 @@
+#include "file_backed_memory.hpp"
+#include "barretenberg/common/log.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unistd.h>
+#ifndef __wasm__
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+using namespace bb;
+
+struct FileBackedMemoryState {
+    FileBackedMemoryState()
+    {
+        if (const char* directory = std::getenv("BB_POLYNOMIAL_BACKING_DIR"); directory != nullptr && *directory != 0) {
+            config = FileBackedMemoryConfig{ .directory = directory };
+        }
+        update_min_bytes();
+    }
+
+    // Must be called with the mutex held.
+    void update_min_bytes()
+    {
+        enabled = config.has_value();
+        min_bytes = config.has_value() ? std::max(config->min_bytes, size_t(1)) : SIZE_MAX;
+    }
+
+    std::mutex mutex;
+    std::optional<FileBackedMemoryConfig> config;
+    // Live mappings, from start address to size.
+    std::map<uintptr_t, size_t> mappings;
+
+    // Read without the mutex, so that the allocations and lookups that can not involve a file-backed mapping (all of
+    // them, unless file backing is enabled) do not contend on it.
+    std::atomic<bool> enabled = false;
+    std::atomic<size_t> min_bytes = SIZE_MAX;
+    std::atomic<size_t> num_mappings = 0;
+};
+
+FileBackedMemoryState& get_state()
+{
+    static FileBackedMemoryState state;
+    return state;
+}
+
+#ifndef __wasm__
+// The mapping containing ptr, as an iterator into state.mappings, or end(). Must be called with the mutex held.
+std::map<uintptr_t, size_t>::const_iterator find_mapping(const FileBackedMemoryState& state, const void* ptr)
+{
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+    auto it = state.mappings.upper_bound(address);
+    if (it == state.mappings.begin()) {
+        return state.mappings.end();
+    }
+    --it;
+    return address < it->first + it->second ? it : state.mappings.end();
+}
+#endif
+
+} // namespace
+
+namespace bb {
+
+void set_file_backed_memory_config(std::optional<FileBackedMemoryConfig> config)
+{
+    auto& state = get_state();
+    std::unique_lock lock(state.mutex);
+    state.config = std::move(config);
+    state.update_min_bytes();
+}
+
+bool file_backed_memory_enabled()
+{
+#ifdef __wasm__
+    return false;
+#else
+    return get_state().enabled.load(std::memory_order_relaxed);
+#endif
+}
+
+std::shared_ptr<void> try_allocate_file_backed_memory([[maybe_unused]] size_t bytes)
+{
+#ifdef __wasm__
+    return nullptr;
+#else
+    auto& state = get_state();
+    if (bytes < state.min_bytes.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    std::string path;
+    {
+        std::unique_lock lock(state.mutex);
+        if (!state.config.has_value() || bytes == 0 || bytes < state.config->min_bytes) {
+            return nullptr;
+        }
+        path = (state.config->directory / "bb-polynomial-XXXXXX").string();
+    }
+    int fd = mkstemp(path.data());
+    if (fd == -1) {
+        vinfo("failed to create polynomial backing file ", path, ": ", strerror(errno));
+        return nullptr;
+    }
+    // Nobody else needs the file: it is deleted as soon as it is unmapped, or if the process dies.
+    unlink(path.c_str());
+    if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        vinfo("failed to size polynomial backing file to ", bytes, " bytes: ", strerror(errno));
+        close(fd);
+        return nullptr;
+    }
+    void* mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping keeps its own reference to the file.
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        vinfo("failed to mmap polynomial backing file: ", strerror(errno));
+        return nullptr;
+    }
+    {
+        std::unique_lock lock(state.mutex);
+        state.mappings.emplace(reinterpret_cast<uintptr_t>(mapping), bytes);
+        state.num_mappings = state.mappings.size();
+    }
+    return std::shared_ptr<void>(mapping, [bytes](void* ptr) {
+        auto& state = get_state();
+        {
+            std::unique_lock lock(state.mutex);
+            state.mappings.erase(reinterpret_cast<uintptr_t>(ptr));
+            state.num_mappings = state.mappings.size();
+        }
+        munmap(ptr, bytes);
+    });
+#endif
+}
+
+const void* get_file_backed_mapping([[maybe_unused]] const void* ptr)
+{
+#ifdef __wasm__
+    return nullptr;
+#else
+    auto& state = get_state();
+    // A pointer into a mapping was handed out after the mapping was counted, and the mapping outlives it.
+    if (state.num_mappings.load(std::memory_order_relaxed) == 0) {
+        return nullptr;
+    }
+    std::unique_lock lock(state.mutex);
+    auto it = find_mapping(state, ptr);
+    return it == state.mappings.end() ? nullptr : reinterpret_cast<const void*>(it->first);
+#endif
+}
+
+void evict_file_backed_memory([[maybe_unused]] const void* ptr)
+{
+#ifndef __wasm__
+    auto& state = get_state();
+    std::unique_lock lock(state.mutex);
+    auto it = find_mapping(state, ptr);
+    if (it == state.mappings.end()) {
+        return;
+    }
+    // For a shared file mapping, MADV_DONTNEED only drops the pages from this process: the data stays in the file
+    // (and in the page cache until it is reclaimed). Flushing first lets the kernel reclaim the pages cheaply.
+    auto* mapping = reinterpret_cast<void*>(it->first);
+    msync(mapping, it->second, MS_ASYNC);
+    madvise(mapping, it->second, MADV_DONTNEED);
+#endif
+}
+
+void prefetch_file_backed_memory([[maybe_unused]] const void* ptr)
+{
+#ifndef __wasm__
+    auto& state = get_state();
+    std::unique_lock lock(state.mutex);
+    auto it = find_mapping(state, ptr);
+    if (it == state.mappings.end()) {
+        return;
+    }
+    auto* mapping = reinterpret_cast<void*>(it->first);
+    madvise(mapping, it->second, MADV_SEQUENTIAL);
+    madvise(mapping, it->second, MADV_WILLNEED);
+#endif
+}
+
+} // namespace bb
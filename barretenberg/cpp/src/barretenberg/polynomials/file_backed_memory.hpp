@@ -0,0 +1,88 @@
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <unordered_set>
+
+namespace bb {
+
+/**
+ * @brief Optional out-of-core backing for large polynomials.
+ * @details When enabled, every allocation made through _allocate_aligned_memory of at least `min_bytes` is served by a
+ * shared mapping of an (unlinked) file in `directory` instead of anonymous memory. The kernel can then write the pages
+ * back to disk and drop them from RAM under memory pressure, rather than the process running out of memory, and the
+ * prover can tell it which polynomials it is done with for now (see keep_only_resident). Freshly mapped files read as
+ * zeroes, so file-backed polynomials skip the zeroing pass.
+ *
+ * It is disabled by default, and can be enabled by setting BB_POLYNOMIAL_BACKING_DIR to an existing directory (ideally
+ * on a local SSD). Not available in wasm.
+ */
+struct FileBackedMemoryConfig {
+    // Smallest allocation that is file-backed: small polynomials are not worth a file and a mapping.
+    static constexpr size_t DEFAULT_MIN_BYTES = size_t(1) << 24;
+
+    std::filesystem::path directory;
+    size_t min_bytes = DEFAULT_MIN_BYTES;
+};
+
+// Enables (or, with std::nullopt, disables) file backing for the allocations made from now on. Overrides the
+// environment.
+void set_file_backed_memory_config(std::optional<FileBackedMemoryConfig> config);
+bool file_backed_memory_enabled();
+
+/**
+ * @brief Allocates `bytes` of zeroed, page-aligned memory backed by a file.
+ * @return nullptr if file backing is disabled, the allocation is below the threshold or the file can not be created.
+ */
+std::shared_ptr<void> try_allocate_file_backed_memory(size_t bytes);
+
+/**
+ * @brief The start of the file-backed mapping that contains `ptr`, or nullptr if `ptr` is not file-backed.
+ */
+const void* get_file_backed_mapping(const void* ptr);
+
+/**
+ * @brief Residency hints for the file-backed mapping that contains `ptr`; no-ops if `ptr` is not file-backed.
+ * @details evict writes the dirty pages back and drops the mapping from RAM: the data is read back from disk when it is
+ * next accessed. prefetch starts reading the mapping back sequentially, ahead of its use.
+ */
+void evict_file_backed_memory(const void* ptr);
+void prefetch_file_backed_memory(const void* ptr);
+
+/**
+ * @brief Residency policy for a prover stage: the file-backed polynomials of the stage are prefetched and all the other
+ * file-backed polynomials in `all` are evicted. Polynomials sharing memory (e.g. shifts) are treated as one.
+ *
+ * @param all All the polynomials of the prover, e.g. ProverPolynomials::get_all().
+ * @param stage_polynomials Ranges of polynomials used by the stage, e.g. get_wires(), get_sigmas().
+ */
+template <typename AllPolynomials, typename... StagePolynomials>
+void keep_only_resident(AllPolynomials&& all, StagePolynomials&&... stage_polynomials)
+{
+    if (!file_backed_memory_enabled()) {
+        return;
+    }
+    std::unordered_set<const void*> resident;
+    auto add_resident = [&](auto&& polynomials) {
+        for (auto& polynomial : polynomials) {
+            if (const void* mapping = get_file_backed_mapping(polynomial.data()); mapping != nullptr) {
+                resident.insert(mapping);
+            }
+        }
+    };
+    (add_resident(stage_polynomials), ...);
+
+    std::unordered_set<const void*> evicted;
+    for (auto& polynomial : all) {
+        const void* mapping = get_file_backed_mapping(polynomial.data());
+        if (mapping != nullptr && !resident.contains(mapping) && evicted.insert(mapping).second) {
+            evict_file_backed_memory(mapping);
+        }
+    }
+    for (const void* mapping : resident) {
+        prefetch_file_backed_memory(mapping);
+    }
+}
+
+} // namespace bb
@@ -0,0 +1,80 @@
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "barretenberg/common/ref_array.hpp"
+#include "barretenberg/polynomials/file_backed_memory.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+
+using namespace bb;
+
+#ifndef __wasm__
+class FileBackedMemory : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / ("bb-file-backed-" + std::to_string(getpid()));
+        std::filesystem::create_directories(directory);
+        set_file_backed_memory_config(FileBackedMemoryConfig{ .directory = directory, .min_bytes = 1024 });
+    }
+    void TearDown() override
+    {
+        set_file_backed_memory_config(std::nullopt);
+        std::filesystem::remove_all(directory);
+    }
+
+    std::filesystem::path directory;
+};
+
+TEST_F(FileBackedMemory, OnlyLargePolynomialsAreFileBacked)
+{
+    Polynomial<fr> small(8);
+    Polynomial<fr> large(1 << 10);
+    EXPECT_EQ(get_file_backed_mapping(small.data()), nullptr);
+    EXPECT_EQ(get_file_backed_mapping(large.data()), large.data());
+    EXPECT_EQ(get_file_backed_mapping(large.data() + 100), large.data());
+    // The backing files are unlinked as soon as they are mapped.
+    EXPECT_TRUE(std::filesystem::is_empty(directory));
+
+    // Allocations made after disabling are not file-backed, existing ones still are.
+    set_file_backed_memory_config(std::nullopt);
+    Polynomial<fr> other(1 << 10);
+    EXPECT_EQ(get_file_backed_mapping(other.data()), nullptr);
+    EXPECT_EQ(get_file_backed_mapping(large.data()), large.data());
+}
+
+TEST_F(FileBackedMemory, StartsZeroedAndSurvivesEviction)
+{
+    const size_t n = 1 << 12;
+    Polynomial<fr> poly(n, 2 * n, 1);
+    for (size_t i = poly.start_index(); i < poly.end_index(); ++i) {
+        EXPECT_EQ(poly[i], fr(0));
+    }
+
+    auto random = Polynomial<fr>::random(n, 2 * n, 1);
+    for (size_t i = poly.start_index(); i < poly.end_index(); ++i) {
+        poly.at(i) = random[i];
+    }
+    auto shifted = poly.shifted();
+    auto copy = poly;
+    EXPECT_NE(get_file_backed_mapping(copy.data()), get_file_backed_mapping(poly.data()));
+
+    // Only the polynomial of the "stage" (and its shift) is kept resident.
+    keep_only_resident(RefArray{ poly, shifted, copy }, RefArray{ copy });
+    keep_only_resident(RefArray{ poly, shifted, copy }, RefArray{ shifted });
+
+    for (size_t i = poly.start_index(); i < poly.end_index(); ++i) {
+        EXPECT_EQ(poly[i], random[i]);
+        EXPECT_EQ(copy[i], random[i]);
+    }
+    for (size_t i = shifted.start_index(); i < shifted.end_index(); ++i) {
+        EXPECT_EQ(shifted[i], random[i + 1]);
+    }
+
+    // Writes made after an eviction are kept too.
+    evict_file_backed_memory(poly.data());
+    poly.at(5) = fr(42);
+    evict_file_backed_memory(poly.data());
+    EXPECT_EQ(shifted[4], fr(42));
+}
+#endif
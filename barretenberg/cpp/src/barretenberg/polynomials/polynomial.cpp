@@ -71,6 +71,10 @@ template <typename Fr> Polynomial<Fr>::Polynomial(size_t size, size_t virtual_si
     PROFILE_THIS_NAME("polynomial allocation with zeroing");
 
     allocate_backing_memory(size, virtual_size, start_index);
+    // Fresh file-backed memory already reads as zeroes, and touching it would only make it resident.
+    if (get_file_backed_mapping(coefficients_.backing_memory_.get()) != nullptr) {
+        return;
+    }
 
     size_t num_threads = calculate_num_threads(size);
     size_t range_per_thread = size / num_threads;
@@ -131,6 +135,15 @@ template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficien
     memcpy(static_cast<void*>(data()), static_cast<const void*>(coefficients.data()), sizeof(Fr) * coefficients.size());
 }
 
+template <typename Fr>
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+Polynomial<Fr>::Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size, size_t virtual_size, size_t start_index)
+{
+    BB_ASSERT_LTE(start_index + size, virtual_size);
+    coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{ start_index, size + start_index, virtual_size,
+                                                         std::move(backing_memory) };
+}
+
 // Assignments
 
 // full copy "expensive" assignment
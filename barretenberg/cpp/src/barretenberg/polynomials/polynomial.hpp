@@ -12,6 +12,7 @@
 #include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/honk/types/circuit_type.hpp"
+#include "barretenberg/polynomials/file_backed_memory.hpp"
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
 #include "evaluation_domain.hpp"
 #include "polynomial_arithmetic.hpp"
@@ -100,6 +101,14 @@ template <typename Fr> class Polynomial {
         : Polynomial(coefficients, coefficients.size())
     {}
 
+    /**
+     * @brief Constructs a polynomial on top of existing memory, without copying.
+     * @details The memory holds the coefficients [start_index, start_index + size) and is shared with the caller, e.g.
+     * a trace column that is handed over to the prover.
+     */
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size, size_t virtual_size, size_t start_index = 0);
+
     /**
      * @brief Utility to efficiently construct a shift from the original polynomial.
      *
@@ -441,6 +450,11 @@ template <typename Fr> class Polynomial {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
 template <typename Fr> std::shared_ptr<Fr[]> _allocate_aligned_memory(size_t n_elements)
 {
+    // Large allocations are file-backed if enabled, see file_backed_memory.hpp.
+    if (auto file_backed = try_allocate_file_backed_memory(sizeof(Fr) * n_elements)) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        return std::static_pointer_cast<Fr[]>(file_backed);
+    }
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
     return std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * n_elements));
 }
@@ -45,6 +45,13 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/714) Try out std::valarray?
     std::array<Fr, LENGTH> evaluations;
 
+    // Multiplications use Fr's batch (span) arithmetic, which may be vectorized over 8 lanes, when there are enough
+    // non-skipped evaluations to fill the lanes. Otherwise (and for non-native Fr) they use the scalar operators.
+    static constexpr bool USE_BATCH_MUL = (LENGTH >= skip_count + 1 + 8) && requires(std::span<Fr> values) {
+        Fr::batch_mul(values, values, values);
+        Fr::batch_sqr(values, values);
+    };
+
     Univariate() = default;
 
     explicit Univariate(std::array<Fr, LENGTH> evaluations)
@@ -229,16 +236,26 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
     Univariate& operator*=(const Univariate& other)
     {
         evaluations[0] *= other.evaluations[0];
-        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
-            evaluations[i] *= other.evaluations[i];
+        if constexpr (USE_BATCH_MUL) {
+            auto values = std::span(evaluations).template subspan<skip_count + 1>();
+            Fr::batch_mul(values, std::span(other.evaluations).template subspan<skip_count + 1>(), values);
+        } else {
+            for (size_t i = skip_count + 1; i < LENGTH; ++i) {
+                evaluations[i] *= other.evaluations[i];
+            }
         }
         return *this;
     }
     Univariate& self_sqr()
     {
         evaluations[0].self_sqr();
-        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
-            evaluations[i].self_sqr();
+        if constexpr (USE_BATCH_MUL) {
+            auto values = std::span(evaluations).template subspan<skip_count + 1>();
+            Fr::batch_sqr(values, values);
+        } else {
+            for (size_t i = skip_count + 1; i < LENGTH; ++i) {
+                evaluations[i].self_sqr();
+            }
         }
         return *this;
     }
@@ -310,14 +327,20 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
     }
     Univariate& operator*=(const Fr& scalar)
     {
-        size_t i = 0;
-        for (auto& eval : evaluations) {
-            // If skip count is zero, will be enabled on every line, otherwise don't compute for [domain_start+1,..,
-            // domain_start + skip_count]
-            if (i == 0 || i >= (skip_count + 1)) {
-                eval *= scalar;
+        if constexpr (USE_BATCH_MUL) {
+            evaluations[0] *= scalar;
+            auto values = std::span(evaluations).template subspan<skip_count + 1>();
+            Fr::batch_mul(values, scalar, values);
+        } else {
+            size_t i = 0;
+            for (auto& eval : evaluations) {
+                // If skip count is zero, will be enabled on every line, otherwise don't compute for
+                // [domain_start+1,.., domain_start + skip_count]
+                if (i == 0 || i >= (skip_count + 1)) {
+                    eval *= scalar;
+                }
+                i++;
             }
-            i++;
         }
         return *this;
     }
@@ -365,8 +388,13 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
     Univariate& operator*=(const UnivariateView<Fr, domain_end, domain_start, skip_count>& view)
     {
         evaluations[0] *= view.evaluations[0];
-        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
-            evaluations[i] *= view.evaluations[i];
+        if constexpr (USE_BATCH_MUL) {
+            auto values = std::span(evaluations).template subspan<skip_count + 1>();
+            Fr::batch_mul(values, view.evaluations.template subspan<skip_count + 1>(), values);
+        } else {
+            for (size_t i = skip_count + 1; i < LENGTH; ++i) {
+                evaluations[i] *= view.evaluations[i];
+            }
         }
         return *this;
     }
@@ -100,3 +100,61 @@ TEST(CrsFactory, grumpkin)
     ASSERT_ANY_THROW(check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/false));
     check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/true);
 }
+
+TEST(CrsFactory, bn254_mapped_point_table)
+{
+    constexpr size_t num_points = 1024;
+    const fs::path temp_crs_path = "barretenberg_srs_test_mapped_crs";
+    fs::remove_all(temp_crs_path);
+    fs::create_directories(temp_crs_path);
+    write_file(temp_crs_path / "bn254_g1.dat",
+               read_file(bb::srs::bb_crs_path() / "bn254_g1.dat", num_points * sizeof(g1::affine_element)));
+    write_file(temp_crs_path / "bn254_g2.dat", read_file(bb::srs::bb_crs_path() / "bn254_g2.dat"));
+
+    NativeBn254CrsFactory file_crs(temp_crs_path, /*allow_download=*/false);
+    auto expected = file_crs.get_crs(num_points);
+    // The first factory persists the point table, the second one only maps it.
+    for (size_t run = 0; run < 2; ++run) {
+        NativeBn254CrsFactory mapped_crs(temp_crs_path, /*allow_download=*/false, /*use_mapped_point_table=*/true);
+        auto prover = mapped_crs.get_crs(num_points);
+        EXPECT_TRUE(fs::exists(temp_crs_path / "bn254_g1_point_table.dat"));
+        EXPECT_EQ(prover->get_monomial_size(), num_points);
+        for (size_t i = 0; i < num_points * 2; ++i) {
+            EXPECT_EQ(std::make_pair(i, expected->get_monomial_points()[i]),
+                      std::make_pair(i, prover->get_monomial_points()[i]));
+        }
+        EXPECT_EQ(expected->get_g2x(), prover->get_g2x());
+        EXPECT_EQ(0,
+                  memcmp(expected->get_precomputed_g2_lines(),
+                         prover->get_precomputed_g2_lines(),
+                         sizeof(pairing::miller_lines) * 2));
+    }
+    // Asking for more points than the table (and flat file) holds must fail rather than map a short table.
+    NativeBn254CrsFactory mapped_crs(temp_crs_path, /*allow_download=*/false, /*use_mapped_point_table=*/true);
+    ASSERT_ANY_THROW(mapped_crs.get_crs(num_points * 2));
+    fs::remove_all(temp_crs_path);
+}
+
+TEST(CrsFactory, grumpkin_mapped_point_table)
+{
+    constexpr size_t num_points = 1024;
+    const fs::path temp_crs_path = "barretenberg_srs_test_mapped_crs";
+    fs::remove_all(temp_crs_path);
+    fs::create_directories(temp_crs_path);
+    write_file(temp_crs_path / "grumpkin_g1.flat.dat",
+               read_file(bb::srs::bb_crs_path() / "grumpkin_g1.flat.dat",
+                         num_points * sizeof(Grumpkin::AffineElement)));
+
+    NativeGrumpkinCrsFactory file_crs(temp_crs_path, /*allow_download=*/false);
+    auto expected = file_crs.get_crs(num_points);
+    for (size_t run = 0; run < 2; ++run) {
+        NativeGrumpkinCrsFactory mapped_crs(temp_crs_path, /*allow_download=*/false, /*use_mapped_point_table=*/true);
+        auto prover = mapped_crs.get_crs(num_points);
+        EXPECT_EQ(prover->get_monomial_size(), num_points);
+        for (size_t i = 0; i < num_points * 2; ++i) {
+            EXPECT_EQ(std::make_pair(i, expected->get_monomial_points()[i]),
+                      std::make_pair(i, prover->get_monomial_points()[i]));
+        }
+    }
+    fs::remove_all(temp_crs_path);
+}
@@ -0,0 +1,149 @@
+#include "mapped_point_table.hpp"
+#include "barretenberg/common/log.hpp"
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#ifndef __wasm__
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+using namespace bb;
+using namespace bb::srs::factories;
+
+template <typename Curve> PointTableHeader make_header(size_t num_points)
+{
+    PointTableHeader header;
+    header.element_size = static_cast<uint32_t>(sizeof(typename Curve::AffineElement));
+    header.num_points = num_points;
+    std::strncpy(header.curve_name.data(), Curve::name, header.curve_name.size() - 1);
+    return header;
+}
+
+/**
+ * @brief Cheap sanity check that the mapped bytes are a point table produced on a compatible host: the first point must
+ * be on the curve and its odd neighbour must be its endomorphism image.
+ */
+template <typename Curve> bool is_consistent_point_table(std::span<const typename Curve::AffineElement> table)
+{
+    using Fq = typename Curve::BaseField;
+    if (table.size() < 2 || !table[0].on_curve()) {
+        return false;
+    }
+    return table[1].x == Fq::cube_root_of_unity() * table[0].x && table[1].y == -table[0].y;
+}
+
+} // namespace
+
+namespace bb::srs::factories {
+
+template <typename Curve> MappedPointTable<Curve>::~MappedPointTable()
+{
+#ifndef __wasm__
+    munmap(mapping_, mapping_size_);
+#endif
+}
+
+template <typename Curve>
+std::shared_ptr<MappedPointTable<Curve>> map_point_table([[maybe_unused]] const std::filesystem::path& path,
+                                                         [[maybe_unused]] size_t min_num_points)
+{
+#ifdef __wasm__
+    return nullptr;
+#else
+    int fd = open(path.c_str(), O_RDONLY); // NOLINT
+    if (fd == -1) {
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(PointTableHeader)) {
+        close(fd);
+        return nullptr;
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+    void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps its own reference to the file.
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        vinfo("failed to mmap point table at ", path, ": ", strerror(errno));
+        return nullptr;
+    }
+
+    const auto expected = make_header<Curve>(0);
+    PointTableHeader header;
+    std::memcpy(&header, mapping, sizeof(PointTableHeader));
+    const size_t element_size = sizeof(typename Curve::AffineElement);
+    if (header.magic != PointTableHeader::MAGIC || header.version != PointTableHeader::VERSION ||
+        header.element_size != element_size || header.curve_name != expected.curve_name ||
+        file_size != sizeof(PointTableHeader) + header.num_points * 2 * element_size) {
+        info("ignoring malformed point table at ", path);
+        munmap(mapping, file_size);
+        return nullptr;
+    }
+    if (header.num_points < min_num_points) {
+        munmap(mapping, file_size);
+        return nullptr;
+    }
+
+    auto table = std::make_shared<MappedPointTable<Curve>>(mapping, file_size, header.num_points);
+    if (!is_consistent_point_table<Curve>(table->get_point_table())) {
+        info("ignoring point table at ", path, " that was not produced on a compatible host");
+        return nullptr;
+    }
+    // Start paging the table in asynchronously; pippenger will touch all of it.
+    madvise(mapping, file_size, MADV_WILLNEED);
+    return table;
+#endif
+}
+
+template <typename Curve>
+bool write_point_table([[maybe_unused]] const std::filesystem::path& path,
+                       [[maybe_unused]] std::span<const typename Curve::AffineElement> point_table)
+{
+#ifdef __wasm__
+    return false;
+#else
+    const auto header = make_header<Curve>(point_table.size() / 2);
+    // Write to a process-unique temporary first so that concurrent readers only ever observe a complete table.
+    auto tmp_path = path;
+    tmp_path += ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(PointTableHeader));
+        file.write(reinterpret_cast<const char*>(point_table.data()),
+                   static_cast<std::streamsize>(header.num_points * 2 * sizeof(typename Curve::AffineElement)));
+    }
+    std::error_code ec;
+    if (std::filesystem::file_size(tmp_path, ec) !=
+        sizeof(PointTableHeader) + header.num_points * 2 * sizeof(typename Curve::AffineElement)) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    return true;
+#endif
+}
+
+template class MappedPointTable<curve::BN254>;
+template class MappedPointTable<curve::Grumpkin>;
+template std::shared_ptr<MappedPointTable<curve::BN254>> map_point_table<curve::BN254>(const std::filesystem::path&,
+                                                                                       size_t);
+template std::shared_ptr<MappedPointTable<curve::Grumpkin>> map_point_table<curve::Grumpkin>(
+    const std::filesystem::path&, size_t);
+template bool write_point_table<curve::BN254>(const std::filesystem::path&,
+                                              std::span<const curve::BN254::AffineElement>);
+template bool write_point_table<curve::Grumpkin>(const std::filesystem::path&,
+                                                 std::span<const curve::Grumpkin::AffineElement>);
+
+} // namespace bb::srs::factories
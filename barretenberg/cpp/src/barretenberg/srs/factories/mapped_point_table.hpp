@@ -0,0 +1,89 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace bb::srs::factories {
+
+/**
+ * @details Native layout of a pippenger point table as stored on disk:
+ *
+ *      | header (64 bytes)              |
+ *      | P_0      | (beta * x_0, -y_0)  | ‾\
+ *      | P_1      | (beta * x_1, -y_1)  |   > 2 * num_points affine elements, in-memory (montgomery) form
+ *            ...                          _/
+ *
+ * This is exactly the buffer `generate_pippenger_point_table` produces, so it can be mapped and handed straight to
+ * pippenger without parsing or precomputation. The header is 64 bytes so that the points keep the cache-line alignment
+ * of the (page aligned) mapping. The file is host-specific: it is a cache derived from the flat `*_g1.dat` files and
+ * can always be rebuilt from them.
+ */
+struct PointTableHeader {
+    static constexpr uint64_t MAGIC = 0x454c4241'54505442; // "BTPTABLE"
+    static constexpr uint32_t VERSION = 1;
+
+    uint64_t magic = MAGIC;
+    uint32_t version = VERSION;
+    uint32_t element_size = 0;
+    uint64_t num_points = 0;
+    std::array<char, 16> curve_name{};
+    std::array<uint8_t, 24> reserved{};
+};
+static_assert(sizeof(PointTableHeader) == 64);
+
+/**
+ * @brief A read-only, shared mapping of a pippenger point table file.
+ * @details The mapping is MAP_SHARED so that every prover process on a host that maps the same file shares a single
+ * page-cache copy of the points. The points must never be written to: the pages are mapped PROT_READ.
+ */
+template <typename Curve> class MappedPointTable {
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    MappedPointTable(void* mapping, size_t mapping_size, size_t num_points)
+        : mapping_(mapping)
+        , mapping_size_(mapping_size)
+        , num_points_(num_points)
+    {}
+    MappedPointTable(const MappedPointTable&) = delete;
+    MappedPointTable(MappedPointTable&&) = delete;
+    MappedPointTable& operator=(const MappedPointTable&) = delete;
+    MappedPointTable& operator=(MappedPointTable&&) = delete;
+    ~MappedPointTable();
+
+    /**
+     * @brief The point table, i.e. 2 * num_points() elements with the endomorphism points at odd indices.
+     */
+    std::span<AffineElement> get_point_table() const
+    {
+        auto* points = reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(mapping_) + sizeof(PointTableHeader));
+        return { points, num_points_ * 2 };
+    }
+    size_t num_points() const { return num_points_; }
+
+  private:
+    void* mapping_;
+    size_t mapping_size_;
+    size_t num_points_;
+};
+
+/**
+ * @brief Maps the point table stored at `path` if it is valid and holds at least `min_num_points` points.
+ * @return nullptr if the file is missing, malformed, too small or mmap is unavailable (e.g. wasm).
+ */
+template <typename Curve>
+std::shared_ptr<MappedPointTable<Curve>> map_point_table(const std::filesystem::path& path, size_t min_num_points);
+
+/**
+ * @brief Atomically (write to a temporary file then rename) persists a pippenger point table to `path`.
+ * @return false if the table could not be written, e.g. because the crs directory is read-only.
+ */
+template <typename Curve>
+bool write_point_table(const std::filesystem::path& path, std::span<const typename Curve::AffineElement> point_table);
+
+} // namespace bb::srs::factories
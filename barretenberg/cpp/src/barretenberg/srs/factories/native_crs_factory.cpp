@@ -1,9 +1,80 @@
 #include "native_crs_factory.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/srs/factories/get_bn254_crs.hpp"
 #include "barretenberg/srs/factories/get_grumpkin_crs.hpp"
+#include "barretenberg/srs/factories/mapped_point_table.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+namespace {
+
+using namespace bb;
+using namespace bb::srs::factories;
+
+const char* BN254_POINT_TABLE_FILENAME = "bn254_g1_point_table.dat";
+const char* GRUMPKIN_POINT_TABLE_FILENAME = "grumpkin_g1_point_table.dat";
+
+/**
+ * @brief A BN254 prover CRS whose monomial points live in a read-only shared mapping of a point table file.
+ */
+class MappedBn254Crs : public Crs<curve::BN254> {
+    using Curve = curve::BN254;
+
+  public:
+    MappedBn254Crs(const MappedBn254Crs&) = delete;
+    MappedBn254Crs(MappedBn254Crs&&) noexcept = delete;
+    MappedBn254Crs& operator=(const MappedBn254Crs&) = delete;
+    MappedBn254Crs& operator=(MappedBn254Crs&&) = delete;
+
+    MappedBn254Crs(std::shared_ptr<MappedPointTable<Curve>> table, g2::affine_element const& g2_point)
+        : g2_x(g2_point)
+        , precomputed_g2_lines(
+              static_cast<pairing::miller_lines*>(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
+        , table_(std::move(table))
+    {
+        bb::pairing::precompute_miller_lines(bb::g2::one, precomputed_g2_lines[0]);
+        bb::pairing::precompute_miller_lines(g2_x, precomputed_g2_lines[1]);
+    }
+
+    ~MappedBn254Crs() override { aligned_free(precomputed_g2_lines); }
+
+    std::span<Curve::AffineElement> get_monomial_points() override { return table_->get_point_table(); }
+
+    size_t get_monomial_size() const override { return table_->num_points(); }
+
+    g2::affine_element get_g2x() const override { return g2_x; }
+
+    pairing::miller_lines const* get_precomputed_g2_lines() const override { return precomputed_g2_lines; }
+    g1::affine_element get_g1_identity() const override { return table_->get_point_table()[0]; };
+
+  private:
+    g2::affine_element g2_x;
+    pairing::miller_lines* precomputed_g2_lines;
+    std::shared_ptr<MappedPointTable<Curve>> table_;
+};
+
+/**
+ * @brief A Grumpkin prover CRS whose monomial points live in a read-only shared mapping of a point table file.
+ */
+class MappedGrumpkinCrs : public Crs<curve::Grumpkin> {
+    using Curve = curve::Grumpkin;
+
+  public:
+    MappedGrumpkinCrs(std::shared_ptr<MappedPointTable<Curve>> table)
+        : table_(std::move(table))
+    {}
+
+    std::span<Curve::AffineElement> get_monomial_points() override { return table_->get_point_table(); }
+    size_t get_monomial_size() const override { return table_->num_points(); }
+    Curve::AffineElement get_g1_identity() const override { return table_->get_point_table()[0]; };
+
+  private:
+    std::shared_ptr<MappedPointTable<Curve>> table_;
+};
+
+} // namespace
+
 namespace bb::srs::factories {
 
 /**
@@ -35,4 +106,64 @@ MemGrumpkinCrsFactory init_grumpkin_crs(const std::filesystem::path& path,
     auto grumpkin_g1_data = get_grumpkin_g1_data(path, eccvm_dyadic_circuit_size, allow_download);
     return { grumpkin_g1_data };
 }
+
+/**
+ * @brief Initialize a bn254 crs backed by a shared, read-only mapping of the pippenger point table
+ * @details Falls back to an in-memory crs if the point table can neither be found nor persisted (e.g. read-only crs
+ * directory).
+ *
+ * @param dyadic_circuit_size power-of-2 circuit size
+ * @param allow_download whether to download the crs files if they are not found.
+ */
+std::shared_ptr<Crs<curve::BN254>> init_mapped_bn254_crs(const std::filesystem::path& path,
+                                                         size_t dyadic_circuit_size,
+                                                         bool allow_download)
+{
+    const auto table_path = path / BN254_POINT_TABLE_FILENAME;
+    auto table = map_point_table<curve::BN254>(table_path, dyadic_circuit_size);
+    if (table == nullptr) {
+        auto mem_crs = init_bn254_crs(path, dyadic_circuit_size, allow_download).get_crs(dyadic_circuit_size);
+        if (!write_point_table<curve::BN254>(table_path,
+                                             mem_crs->get_monomial_points().subspan(0, 2 * dyadic_circuit_size))) {
+            vinfo("could not persist bn254 point table at ", table_path, ", using in-memory crs");
+            return mem_crs;
+        }
+        table = map_point_table<curve::BN254>(table_path, dyadic_circuit_size);
+        if (table == nullptr) {
+            return mem_crs;
+        }
+    }
+    vinfo("using mapped bn254 point table with num points ", table->num_points(), " at ", table_path);
+    return std::make_shared<MappedBn254Crs>(std::move(table), get_bn254_g2_data(path, allow_download));
+}
+
+/**
+ * @brief Initialize a grumpkin crs backed by a shared, read-only mapping of the pippenger point table
+ * @details Falls back to an in-memory crs if the point table can neither be found nor persisted.
+ *
+ * @param eccvm_dyadic_circuit_size power-of-2 circuit size
+ * @param allow_download whether to download the crs files if they are not found.
+ */
+std::shared_ptr<Crs<curve::Grumpkin>> init_mapped_grumpkin_crs(const std::filesystem::path& path,
+                                                               size_t eccvm_dyadic_circuit_size,
+                                                               bool allow_download)
+{
+    const auto table_path = path / GRUMPKIN_POINT_TABLE_FILENAME;
+    auto table = map_point_table<curve::Grumpkin>(table_path, eccvm_dyadic_circuit_size);
+    if (table == nullptr) {
+        auto mem_crs =
+            init_grumpkin_crs(path, eccvm_dyadic_circuit_size, allow_download).get_crs(eccvm_dyadic_circuit_size);
+        if (!write_point_table<curve::Grumpkin>(
+                table_path, mem_crs->get_monomial_points().subspan(0, 2 * eccvm_dyadic_circuit_size))) {
+            vinfo("could not persist grumpkin point table at ", table_path, ", using in-memory crs");
+            return mem_crs;
+        }
+        table = map_point_table<curve::Grumpkin>(table_path, eccvm_dyadic_circuit_size);
+        if (table == nullptr) {
+            return mem_crs;
+        }
+    }
+    vinfo("using mapped grumpkin point table with num points ", table->num_points(), " at ", table_path);
+    return std::make_shared<MappedGrumpkinCrs>(std::move(table));
+}
 } // namespace bb::srs::factories
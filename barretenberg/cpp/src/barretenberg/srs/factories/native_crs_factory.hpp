@@ -5,6 +5,7 @@
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
 #include <filesystem>
 #include <memory>
+#include <mutex>
 
 namespace bb::srs::factories {
 
@@ -29,17 +30,41 @@ MemGrumpkinCrsFactory init_grumpkin_crs(const std::filesystem::path& path,
                                         size_t eccvm_dyadic_circuit_size,
                                         bool allow_download = true);
 
+/**
+ * @details Native (mmap) mode: alongside the flat G1 files we keep the pippenger point table in its in-memory layout
+ * (see PointTableHeader). When it holds enough points it is mapped read-only and shared between processes, so no
+ * parsing or endomorphism precomputation happens at startup. Otherwise the CRS is loaded as usual and the resulting
+ * point table is persisted for the next process.
+ */
+std::shared_ptr<Crs<curve::BN254>> init_mapped_bn254_crs(const std::filesystem::path& path,
+                                                         size_t dyadic_circuit_size,
+                                                         bool allow_download = true);
+std::shared_ptr<Crs<curve::Grumpkin>> init_mapped_grumpkin_crs(const std::filesystem::path& path,
+                                                               size_t eccvm_dyadic_circuit_size,
+                                                               bool allow_download = true);
+
 /**
  * Derives reference strings from a file, that is secondarily backed by the network.
  */
 class NativeBn254CrsFactory : public CrsFactory<curve::BN254> {
   public:
-    NativeBn254CrsFactory(const std::filesystem::path& path, bool allow_download = true)
+    NativeBn254CrsFactory(const std::filesystem::path& path,
+                          bool allow_download = true,
+                          bool use_mapped_point_table = false)
         : path_(path)
         , allow_download_(allow_download)
+        , use_mapped_point_table_(use_mapped_point_table)
     {}
     std::shared_ptr<Crs<curve::BN254>> get_crs(size_t degree) override
     {
+        // The crs may be grown by concurrent provers (e.g. in `bb serve`).
+        std::unique_lock lock(mutex_);
+        if (use_mapped_point_table_) {
+            if (mapped_crs_ == nullptr || degree > mapped_crs_->get_monomial_size()) {
+                mapped_crs_ = init_mapped_bn254_crs(path_, degree, allow_download_);
+            }
+            return mapped_crs_;
+        }
         if (degree > last_degree_ || mem_crs_ == nullptr) {
             mem_crs_ = std::make_shared<MemBn254CrsFactory>(init_bn254_crs(path_, degree, allow_download_));
             last_degree_ = degree;
@@ -51,18 +76,31 @@ class NativeBn254CrsFactory : public CrsFactory<curve::BN254> {
     std::filesystem::path path_;
     bool allow_download_ = true;
     size_t last_degree_ = 0;
+    bool use_mapped_point_table_ = false;
     std::shared_ptr<MemBn254CrsFactory> mem_crs_;
+    std::shared_ptr<Crs<curve::BN254>> mapped_crs_;
+    std::mutex mutex_;
 };
 
 class NativeGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
   public:
-    NativeGrumpkinCrsFactory(const std::filesystem::path& path, bool allow_download = true)
+    NativeGrumpkinCrsFactory(const std::filesystem::path& path,
+                             bool allow_download = true,
+                             bool use_mapped_point_table = false)
         : path_(path)
         , allow_download_(allow_download)
+        , use_mapped_point_table_(use_mapped_point_table)
     {}
 
     std::shared_ptr<Crs<curve::Grumpkin>> get_crs(size_t degree) override
     {
+        std::unique_lock lock(mutex_);
+        if (use_mapped_point_table_) {
+            if (mapped_crs_ == nullptr || degree > mapped_crs_->get_monomial_size()) {
+                mapped_crs_ = init_mapped_grumpkin_crs(path_, degree, allow_download_);
+            }
+            return mapped_crs_;
+        }
         if (degree > last_degree_ || mem_crs_ == nullptr) {
             mem_crs_ = std::make_unique<MemGrumpkinCrsFactory>(init_grumpkin_crs(path_, degree, allow_download_));
             last_degree_ = degree;
@@ -74,7 +112,10 @@ class NativeGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
     std::filesystem::path path_;
     bool allow_download_ = true;
     size_t last_degree_ = 0;
+    bool use_mapped_point_table_ = false;
     std::unique_ptr<MemGrumpkinCrsFactory> mem_crs_;
+    std::shared_ptr<Crs<curve::Grumpkin>> mapped_crs_;
+    std::mutex mutex_;
 };
 
 } // namespace bb::srs::factories
@@ -7,6 +7,13 @@
 namespace {
 std::shared_ptr<bb::srs::factories::CrsFactory<bb::curve::BN254>> bn254_crs_factory;       // NOLINT
 std::shared_ptr<bb::srs::factories::CrsFactory<bb::curve::Grumpkin>> grumpkin_crs_factory; // NOLINT
+
+// Opt-in native crs mode: map (and persist on first use) the pippenger point tables instead of parsing the flat files.
+bool use_mapped_point_tables()
+{
+    const char* mmap_crs = std::getenv("BB_CRS_MMAP");
+    return mmap_crs != nullptr && std::string(mmap_crs) == "1";
+}
 } // namespace
 
 namespace bb::srs {
@@ -39,7 +46,8 @@ void init_bn254_net_crs_factory(const std::filesystem::path& path)
     if (bn254_crs_factory != nullptr) {
         return;
     }
-    bn254_crs_factory = std::make_shared<factories::NativeBn254CrsFactory>(path);
+    bn254_crs_factory = std::make_shared<factories::NativeBn254CrsFactory>(
+        path, /* allow download = */ true, use_mapped_point_tables());
 }
 
 // Initializes crs from a file path this we use in the entire codebase
@@ -48,7 +56,8 @@ void init_bn254_file_crs_factory(const std::filesystem::path& path)
     if (bn254_crs_factory != nullptr) {
         return;
     }
-    bn254_crs_factory = std::make_shared<factories::NativeBn254CrsFactory>(path, /* allow download = false */ false);
+    bn254_crs_factory = std::make_shared<factories::NativeBn254CrsFactory>(
+        path, /* allow download = false */ false, use_mapped_point_tables());
 }
 
 // Initializes the crs using the memory buffers
@@ -57,7 +66,8 @@ void init_grumpkin_net_crs_factory(const std::filesystem::path& path)
     if (grumpkin_crs_factory != nullptr) {
         return;
     }
-    grumpkin_crs_factory = std::make_shared<factories::NativeGrumpkinCrsFactory>(path);
+    grumpkin_crs_factory = std::make_shared<factories::NativeGrumpkinCrsFactory>(
+        path, /* allow download = */ true, use_mapped_point_tables());
 }
 
 void init_grumpkin_file_crs_factory(const std::filesystem::path& path)
@@ -65,8 +75,8 @@ void init_grumpkin_file_crs_factory(const std::filesystem::path& path)
     if (grumpkin_crs_factory != nullptr) {
         return;
     }
-    grumpkin_crs_factory =
-        std::make_shared<factories::NativeGrumpkinCrsFactory>(path, /* allow download = false */ false);
+    grumpkin_crs_factory = std::make_shared<factories::NativeGrumpkinCrsFactory>(
+        path, /* allow download = false */ false, use_mapped_point_tables());
 }
 
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory()
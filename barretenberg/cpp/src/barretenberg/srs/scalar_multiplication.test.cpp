@@ -12,6 +12,7 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/srs/global_crs.hpp"
@@ -886,6 +887,74 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafe)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, FixedBaseMSM)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 2048;
+    constexpr size_t start_index = 301;
+    constexpr size_t num_scalars = 1500;
+
+    std::vector<AffineElement> points(scalar_multiplication::point_table_size(num_points));
+    std::vector<Fr> scalars(num_scalars);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    for (auto& scalar : scalars) {
+        scalar = Fr::random_element();
+    }
+    // Extreme digits: the largest scalar, and all-ones windows which produce a carry in every window
+    scalars[0] = -Fr::one();
+    scalars[1] = Fr(uint256_t(-1) >> 8);
+    scalars[2] = Fr::zero();
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_scalars; ++i) {
+        expected += points[start_index + i] * scalars[i];
+    }
+    const PolynomialSpan<const Fr> scalar_span{ start_index, scalars };
+
+    // From no precomputation to a single round, with fixed and automatically chosen windows
+    for (auto [precompute_factor, window_bits] : std::vector<std::pair<size_t, size_t>>{
+             { 1, 0 }, { 1, 7 }, { 3, 5 }, { 4, 0 }, { 8, 13 }, { 1000, 0 }, { 1000, 2 } }) {
+        scalar_multiplication::FixedBaseMSM<Curve> msm(
+            std::span<const AffineElement>(points).subspan(0, num_points), precompute_factor, window_bits);
+        EXPECT_EQ(AffineElement(msm.msm(scalar_span)), AffineElement(expected));
+    }
+
+    // The bases can also be read straight out of a pippenger point table
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.data(), points.data(), num_points);
+    scalar_multiplication::FixedBaseMSM<Curve> msm(
+        std::span<const AffineElement>(points).subspan(0, num_points * 2), /*precompute_factor=*/4, /*window_bits=*/0, /*base_stride=*/2);
+    EXPECT_EQ(msm.num_bases(), num_points);
+    EXPECT_EQ(AffineElement(msm.msm(scalar_span)), AffineElement(expected));
+    EXPECT_TRUE(msm.msm({ 0, std::span<const Fr>() }).is_point_at_infinity());
+}
+
+TYPED_TEST(ScalarMultiplicationTests, FixedBaseMSMPrecomputeFactor)
+{
+    using Curve = TypeParam;
+    using FixedBaseMSM = scalar_multiplication::FixedBaseMSM<Curve>;
+
+    constexpr size_t num_bases = 1 << 16;
+    EXPECT_EQ(FixedBaseMSM::get_max_precompute_factor(num_bases, 0), 0);
+    size_t previous_factor = 0;
+    for (size_t memory_budget = size_t(1) << 22; memory_budget <= size_t(1) << 30; memory_budget *= 4) {
+        const size_t factor = FixedBaseMSM::get_max_precompute_factor(num_bases, memory_budget);
+        EXPECT_GE(factor, previous_factor);
+        if (factor != 0) {
+            const size_t window_bits = FixedBaseMSM::get_optimal_window_bits(num_bases, factor);
+            EXPECT_LE(FixedBaseMSM::get_memory_bytes(num_bases, factor, window_bits), memory_budget);
+            EXPECT_LE(factor, FixedBaseMSM::get_num_windows(window_bits));
+        }
+        previous_factor = factor;
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
 {
     using Curve = TypeParam;
@@ -2,6 +2,7 @@
 #include "barretenberg/honk/composer/composer_lib.hpp"
 #include "barretenberg/honk/types/circuit_type.hpp"
 #include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include <array>
 #include <gtest/gtest.h>
@@ -81,3 +82,55 @@ TEST_F(PermutationHelperTests, ComputeHonkStyleSigmaLagrangePolynomialsFromMappi
     compute_honk_style_permutation_lagrange_polynomials_from_mapping<Flavor>(
         proving_key->polynomials.get_sigmas(), mapping.sigmas, proving_key.get());
 }
+
+/**
+ * @brief The parallel construction of the copy cycles finds the same cycles, in the same order, as a serial pass over
+ * the trace
+ */
+TEST(PermutationLib, ConstructCopyCyclesMatchesSerialConstruction)
+{
+    UltraCircuitBuilder builder;
+    // Variables reused across many gates, some of them merged by copy constraints, spread over several blocks
+    std::vector<uint32_t> variables;
+    for (size_t i = 0; i < 50; ++i) {
+        variables.push_back(builder.add_variable(fr(i % 7 == 1 ? i - 1 : i)));
+    }
+    for (size_t i = 0; i + 1 < variables.size(); i += 7) {
+        builder.assert_equal(variables[i], variables[i + 1]);
+    }
+    for (size_t i = 0; i < 10000; ++i) {
+        builder.create_add_gate({ variables[i % 50], variables[(7 * i) % 50], variables[(13 * i) % 50], 0, 0, 0, 0 });
+    }
+    MockCircuits::add_lookup_gates(builder);
+    MockCircuits::add_RAM_gates(builder);
+    builder.finalize_circuit(/*ensure_nonzero=*/true);
+
+    std::vector<uint32_t> block_offsets;
+    std::vector<std::vector<cycle_node>> expected_cycles(builder.variables.size());
+    uint32_t offset = 1;
+    for (auto& block : builder.blocks.get()) {
+        block_offsets.push_back(offset);
+        for (uint32_t row_idx = 0; row_idx < block.size(); ++row_idx) {
+            for (uint32_t wire_idx = 0; wire_idx < UltraCircuitBuilder::NUM_WIRES; ++wire_idx) {
+                const uint32_t real_var_idx = builder.real_variable_index[block.wires[wire_idx][row_idx]];
+                expected_cycles[real_var_idx].push_back({ wire_idx, row_idx + offset });
+            }
+        }
+        offset += static_cast<uint32_t>(block.size());
+    }
+
+    // The zero variable fills the unused wire of each add gate. Its cycle spans several chunks of rows, so both the
+    // large and the small cycles are covered.
+    EXPECT_GT(expected_cycles[builder.zero_idx].size(), 1 << 13);
+
+    const CopyCycles cycles = construct_copy_cycles(builder, block_offsets);
+    ASSERT_EQ(cycles.size(), expected_cycles.size());
+    for (size_t cycle_idx = 0; cycle_idx < cycles.size(); ++cycle_idx) {
+        const auto cycle = cycles[cycle_idx];
+        ASSERT_EQ(cycle.size(), expected_cycles[cycle_idx].size());
+        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+            EXPECT_EQ(cycle[node_idx].wire_idx, expected_cycles[cycle_idx][node_idx].wire_idx);
+            EXPECT_EQ(cycle[node_idx].gate_idx, expected_cycles[cycle_idx][node_idx].gate_idx);
+        }
+    }
+}
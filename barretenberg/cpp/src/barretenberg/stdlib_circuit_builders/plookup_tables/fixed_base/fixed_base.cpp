@@ -7,10 +7,16 @@
 #include "./fixed_base.hpp"
 
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/log.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/numeric/bitop/rotate.hpp"
 #include "barretenberg/numeric/bitop/sparse_form.hpp"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <unistd.h>
 namespace bb::plookup::fixed_base {
 
 /**
@@ -276,6 +282,107 @@ template MultiTable table::get_fixed_base_table<1, table::BITS_PER_HI_SCALAR>(Mu
 template MultiTable table::get_fixed_base_table<2, table::BITS_PER_LO_SCALAR>(MultiTableId);
 template MultiTable table::get_fixed_base_table<3, table::BITS_PER_HI_SCALAR>(MultiTableId);
 
+namespace {
+
+/**
+ * The fixed-base tables file holds the coefficients of the points in their in-memory (Montgomery) form, preceded by the
+ * base points they are computed from, so that tables computed for other generators are rejected.
+ */
+constexpr uint64_t TABLES_FILE_MAGIC = 0x6262666978656462ULL; // "bbfixedb"
+constexpr uint64_t TABLES_FILE_VERSION = 1;
+
+std::array<table::affine_element, table::NUM_FIXED_BASE_MULTI_TABLES> get_base_points()
+{
+    return { table::lhs_base_point_lo(),
+             table::lhs_base_point_hi(),
+             table::rhs_base_point_lo(),
+             table::rhs_base_point_hi() };
+}
+
+size_t get_num_tables(size_t multitable_index)
+{
+    const size_t num_bits = table::get_num_bits_of_multi_table(multitable_index);
+    return (num_bits + table::BITS_PER_TABLE - 1) / table::BITS_PER_TABLE;
+}
+
+std::optional<table::all_multi_tables> read_tables(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+    const auto read = [&](auto& value) { file.read(reinterpret_cast<char*>(&value), sizeof(value)); };
+    uint64_t magic = 0;
+    uint64_t version = 0;
+    std::array<table::affine_element, table::NUM_FIXED_BASE_MULTI_TABLES> base_points;
+    read(magic);
+    read(version);
+    read(base_points);
+    if (!file || magic != TABLES_FILE_MAGIC || version != TABLES_FILE_VERSION || base_points != get_base_points()) {
+        info("Ignoring invalid fixed base tables file ", path);
+        return std::nullopt;
+    }
+
+    table::all_multi_tables tables;
+    for (size_t i = 0; i < table::NUM_FIXED_BASE_MULTI_TABLES; ++i) {
+        tables[i].resize(get_num_tables(i), table::single_lookup_table(table::MAX_TABLE_SIZE));
+        for (auto& single_table : tables[i]) {
+            file.read(reinterpret_cast<char*>(single_table.data()),
+                      static_cast<std::streamsize>(single_table.size() * sizeof(table::affine_element)));
+        }
+    }
+    // A truncated file or one with trailing data was not written by write_tables
+    const bool at_end = file && file.peek() == std::ifstream::traits_type::eof();
+    if (!at_end) {
+        info("Ignoring invalid fixed base tables file ", path);
+        return std::nullopt;
+    }
+    for (const auto& multi_table : tables) {
+        for (const auto& single_table : multi_table) {
+            for (const auto& point : single_table) {
+                if (!point.on_curve() || point.is_point_at_infinity()) {
+                    info("Ignoring invalid fixed base tables file ", path);
+                    return std::nullopt;
+                }
+            }
+        }
+    }
+    vinfo("read fixed base tables from ", path);
+    return tables;
+}
+
+void write_tables(const std::filesystem::path& path, const table::all_multi_tables& tables)
+{
+    // Write to a temporary file and move it in place, so that readers never see a partial file.
+    auto temp_path = path;
+    temp_path += ".tmp-" + std::to_string(getpid());
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        const auto write = [&](const auto& value) {
+            file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+        write(TABLES_FILE_MAGIC);
+        write(TABLES_FILE_VERSION);
+        write(get_base_points());
+        for (const auto& multi_table : tables) {
+            for (const auto& single_table : multi_table) {
+                file.write(reinterpret_cast<const char*>(single_table.data()),
+                           static_cast<std::streamsize>(single_table.size() * sizeof(table::affine_element)));
+            }
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temp_path, path, error);
+    if (error) {
+        info("Could not write fixed base tables file ", path, ": ", error.message());
+        std::filesystem::remove(temp_path, error);
+        return;
+    }
+    vinfo("wrote fixed base tables to ", path);
+}
+
+} // namespace
+
 /**
  * NOTE: Without putting these computed lookup tables behind statics there is a timing issue
  * when compiling for the WASM target.
@@ -283,12 +390,24 @@ template MultiTable table::get_fixed_base_table<3, table::BITS_PER_HI_SCALAR>(Mu
  */
 const table::all_multi_tables& table::fixed_base_tables()
 {
-    static const table::all_multi_tables tables = {
-        table::generate_tables<BITS_PER_LO_SCALAR>(lhs_base_point_lo()),
-        table::generate_tables<BITS_PER_HI_SCALAR>(lhs_base_point_hi()),
-        table::generate_tables<BITS_PER_LO_SCALAR>(rhs_base_point_lo()),
-        table::generate_tables<BITS_PER_HI_SCALAR>(rhs_base_point_hi()),
-    };
+    static const table::all_multi_tables tables = [] {
+        const char* path = std::getenv("BB_FIXED_BASE_TABLES_PATH");
+        if (path != nullptr && *path != 0) {
+            if (auto loaded = read_tables(path)) {
+                return std::move(*loaded);
+            }
+        }
+        table::all_multi_tables generated = {
+            table::generate_tables<BITS_PER_LO_SCALAR>(lhs_base_point_lo()),
+            table::generate_tables<BITS_PER_HI_SCALAR>(lhs_base_point_hi()),
+            table::generate_tables<BITS_PER_LO_SCALAR>(rhs_base_point_lo()),
+            table::generate_tables<BITS_PER_HI_SCALAR>(rhs_base_point_hi()),
+        };
+        if (path != nullptr && *path != 0) {
+            write_tables(path, generated);
+        }
+        return generated;
+    }();
     return tables;
 }
 
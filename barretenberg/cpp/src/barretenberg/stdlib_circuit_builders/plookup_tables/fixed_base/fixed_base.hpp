@@ -64,6 +64,8 @@ class table : public FixedBaseParams {
     // fixed_base_tables = lookup tables of precomputed base points required for our lookup arguments.
     // N.B. these "tables" are not plookup tables, just regular ol' software lookup tables.
     // Used to build the proper plookup table and in the `BasicTable::get_values_from_key` method
+    // If BB_FIXED_BASE_TABLES_PATH is set, they are read from that file rather than computed, or written to it if it
+    // does not hold valid tables yet.
     static const all_multi_tables& fixed_base_tables();
 
     /**
@@ -19,6 +19,7 @@
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_output.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_rho.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_theta.hpp"
+#include <atomic>
 #include <mutex>
 namespace bb::plookup {
 
@@ -28,8 +29,9 @@ namespace {
 // TODO(@zac-williamson) convert these into static const members of a struct
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
+// Read without the lock by get_multitable, which may run concurrently (e.g. when building shards of a circuit)
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool initialised = false;
+std::atomic<bool> initialised = false;
 #ifndef NO_MULTITHREADING
 
 // The multitables initialisation procedure is not thread-safe, so we need to make sure only 1 thread gets to initialize
@@ -142,7 +144,6 @@ const MultiTable& get_multitable(const MultiTableId id)
 {
     if (!initialised) {
         init_multi_tables();
-        initialised = true;
     }
     return MULTI_TABLES[id];
 }
@@ -249,7 +250,8 @@ ReadData<bb::fr> get_lookup_accumulators(const MultiTableId id,
     return lookup;
 }
 
-BasicTable create_basic_table(const BasicTableId id, const size_t index)
+namespace {
+BasicTable generate_basic_table(const BasicTableId id, const size_t index)
 {
     // we have >50 basic fixed base tables so we match with some logic instead of a switch statement
     auto id_var = static_cast<size_t>(id);
@@ -443,4 +445,53 @@ BasicTable create_basic_table(const BasicTableId id, const size_t index)
     }
     }
 }
+
+struct BasicTableRegistry {
+    struct Entry {
+#ifndef NO_MULTITHREADING
+        std::mutex mutex;
+#endif
+        std::shared_ptr<const BasicTable> table;
+    };
+    std::array<Entry, BasicTableId::NUM_BASIC_TABLES> entries;
+};
+
+BasicTableRegistry& get_basic_table_registry()
+{
+    static BasicTableRegistry registry;
+    return registry;
+}
+} // namespace
+
+/**
+ * @brief The table with the given id, generated the first time it is requested in the process
+ * @details Tables are immutable once generated, and shared by all the circuits that use them: see create_basic_table.
+ * Each table has its own lock, so that different tables can be generated concurrently.
+ */
+std::shared_ptr<const BasicTable> get_basic_table(const BasicTableId id)
+{
+    if (static_cast<size_t>(id) >= static_cast<size_t>(BasicTableId::NUM_BASIC_TABLES)) {
+        throw_or_abort("table id does not exist");
+    }
+    auto& entry = get_basic_table_registry().entries[static_cast<size_t>(id)];
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(entry.mutex);
+#endif
+    if (!entry.table) {
+        entry.table = std::make_shared<const BasicTable>(generate_basic_table(id, 0));
+    }
+    return entry.table;
+}
+
+/**
+ * @brief A copy of the registry table with the given id, to be used by a circuit with the given table index
+ * @details The copy shares the columns and the entry-index map of the registry table: only the lookup gates, which are
+ * recorded per circuit, are its own.
+ */
+BasicTable create_basic_table(const BasicTableId id, const size_t index)
+{
+    BasicTable table = *get_basic_table(id);
+    table.table_index = index;
+    return table;
+}
 } // namespace bb::plookup
@@ -7,6 +7,7 @@
 #pragma once
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/types.hpp"
+#include <memory>
 
 namespace bb::plookup {
 
@@ -17,5 +18,7 @@ ReadData<bb::fr> get_lookup_accumulators(MultiTableId id,
                                          const bb::fr& key_b = 0,
                                          bool is_2_to_1_lookup = false);
 
+std::shared_ptr<const BasicTable> get_basic_table(BasicTableId id);
+
 BasicTable create_basic_table(BasicTableId id, size_t index);
 } // namespace bb::plookup
@@ -0,0 +1,53 @@
+#include "barretenberg/stdlib_circuit_builders/plookup_tables/plookup_tables.hpp"
+#include "barretenberg/common/thread.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::plookup;
+
+/**
+ * @brief The tables created for circuits are copies of the registry table, which share its columns
+ */
+TEST(PlookupTables, CreatedTablesShareRegistryColumns)
+{
+    const auto registry_table = get_basic_table(UINT_XOR_SLICE_6_ROTATE_0);
+    EXPECT_EQ(registry_table, get_basic_table(UINT_XOR_SLICE_6_ROTATE_0));
+    EXPECT_EQ(registry_table->size(), 4096);
+
+    auto table = create_basic_table(UINT_XOR_SLICE_6_ROTATE_0, 3);
+    auto other_table = create_basic_table(UINT_XOR_SLICE_6_ROTATE_0, 5);
+    EXPECT_EQ(table.table_index, 3);
+    EXPECT_EQ(other_table.table_index, 5);
+    EXPECT_EQ(table.column_1.get().data(), registry_table->column_1.get().data());
+    EXPECT_EQ(table.column_2.get().data(), other_table.column_2.get().data());
+    EXPECT_EQ(table.column_3.get().data(), other_table.column_3.get().data());
+
+    // Appending to a shared column copies it
+    table.column_1.emplace_back(0);
+    EXPECT_NE(table.column_1.get().data(), registry_table->column_1.get().data());
+    EXPECT_EQ(table.column_1.size(), registry_table->column_1.size() + 1);
+    EXPECT_EQ(other_table.column_1, registry_table->column_1);
+}
+
+// The entry-index map is built once for all the copies of a table
+TEST(PlookupTables, CreatedTablesShareIndexMap)
+{
+    auto table = create_basic_table(UINT_AND_SLICE_6_ROTATE_0, 0);
+    auto other_table = create_basic_table(UINT_AND_SLICE_6_ROTATE_0, 1);
+    table.initialize_index_map();
+    for (size_t i = 0; i < other_table.size(); i += 97) {
+        const LookupHashTable::Key entry{ other_table.column_1[i], other_table.column_2[i], other_table.column_3[i] };
+        EXPECT_EQ(other_table.index_map[entry], i);
+    }
+}
+
+TEST(PlookupTables, ConcurrentRequestsGenerateTableOnce)
+{
+    constexpr size_t num_requests = 16;
+    std::vector<std::shared_ptr<const BasicTable>> tables(num_requests);
+    parallel_for(num_requests, [&](size_t i) { tables[i] = get_basic_table(AES_SBOX_MAP); });
+    for (const auto& table : tables) {
+        EXPECT_EQ(table, tables[0]);
+    }
+}
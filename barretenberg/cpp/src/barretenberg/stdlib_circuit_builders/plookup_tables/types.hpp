@@ -7,6 +7,9 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "./fixed_base/fixed_base_params.hpp"
@@ -81,6 +84,7 @@ enum BasicTableId {
     KECCAK_RHO_7,
     KECCAK_RHO_8,
     KECCAK_RHO_9,
+    NUM_BASIC_TABLES,
 };
 
 enum MultiTableId {
@@ -307,23 +311,36 @@ struct LookupHashTable {
         }
     };
 
-    std::unordered_map<Key, Value, HashFunction> index_map;
+    using Map = std::unordered_map<Key, Value, HashFunction>;
 
     LookupHashTable() = default;
 
-    // Initialize the entry-index map with the columns of a table
-    void initialize(std::vector<FF>& column_1, std::vector<FF>& column_2, std::vector<FF>& column_3)
+    /**
+     * @brief Initialize the entry-index map with the columns of a table
+     * @details Copies of a LookupHashTable share the map, which is only built by the first of them to be initialized
+     * (tables of the registry are copied into every circuit using them, see plookup::create_basic_table). The columns
+     * must not change afterwards.
+     */
+    template <typename Column> void initialize(const Column& column_1, const Column& column_2, const Column& column_3)
     {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+        if (state->initialized) {
+            return;
+        }
+        state->index_map.reserve(column_1.size());
         for (size_t i = 0; i < column_1.size(); ++i) {
-            index_map[{ column_1[i], column_2[i], column_3[i] }] = i;
+            state->index_map[{ column_1[i], column_2[i], column_3[i] }] = i;
         }
+        state->initialized = true;
     }
 
     // Given an entry in the table, return its index in the table
     Value operator[](const Key& key) const
     {
-        auto it = index_map.find(key);
-        if (it != index_map.end()) {
+        auto it = state->index_map.find(key);
+        if (it != state->index_map.end()) {
             return it->second;
         } else {
             info("LookupHashTable: Key not found!");
@@ -332,7 +349,54 @@ struct LookupHashTable {
         }
     }
 
-    bool operator==(const LookupHashTable& other) const = default;
+    bool operator==(const LookupHashTable& other) const
+    {
+        return state == other.state || state->index_map == other.state->index_map;
+    }
+
+  private:
+    struct State {
+#ifndef NO_MULTITHREADING
+        std::mutex mutex;
+#endif
+        bool initialized = false;
+        Map index_map;
+    };
+    std::shared_ptr<State> state = std::make_shared<State>();
+};
+
+/**
+ * @brief A column of a BasicTable, whose storage is shared by the copies of the table
+ * @details Copy-on-write: copying a table (e.g. from the registry into a circuit) does not copy its entries, which are
+ * only copied if a shared column is then appended to.
+ */
+class LookupTableColumn {
+  public:
+    template <typename... Args> void emplace_back(Args&&... args)
+    {
+        if (!values) {
+            values = std::make_shared<std::vector<bb::fr>>();
+        } else if (values.use_count() > 1) {
+            values = std::make_shared<std::vector<bb::fr>>(*values);
+        }
+        values->emplace_back(std::forward<Args>(args)...);
+    }
+
+    const bb::fr& operator[](size_t idx) const { return (*values)[idx]; }
+    size_t size() const { return values ? values->size() : 0; }
+    auto begin() const { return get().begin(); }
+    auto end() const { return get().end(); }
+
+    const std::vector<bb::fr>& get() const
+    {
+        static const std::vector<bb::fr> empty;
+        return values ? *values : empty;
+    }
+
+    bool operator==(const LookupTableColumn& other) const { return values == other.values || get() == other.get(); }
+
+  private:
+    std::shared_ptr<std::vector<bb::fr>> values;
 };
 
 /**
@@ -373,9 +437,9 @@ struct BasicTable {
     bb::fr column_1_step_size = bb::fr(0);
     bb::fr column_2_step_size = bb::fr(0);
     bb::fr column_3_step_size = bb::fr(0);
-    std::vector<bb::fr> column_1;
-    std::vector<bb::fr> column_2;
-    std::vector<bb::fr> column_3;
+    LookupTableColumn column_1;
+    LookupTableColumn column_2;
+    LookupTableColumn column_3;
     std::vector<LookupEntry> lookup_gates; // wire data for all lookup gates created for lookups on this table
 
     // Map from a table entry to its index in the table; used for constructing read counts
@@ -12,10 +12,12 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
 
 #include "barretenberg/serialize/msgpack_impl.hpp"
 #include <execution>
+#include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -752,7 +754,7 @@ plookup::BasicTable& UltraCircuitBuilder_<ExecutionTrace>::get_table(const plook
             return table;
         }
     }
-    // Table doesn't exist! So try to create it.
+    // Table doesn't exist! So create it, as a copy of the registry table sharing its entries.
     lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
     return lookup_tables.back();
 }
@@ -3035,6 +3037,190 @@ template <typename ExecutionTrace> msgpack::sbuffer UltraCircuitBuilder_<Executi
     return buffer;
 }
 
+/**
+ * @brief Create a shard of the circuit: a builder with its variables, copy constraints, constants and range lists, but
+ * none of its gates
+ */
+template <typename ExecutionTrace>
+typename UltraCircuitBuilder_<ExecutionTrace>::Shard UltraCircuitBuilder_<ExecutionTrace>::create_shard() const
+{
+    ASSERT(!circuit_finalized);
+    Shard shard;
+    auto& builder = shard.builder;
+    static_cast<CircuitBuilderBase<FF>&>(builder) = *this;
+    builder.num_gates = 0;
+    builder.blocks = ExecutionTrace{};
+    builder.constant_variable_indices = constant_variable_indices;
+    // The variables of the existing range lists are already tagged; the shard only records the ones it adds
+    for (const auto& [target_range, list] : range_lists) {
+        builder.range_lists.insert({ target_range,
+                                     RangeList{ .target_range = list.target_range,
+                                                .range_tag = list.range_tag,
+                                                .tau_tag = list.tau_tag,
+                                                .variable_indices = {} } });
+    }
+    shard.num_shared_variables = static_cast<uint32_t>(this->variables.size());
+    shard.num_public_inputs = this->public_inputs.size();
+    shard.shared_tag = this->current_tag;
+    return shard;
+}
+
+/**
+ * @brief Append the gates of a shard created from this circuit, with the variables, copy constraints, lookups,
+ * ROM/RAM arrays and range constraints they use
+ * @details The variables created in the shard are renumbered after the ones of the circuit, in order, so merging the
+ * shards of a circuit in a fixed order gives the same circuit whichever thread built them. The constants and range
+ * lists the shard created are deduplicated against the circuit's (their gates being dropped from the shard), so the
+ * number of gates is the same as if the shard's gates had been added to the circuit directly; the order of the gates
+ * of a block may differ.
+ *
+ * The shard must have been created from this circuit, which may have had gates (e.g. other shards) added since. It
+ * must not add public inputs or change the values of the variables it was created with.
+ */
+template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::merge_shard(const Shard& shard)
+{
+    const auto& builder = shard.builder;
+    if (builder.public_inputs.size() != shard.num_public_inputs) {
+        throw_or_abort("Circuit shards cannot add public inputs");
+    }
+    ASSERT(shard.num_shared_variables <= this->variables.size() && !circuit_finalized);
+    const uint32_t num_shard_variables = static_cast<uint32_t>(builder.variables.size());
+    constexpr uint32_t DROPPED = UINT32_MAX;
+
+    // The step variables of the range lists created by the shard, which this circuit has (or creates) its own of
+    std::unordered_set<uint32_t> range_list_variables;
+    for (const auto& [target_range, list] : builder.range_lists) {
+        if (list.range_tag > shard.shared_tag) {
+            const size_t num_step_variables = target_range / DEFAULT_PLOOKUP_RANGE_STEP_SIZE + 2;
+            const auto step_variables_end = list.variable_indices.begin() + static_cast<ptrdiff_t>(num_step_variables);
+            range_list_variables.insert(list.variable_indices.begin(), step_variables_end);
+        }
+    }
+    std::unordered_map<uint32_t, FF> new_constants;
+    for (const auto& [value, index] : builder.constant_variable_indices) {
+        if (index >= shard.num_shared_variables) {
+            new_constants.insert({ index, value });
+        }
+    }
+
+    std::vector<uint32_t> new_index(num_shard_variables);
+    std::iota(new_index.begin(), new_index.begin() + shard.num_shared_variables, 0U);
+    for (uint32_t i = shard.num_shared_variables; i < num_shard_variables; ++i) {
+        if (range_list_variables.contains(i)) {
+            new_index[i] = DROPPED;
+        } else if (auto constant = new_constants.find(i); constant != new_constants.end()) {
+            new_index[i] = put_constant_variable(constant->second);
+        } else {
+            new_index[i] = this->add_variable(builder.variables[i]);
+        }
+    }
+    for (uint32_t i = 0; i < num_shard_variables; ++i) {
+        const uint32_t real_index = builder.real_variable_index[i];
+        if (real_index != i && new_index[i] != DROPPED) {
+            this->assert_equal(new_index[real_index], new_index[i]);
+        }
+    }
+
+    // Lookup tables are numbered in the order the circuit first uses them
+    std::vector<FF> new_table_index(builder.lookup_tables.size());
+    for (const auto& shard_table : builder.lookup_tables) {
+        auto& table = get_table(shard_table.id);
+        table.lookup_gates.insert(
+            table.lookup_gates.end(), shard_table.lookup_gates.begin(), shard_table.lookup_gates.end());
+        new_table_index[shard_table.table_index] = FF(table.table_index);
+    }
+
+    const size_t lookup_offset = blocks.lookup.size();
+    const size_t aux_offset = blocks.aux.size();
+    for (auto [block, shard_block] : zip_view(blocks.get(), builder.blocks.get())) {
+        const bool is_arithmetic = &block == &blocks.arithmetic;
+        for (size_t row = 0; row < shard_block.size(); ++row) {
+            // The gates fixing the shard's constants and adding the shard's range list variables to the witness
+            // have been (or will be) added to this circuit by put_constant_variable and create_range_list
+            if (is_arithmetic) {
+                const uint32_t first_wire = shard_block.wires[0][row];
+                if (range_list_variables.contains(first_wire) || new_constants.erase(first_wire) > 0) {
+                    continue;
+                }
+            }
+            for (auto [wire, shard_wire] : zip_view(block.wires, shard_block.wires)) {
+                wire.emplace_back(new_index[shard_wire[row]]);
+            }
+            for (auto [selector, shard_selector] : zip_view(block.selectors, shard_block.selectors)) {
+                selector.emplace_back(shard_selector[row]);
+            }
+#ifdef CHECK_CIRCUIT_STACKTRACES
+            block.stack_traces.stack_traces.emplace_back(shard_block.stack_traces.stack_traces[row]);
+#endif
+            ++this->num_gates;
+        }
+    }
+    for (size_t row = lookup_offset; row < blocks.lookup.size(); ++row) {
+        if (!blocks.lookup.q_lookup_type()[row].is_zero()) {
+            auto& table_index = blocks.lookup.q_3()[row];
+            table_index = new_table_index[static_cast<size_t>(uint256_t(table_index).data[0])];
+        }
+    }
+
+    const auto remap = [&](uint32_t& index) {
+        if (index != UNINITIALIZED_MEMORY_RECORD) {
+            index = new_index[index];
+        }
+    };
+    for (RomTranscript rom_array : builder.rom_arrays) {
+        for (auto& entry : rom_array.state) {
+            remap(entry[0]);
+            remap(entry[1]);
+        }
+        for (auto& record : rom_array.records) {
+            remap(record.index_witness);
+            remap(record.value_column1_witness);
+            remap(record.value_column2_witness);
+            remap(record.record_witness);
+            record.gate_index += aux_offset;
+        }
+        rom_arrays.emplace_back(std::move(rom_array));
+    }
+    for (RamTranscript ram_array : builder.ram_arrays) {
+        for (auto& entry : ram_array.state) {
+            remap(entry);
+        }
+        for (auto& record : ram_array.records) {
+            remap(record.index_witness);
+            remap(record.timestamp_witness);
+            remap(record.value_witness);
+            remap(record.record_witness);
+            record.gate_index += aux_offset;
+        }
+        ram_arrays.emplace_back(std::move(ram_array));
+    }
+    for (auto multiplication : builder.cached_partial_non_native_field_multiplications) {
+        for (size_t i = 0; i < 4; ++i) {
+            remap(multiplication.a[i]);
+            remap(multiplication.b[i]);
+        }
+        remap(multiplication.lo_0);
+        remap(multiplication.hi_0);
+        remap(multiplication.hi_1);
+        cached_partial_non_native_field_multiplications.emplace_back(multiplication);
+    }
+    for (const uint32_t index : builder.used_witnesses) {
+        used_witnesses.emplace_back(new_index[index]);
+    }
+
+    for (const auto& [target_range, list] : builder.range_lists) {
+        for (const uint32_t index : list.variable_indices) {
+            if (!range_list_variables.contains(index)) {
+                create_new_range_constraint(new_index[index], target_range);
+            }
+        }
+    }
+
+    if (builder.failed() && !this->failed()) {
+        this->failure(builder.err());
+    }
+}
+
 template class UltraCircuitBuilder_<UltraExecutionTraceBlocks>;
 template class UltraCircuitBuilder_<MegaExecutionTraceBlocks>;
 // To enable this we need to template plookup
@@ -869,6 +869,25 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
     uint256_t hash_circuit() const;
 
     msgpack::sbuffer export_circuit() override;
+
+    struct Shard;
+    Shard create_shard() const;
+    void merge_shard(const Shard& shard);
+};
+
+/**
+ * @brief A builder for a part of a circuit, constructed independently of (and concurrently with) the other parts
+ * @details It starts with the variables, copy constraints, constants and range lists of the circuit it is created from,
+ * but without its gates. The gates added to it are then appended to the circuit by merge_shard: see there for what this
+ * requires of them.
+ */
+template <typename ExecutionTrace> struct UltraCircuitBuilder_<ExecutionTrace>::Shard {
+    UltraCircuitBuilder_<ExecutionTrace> builder;
+    // State of the circuit the shard was created from
+    uint32_t num_shared_variables = 0;
+    size_t num_public_inputs = 0;
+    uint32_t shared_tag = 0;
 };
+
 using UltraCircuitBuilder = UltraCircuitBuilder_<UltraExecutionTraceBlocks>;
 } // namespace bb
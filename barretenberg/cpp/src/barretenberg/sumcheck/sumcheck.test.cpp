@@ -167,6 +167,48 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         }
     }
 
+    // Restricting sumcheck to active ranges outside of which the polynomials are zero must not change the proof.
+    void test_active_ranges()
+    {
+        const size_t multivariate_d(10);
+        const size_t multivariate_n(1 << multivariate_d);
+        const std::vector<std::pair<size_t, size_t>> active_ranges = {
+            { 3, 17 }, { 100, 101 }, { 10, 40 }, { 513, 800 }, { 1000, multivariate_n }
+        };
+
+        std::vector<Polynomial<FF>> polynomials(NUM_POLYNOMIALS);
+        for (auto& poly : polynomials) {
+            poly = bb::Polynomial<FF>(multivariate_n);
+            for (const auto& [start, end] : active_ranges) {
+                for (size_t i = start; i < end; i++) {
+                    poly.at(i) = FF::random_element();
+                }
+            }
+        }
+
+        auto prove = [&](const std::vector<std::pair<size_t, size_t>>& ranges) {
+            auto full_polynomials = construct_ultra_full_polynomials(polynomials);
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+            sumcheck.round.set_active_ranges(ranges);
+
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            RelationParameters<FF> relation_parameters{ .eta = FF(3), .beta = FF(5), .gamma = FF(7) };
+            sumcheck.prove(full_polynomials, relation_parameters, alpha, gate_challenges);
+            return transcript->export_proof();
+        };
+
+        EXPECT_EQ(prove(active_ranges), prove({}));
+    }
+
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
     void test_prover_verifier_flow()
     {
@@ -410,6 +452,14 @@ TYPED_TEST(SumcheckTests, Prover)
 {
     this->test_prover();
 }
+TYPED_TEST(SumcheckTests, ActiveRanges)
+{
+    if constexpr (!TypeParam::HasZK) {
+        this->test_active_ranges();
+    } else {
+        GTEST_SKIP() << "Active ranges are not used by ZK-enabled flavors";
+    }
+}
 // Tests the prover-verifier flow
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
@@ -59,6 +59,11 @@ template <typename Flavor> class SumcheckProverRound {
      * @brief In Round \f$i = 0,\ldots, d-1\f$, equals \f$2^{d-i}\f$.
      */
     size_t round_size;
+    /**
+     * @brief Row ranges [start, end) of the current round's domain outside of which every edge contributes zero to the
+     * round univariate, e.g. the blocks of a structured trace that are in use. Empty if all the edges must be visited.
+     */
+    std::vector<std::pair<size_t, size_t>> active_ranges;
     /**
      * @brief Number of batched sub-relations in \f$F\f$ specified by Flavor.
      *
@@ -92,6 +97,84 @@ template <typename Flavor> class SumcheckProverRound {
         Utils::zero_univariates(univariate_accumulators);
     }
 
+    /**
+     * @brief Restrict the computation of the round univariates to the edges touching the given ranges of rows.
+     * @details The caller guarantees that every relation vanishes identically over the rows outside of the ranges, so
+     * that the edges made of such rows can be skipped without extending them. The ranges may overlap and be unsorted.
+     * Only the non-ZK compute_univariate makes use of them.
+     */
+    void set_active_ranges(std::vector<std::pair<size_t, size_t>> ranges)
+    {
+        std::sort(ranges.begin(), ranges.end());
+        active_ranges.clear();
+        for (const auto& [start, end] : ranges) {
+            add_range(active_ranges, start, end);
+        }
+    }
+
+    /**
+     * @brief Map the active ranges to the domain of the next round, in which row \f$ \ell \f$ is obtained from the rows
+     * \f$ 2\ell \f$ and \f$ 2\ell + 1 \f$ by \ref bb::SumcheckProver::partially_evaluate "partially_evaluate".
+     */
+    void partially_evaluate_active_ranges()
+    {
+        std::vector<std::pair<size_t, size_t>> next_active_ranges;
+        for (const auto& [start, end] : active_ranges) {
+            add_range(next_active_ranges, start >> 1, (end + 1) >> 1);
+        }
+        active_ranges = std::move(next_active_ranges);
+    }
+
+    /**
+     * @brief The edges of the current round touching the active ranges, as ranges of row indices aligned to edges.
+     */
+    std::vector<std::pair<size_t, size_t>> get_active_edge_ranges() const
+    {
+        std::vector<std::pair<size_t, size_t>> edge_ranges;
+        for (const auto& [start, end] : active_ranges) {
+            add_range(edge_ranges, start & ~size_t(1), std::min(round_size, end + (end & 1)));
+        }
+        return edge_ranges;
+    }
+
+    /**
+     * @brief Split the active edges into contiguous portions with the same number of rows, one per thread.
+     * @details The active edges are usually clustered at a few places of the trace, so splitting the index range of the
+     * round evenly (as compute_univariate does otherwise) would leave most threads idle.
+     */
+    static std::vector<std::vector<std::pair<size_t, size_t>>> split_active_edge_ranges(
+        const std::vector<std::pair<size_t, size_t>>& edge_ranges)
+    {
+        size_t num_rows = 0;
+        for (const auto& [start, end] : edge_ranges) {
+            num_rows += end - start;
+        }
+        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+        const size_t num_threads = bb::calculate_num_threads(num_rows, min_iterations_per_thread);
+
+        std::vector<std::vector<std::pair<size_t, size_t>>> thread_edge_ranges(num_threads);
+        size_t range_idx = 0;
+        size_t next_row = num_rows > 0 ? edge_ranges[0].first : 0;
+        for (size_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+            // Portion boundaries are kept even so that edges are not split between threads
+            const size_t portion_start = (thread_idx * num_rows / num_threads) & ~size_t(1);
+            const size_t portion_end =
+                thread_idx + 1 == num_threads ? num_rows : ((thread_idx + 1) * num_rows / num_threads) & ~size_t(1);
+            size_t remaining = portion_end - portion_start;
+            while (remaining > 0) {
+                const size_t range_end = edge_ranges[range_idx].second;
+                const size_t portion_size = std::min(remaining, range_end - next_row);
+                thread_edge_ranges[thread_idx].emplace_back(next_row, next_row + portion_size);
+                next_row += portion_size;
+                remaining -= portion_size;
+                if (next_row == range_end && ++range_idx < edge_ranges.size()) {
+                    next_row = edge_ranges[range_idx].first;
+                }
+            }
+        }
+        return thread_edge_ranges;
+    }
+
     /**
      * @brief  To compute the round univariate in Round \f$i\f$, the prover first computes the values of Honk
      polynomials \f$ P_1,\ldots, P_N \f$ at the points of the form \f$ (u_0,\ldots, u_{i-1}, k, \vec \ell)\f$ for \f$
@@ -170,6 +253,30 @@ template <typename Flavor> class SumcheckProverRound {
     {
         PROFILE_THIS_NAME("compute_univariate");
 
+        // If the active ranges are known, only the edges touching them are visited. They are divided between the
+        // threads by number of rows rather than by index range.
+        if (!active_ranges.empty()) {
+            const auto thread_edge_ranges = split_active_edge_ranges(get_active_edge_ranges());
+            std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(thread_edge_ranges.size());
+            parallel_for(thread_edge_ranges.size(), [&](size_t thread_idx) {
+                Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
+                ExtendedEdges extended_edges;
+                for (const auto& [start, end] : thread_edge_ranges[thread_idx]) {
+                    for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+                        extend_edges(extended_edges, polynomials, edge_idx);
+                        accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                        extended_edges,
+                                                        relation_parameters,
+                                                        gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+                    }
+                }
+            });
+            for (auto& accumulators : thread_univariate_accumulators) {
+                Utils::add_nested_tuples(univariate_accumulators, accumulators);
+            }
+            return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
+        }
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
@@ -489,6 +596,19 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    // Appends [start, end) to sorted ranges, merging it with the last one if they overlap or are adjacent
+    static void add_range(std::vector<std::pair<size_t, size_t>>& ranges, size_t start, size_t end)
+    {
+        if (start >= end) {
+            return;
+        }
+        if (!ranges.empty() && start <= ranges.back().second) {
+            ranges.back().second = std::max(ranges.back().second, end);
+        } else {
+            ranges.emplace_back(start, end);
+        }
+    }
+
     /**
      * @brief In Round \f$ i \f$, for a given point \f$ \vec \ell \in \{0,1\}^{d-1 - i}\f$, calculate the contribution
      * of each sub-relation to \f$ T^i(X_i) \f$.
@@ -18,14 +18,15 @@ namespace bb {
 template <class Flavor>
 void TraceToPolynomials<Flavor>::populate(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured)
+                                          bool is_structured,
+                                          bool populate_precomputed)
 {
 
     PROFILE_THIS_NAME("trace populate");
 
     // Share wire polynomials, selector polynomials between proving key and builder and copy cycles from raw circuit
     // data
-    auto trace_data = construct_trace_data(builder, proving_key, is_structured);
+    auto trace_data = construct_trace_data(builder, proving_key, is_structured, populate_precomputed);
 
     if constexpr (IsUltraOrMegaHonk<Flavor>) {
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
@@ -45,7 +46,7 @@ void TraceToPolynomials<Flavor>::populate(Builder& builder,
     }
 
     // Compute the permutation argument polynomials (sigma/id) and add them to proving key
-    {
+    if (populate_precomputed) {
 
         PROFILE_THIS_NAME("compute_permutation_argument_polynomials");
 
@@ -74,7 +75,7 @@ void TraceToPolynomials<Flavor>::add_memory_records_to_proving_key(TraceData& tr
 
 template <class Flavor>
 typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::construct_trace_data(
-    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
+    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured, bool populate_precomputed)
 {
 
     PROFILE_THIS_NAME("construct_trace_data");
@@ -82,10 +83,12 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
     TraceData trace_data{ builder, proving_key };
 
     uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
-    // For each block in the trace, populate wire polys, copy cycles and selector polys
+    std::vector<uint32_t> block_offsets;
+    // For each block in the trace, populate wire polys and selector polys
 
     for (auto& block : builder.blocks.get()) {
         auto block_size = static_cast<uint32_t>(block.size());
+        block_offsets.push_back(offset);
 
         // Save ranges over which the blocks are "active" for use in structured commitments
         if constexpr (IsUltraOrMegaHonk<Flavor>) { // Mega and Ultra
@@ -95,28 +98,24 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
             }
         }
 
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
+        // Update wire polynomials
         {
 
-            PROFILE_THIS_NAME("populating wires and copy_cycles");
+            PROFILE_THIS_NAME("populating wires");
 
             for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
                 for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
                     uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                    uint32_t real_var_idx = builder.real_variable_index[var_idx];
                     uint32_t trace_row_idx = block_row_idx + offset;
                     // Insert the real witness values from this block into the wire polys at the correct offset
                     trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
-                    // Add the address of the witness value to its corresponding copy cycle
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
                 }
             }
         }
 
         // Insert the selector values for this block into the selector polynomials at the correct offset
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
-        for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
+        for (size_t selector_idx = 0; populate_precomputed && selector_idx < NUM_SELECTORS; selector_idx++) {
             auto& selector = block.selectors[selector_idx];
             for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
                 size_t trace_row_idx = row_idx + offset;
@@ -138,6 +137,11 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
         offset += block.get_fixed_size(is_structured);
     }
 
+    // Construct the copy cycles, which are only needed to compute the permutation argument polynomials
+    if (populate_precomputed) {
+        trace_data.copy_cycles = construct_copy_cycles(builder, block_offsets);
+    }
+
     return trace_data;
 }
 
@@ -50,7 +50,10 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProver_<Flavor>::execute_relatio
                                              proving_key->gate_challenges,
                                              zk_sumcheck_data);
         } else {
-
+            // The polynomials of a folding accumulator combine several traces, so their active ranges are unknown
+            if (!proving_key->is_accumulator) {
+                sumcheck.round.set_active_ranges(proving_key->sumcheck_active_ranges);
+            }
             sumcheck_output = sumcheck.prove(proving_key->proving_key.polynomials,
                                              proving_key->relation_parameters,
                                              proving_key->alphas,
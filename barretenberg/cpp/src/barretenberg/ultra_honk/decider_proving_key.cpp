@@ -47,11 +47,13 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProvingKey_<Flavor>::allocate_pe
 {
     PROFILE_THIS_NAME("allocate_permutation_argument_polynomials");
 
-    for (auto& sigma : proving_key.polynomials.get_sigmas()) {
-        sigma = Polynomial(proving_key.circuit_size);
-    }
-    for (auto& id : proving_key.polynomials.get_ids()) {
-        id = Polynomial(proving_key.circuit_size);
+    if (!precomputed_from_cache) {
+        for (auto& sigma : proving_key.polynomials.get_sigmas()) {
+            sigma = Polynomial(proving_key.circuit_size);
+        }
+        for (auto& id : proving_key.polynomials.get_ids()) {
+            id = Polynomial(proving_key.circuit_size);
+        }
     }
     proving_key.polynomials.z_perm = Polynomial::shiftable(proving_key.circuit_size);
 }
@@ -60,6 +62,10 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProvingKey_<Flavor>::allocate_la
 {
     PROFILE_THIS_NAME("allocate_lagrange_polynomials");
 
+    if (precomputed_from_cache) {
+        return;
+    }
+
     // First and last lagrange polynomials (in the full circuit size)
     proving_key.polynomials.lagrange_first = Polynomial(
         /* size=*/1, /*virtual size=*/dyadic_circuit_size, /*start_index=*/0);
@@ -75,6 +81,10 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProvingKey_<Flavor>::allocate_se
 {
     PROFILE_THIS_NAME("allocate_selectors");
 
+    if (precomputed_from_cache) {
+        return;
+    }
+
     // Define gate selectors over the block they are isolated to
     for (auto [selector, block] :
          zip_view(proving_key.polynomials.get_gate_selectors(), circuit.blocks.get_gate_blocks())) {
@@ -107,7 +117,7 @@ void DeciderProvingKey_<Flavor>::allocate_table_lookup_polynomials(const Circuit
     ASSERT(dyadic_circuit_size > max_tables_size);
 
     // Allocate the polynomials containing the actual table data
-    if constexpr (IsUltraOrMegaHonk<Flavor>) {
+    if (!precomputed_from_cache) {
         for (auto& poly : proving_key.polynomials.get_tables()) {
             poly = Polynomial(max_tables_size, dyadic_circuit_size, table_offset);
         }
@@ -141,7 +151,9 @@ void DeciderProvingKey_<Flavor>::allocate_ecc_op_polynomials(const Circuit& circ
     for (auto& wire : proving_key.polynomials.get_ecc_op_wires()) {
         wire = Polynomial(ecc_op_block_size, proving_key.circuit_size);
     }
-    proving_key.polynomials.lagrange_ecc_op = Polynomial(ecc_op_block_size, proving_key.circuit_size);
+    if (!precomputed_from_cache) {
+        proving_key.polynomials.lagrange_ecc_op = Polynomial(ecc_op_block_size, proving_key.circuit_size);
+    }
 }
 
 template <IsUltraOrMegaHonk Flavor>
@@ -159,7 +171,9 @@ void DeciderProvingKey_<Flavor>::allocate_databus_polynomials(const Circuit& cir
     proving_key.polynomials.return_data_read_counts = Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
     proving_key.polynomials.return_data_read_tags = Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
 
-    proving_key.polynomials.databus_id = Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
+    if (!precomputed_from_cache) {
+        proving_key.polynomials.databus_id = Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
+    }
 
     // Allocate log derivative lookup argument inverse polynomials
     const size_t q_busread_end =
@@ -222,6 +236,33 @@ void DeciderProvingKey_<Flavor>::construct_databus_polynomials(Circuit& circuit)
     }
 }
 
+/**
+ * @brief Collect the ranges of rows outside of which every relation vanishes identically, for sumcheck to skip them
+ * @details Outside of the blocks in use, the wires and selectors are zero and the grand product is constant (see
+ * compute_grand_product), so the gate and permutation relations vanish. The lookup and databus relations also depend on
+ * the tables and the bus columns, which are laid out independently of the blocks, so their rows are added as well as
+ * the first row (lagrange_first).
+ *
+ * @tparam Flavor
+ * @param circuit
+ */
+template <IsUltraOrMegaHonk Flavor>
+void DeciderProvingKey_<Flavor>::construct_sumcheck_active_ranges(const Circuit& circuit)
+{
+    sumcheck_active_ranges = proving_key.active_region_data.get_ranges();
+    sumcheck_active_ranges.emplace_back(0, 1);
+
+    const size_t tables_offset = circuit.blocks.lookup.trace_offset;
+    sumcheck_active_ranges.emplace_back(tables_offset, tables_offset + circuit.get_tables_size());
+
+    if constexpr (HasDataBus<Flavor>) {
+        const size_t max_bus_size = std::max({ circuit.get_calldata().size(),
+                                               circuit.get_secondary_calldata().size(),
+                                               circuit.get_return_data().size() });
+        sumcheck_active_ranges.emplace_back(0, max_bus_size);
+    }
+}
+
 /**
  * @brief Check that the number of gates in each block does not exceed its fixed capacity. Move any overflow to the
  * overflow block.
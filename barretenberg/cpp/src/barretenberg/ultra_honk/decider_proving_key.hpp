@@ -20,6 +20,7 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_rollup_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_zk_flavor.hpp"
 #include "barretenberg/trace_to_polynomials/trace_to_polynomials.hpp"
+#include "barretenberg/ultra_honk/precomputed_polynomial_cache.hpp"
 #include <chrono>
 
 namespace bb {
@@ -60,6 +61,13 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
     size_t overflow_size{ 0 }; // size of the structured execution trace overflow
 
+    // Whether the precomputed polynomials were loaded from the PrecomputedPolynomialCache rather than computed
+    bool precomputed_from_cache = false;
+
+    // Ranges of rows outside of which every relation vanishes identically. Only computed for structured traces, for
+    // sumcheck to skip the unused parts of the blocks.
+    std::vector<std::pair<size_t, size_t>> sumcheck_active_ranges;
+
     DeciderProvingKey_(Circuit& circuit,
                        TraceSettings trace_settings = {},
                        std::shared_ptr<CommitmentKey> commitment_key = nullptr)
@@ -97,6 +105,21 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
             }
         }
 
+        // The selectors, permutation argument and table polynomials only depend on the circuit structure: if they are
+        // cached for this structure, they are loaded instead of being allocated and computed
+        const auto precomputed_cache = get_precomputed_polynomial_cache();
+        uint256_t precomputed_key;
+        if (precomputed_cache) {
+            PROFILE_THIS_NAME("computing precomputed polynomials key");
+            precomputed_key = compute_precomputed_polynomials_key<Flavor>(circuit, dyadic_circuit_size, is_structured);
+        }
+        const auto load_precomputed = [&]() {
+            precomputed_from_cache =
+                precomputed_cache &&
+                precomputed_cache->load(precomputed_key,
+                                        get_polynomial_pointers(proving_key.polynomials.get_precomputed()));
+        };
+
         vinfo("allocating polynomials object in proving key...");
         {
             PROFILE_THIS_NAME("allocating proving key");
@@ -108,7 +131,10 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
             if ((IsMegaFlavor<Flavor> && !is_structured) || (is_structured && circuit.blocks.has_overflow)) {
                 // Allocate full size polynomials
                 proving_key.polynomials = typename Flavor::ProverPolynomials(dyadic_circuit_size);
+                load_precomputed();
             } else { // Allocate only a correct amount of memory for each polynomial
+                load_precomputed(); // the allocations below skip the precomputed polynomials that were loaded
+
                 allocate_wires();
 
                 allocate_permutation_argument_polynomials();
@@ -133,7 +159,7 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
         vinfo("populating trace...");
-        Trace::populate(circuit, proving_key, is_structured);
+        Trace::populate(circuit, proving_key, is_structured, /*populate_precomputed=*/!precomputed_from_cache);
 
         {
             PROFILE_THIS_NAME("constructing prover instance after trace populate");
@@ -145,11 +171,11 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
                 construct_databus_polynomials(circuit);
             }
         }
-        // Set the lagrange polynomials
-        proving_key.polynomials.lagrange_first.at(0) = 1;
-        proving_key.polynomials.lagrange_last.at(final_active_wire_idx) = 1;
+        if (!precomputed_from_cache) {
+            // Set the lagrange polynomials
+            proving_key.polynomials.lagrange_first.at(0) = 1;
+            proving_key.polynomials.lagrange_last.at(final_active_wire_idx) = 1;
 
-        {
             PROFILE_THIS_NAME("constructing lookup table polynomials");
 
             construct_lookup_table_polynomials<Flavor>(
@@ -164,6 +190,14 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
                                                  circuit,
                                                  dyadic_circuit_size);
         }
+        if (is_structured) {
+            construct_sumcheck_active_ranges(circuit);
+        }
+        if (precomputed_cache && !precomputed_from_cache) {
+            PROFILE_THIS_NAME("storing precomputed polynomials");
+            const auto precomputed = get_polynomial_pointers(proving_key.polynomials.get_precomputed());
+            precomputed_cache->store(precomputed_key, { precomputed.begin(), precomputed.end() });
+        }
         { // Public inputs handling
             // Construct the public inputs array
             for (size_t i = 0; i < proving_key.num_public_inputs; ++i) {
@@ -278,6 +312,8 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
     void construct_databus_polynomials(Circuit&)
         requires HasDataBus<Flavor>;
 
+    void construct_sumcheck_active_ranges(const Circuit&);
+
     static void move_structured_trace_overflow_to_overflow_block(Circuit& circuit)
         requires IsMegaFlavor<Flavor>;
 };
@@ -104,6 +104,15 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_preamble_ro
 template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_wire_commitments_round()
 {
     PROFILE_THIS_NAME("OinkProver::execute_wire_commitments_round");
+    auto& polynomials = proving_key->proving_key.polynomials;
+    if constexpr (IsMegaFlavor<Flavor>) {
+        keep_only_resident(polynomials.get_all(),
+                           polynomials.get_wires(),
+                           polynomials.get_ecc_op_wires(),
+                           polynomials.get_databus_entities());
+    } else {
+        keep_only_resident(polynomials.get_all(), polynomials.get_wires());
+    }
     // Commit to the first three wire polynomials
     // We only commit to the fourth wire polynomial after adding memory recordss
     {
@@ -120,14 +129,17 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_wire_commit
 
         // Commit to Goblin ECC op wires.
         // To avoid possible issues with the current work on the merge protocol, they are not
-        // masked in MegaZKFlavor
-        for (auto [polynomial, label] :
-             zip_view(proving_key->proving_key.polynomials.get_ecc_op_wires(), commitment_labels.get_ecc_op_wires())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
-                transcript->send_to_verifier(domain_separator + label,
-                                             proving_key->proving_key.commitment_key->commit(polynomial));
-            };
+        // masked in MegaZKFlavor. They are independent, so their MSMs are computed concurrently.
+        {
+            PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
+            std::vector<PolynomialSpan<const FF>> ecc_op_wires;
+            for (auto& polynomial : proving_key->proving_key.polynomials.get_ecc_op_wires()) {
+                ecc_op_wires.emplace_back(polynomial);
+            }
+            auto commitments = proving_key->proving_key.commitment_key->batch_commit(ecc_op_wires);
+            for (auto [commitment, label] : zip_view(commitments, commitment_labels.get_ecc_op_wires())) {
+                transcript->send_to_verifier(domain_separator + label, commitment);
+            }
         }
 
         // Commit to DataBus related polynomials
@@ -148,6 +160,10 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_wire_commit
 template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_sorted_list_accumulator_round()
 {
     PROFILE_THIS_NAME("OinkProver::execute_sorted_list_accumulator_round");
+    auto& polynomials = proving_key->proving_key.polynomials;
+    keep_only_resident(polynomials.get_all(),
+                       polynomials.get_wires(),
+                       RefArray{ polynomials.lookup_read_counts, polynomials.lookup_read_tags });
     // Get eta challenges
     auto [eta, eta_two, eta_three] = transcript->template get_challenges<FF>(
         domain_separator + "eta", domain_separator + "eta_two", domain_separator + "eta_three");
@@ -184,6 +200,10 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_sorted_list
 template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_log_derivative_inverse_round()
 {
     PROFILE_THIS_NAME("OinkProver::execute_log_derivative_inverse_round");
+    // The inverses are computed from the lookup (and databus) selectors, wires, tables and read counts/tags
+    auto& polynomials = proving_key->proving_key.polynomials;
+    keep_only_resident(
+        polynomials.get_all(), polynomials.get_witness(), polynomials.get_selectors(), polynomials.get_tables());
     auto [beta, gamma] = transcript->template get_challenges<FF>(domain_separator + "beta", domain_separator + "gamma");
     proving_key->relation_parameters.beta = beta;
     proving_key->relation_parameters.gamma = gamma;
@@ -218,6 +238,12 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_log_derivat
 template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_grand_product_computation_round()
 {
     PROFILE_THIS_NAME("OinkProver::execute_grand_product_computation_round");
+    auto& polynomials = proving_key->proving_key.polynomials;
+    keep_only_resident(polynomials.get_all(),
+                       polynomials.get_wires(),
+                       polynomials.get_sigmas(),
+                       polynomials.get_ids(),
+                       RefArray{ polynomials.z_perm });
     // Compute the permutation grand product polynomial
 
     WitnessComputation<Flavor>::compute_grand_product_polynomial(
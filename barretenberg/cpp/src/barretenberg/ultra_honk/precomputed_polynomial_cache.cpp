@@ -0,0 +1,235 @@
+#include "precomputed_polynomial_cache.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/zip_view.hpp"
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+using namespace bb;
+
+constexpr uint64_t MAGIC = 0x6262707265636f6dULL; // "bbprecom"
+constexpr uint32_t VERSION = 1;
+// The data of each polynomial starts on a cache line, as in _allocate_aligned_memory.
+constexpr uint64_t DATA_ALIGNMENT = 64;
+
+struct FileHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t num_polynomials;
+    std::array<uint8_t, 32> key;
+};
+
+struct PolynomialHeader {
+    uint64_t start_index;
+    uint64_t size;
+    uint64_t virtual_size;
+    // Offset of the coefficients from the start of the file.
+    uint64_t data_offset;
+};
+
+std::array<uint8_t, 32> key_to_bytes(const uint256_t& key)
+{
+    std::array<uint8_t, 32> bytes;
+    for (size_t i = 0; i < 4; ++i) {
+        std::memcpy(bytes.data() + 8 * i, &key.data[i], 8);
+    }
+    return bytes;
+}
+
+uint64_t align_up(uint64_t value)
+{
+    return (value + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1);
+}
+
+struct GlobalCache {
+    GlobalCache()
+    {
+        if (const char* directory = std::getenv("BB_PRECOMPUTED_CACHE_DIR"); directory != nullptr && *directory != 0) {
+            cache = std::make_shared<PrecomputedPolynomialCache>(directory);
+        }
+    }
+
+    std::mutex mutex;
+    std::shared_ptr<PrecomputedPolynomialCache> cache;
+};
+
+GlobalCache& get_global_cache()
+{
+    static GlobalCache global_cache;
+    return global_cache;
+}
+
+} // namespace
+
+namespace bb {
+
+PrecomputedPolynomialCache::PrecomputedPolynomialCache(std::filesystem::path directory)
+    : directory(std::move(directory))
+{
+    std::error_code error;
+    std::filesystem::create_directories(this->directory, error);
+    if (error) {
+        info("Could not create precomputed polynomial cache directory ", this->directory, ": ", error.message());
+    }
+}
+
+std::filesystem::path PrecomputedPolynomialCache::get_path(const uint256_t& key) const
+{
+    std::ostringstream name;
+    name << key;
+    return directory / name.str();
+}
+
+bool PrecomputedPolynomialCache::load([[maybe_unused]] const uint256_t& key,
+                                      [[maybe_unused]] std::span<Polynomial<fr>* const> polynomials)
+{
+#ifdef __wasm__
+    misses++;
+    return false;
+#else
+    const auto path = get_path(key);
+    const auto miss = [&](const std::string& reason) {
+        misses++;
+        vinfo("precomputed polynomial cache miss (", reason, "): ", path);
+        return false;
+    };
+
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return miss("no entry");
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) < sizeof(FileHeader)) {
+        close(fd);
+        return miss("truncated");
+    }
+    const auto file_size = static_cast<size_t>(file_stat.st_size);
+    // Private mapping: the prover may write to the polynomials (e.g. folding), which must not reach the file.
+    void* mapping = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return miss(std::string("mmap failed: ") + std::strerror(errno));
+    }
+    std::shared_ptr<uint8_t> owner(static_cast<uint8_t*>(mapping),
+                                   [file_size](uint8_t* ptr) { munmap(ptr, file_size); });
+
+    FileHeader header;
+    std::memcpy(&header, owner.get(), sizeof(header));
+    if (header.magic != MAGIC || header.version != VERSION || header.num_polynomials != polynomials.size() ||
+        header.key != key_to_bytes(key)) {
+        return miss("stale entry");
+    }
+    if (sizeof(FileHeader) + polynomials.size() * sizeof(PolynomialHeader) > file_size) {
+        return miss("truncated");
+    }
+    std::vector<PolynomialHeader> polynomial_headers(polynomials.size());
+    std::memcpy(polynomial_headers.data(),
+                owner.get() + sizeof(FileHeader),
+                polynomial_headers.size() * sizeof(PolynomialHeader));
+    for (const auto& polynomial_header : polynomial_headers) {
+        if (polynomial_header.data_offset + polynomial_header.size * sizeof(fr) > file_size ||
+            polynomial_header.start_index + polynomial_header.size > polynomial_header.virtual_size) {
+            return miss("truncated");
+        }
+    }
+
+    for (auto [polynomial, polynomial_header] : zip_view(polynomials, polynomial_headers)) {
+        // The coefficients share the ownership of the whole mapping, which is unmapped along with the last of them.
+        std::shared_ptr<fr[]> coefficients(owner, reinterpret_cast<fr*>(owner.get() + polynomial_header.data_offset));
+        *polynomial = Polynomial<fr>(std::move(coefficients),
+                                     polynomial_header.size,
+                                     polynomial_header.virtual_size,
+                                     polynomial_header.start_index);
+    }
+    hits++;
+    vinfo("precomputed polynomial cache hit: ", path);
+    return true;
+#endif
+}
+
+void PrecomputedPolynomialCache::store([[maybe_unused]] const uint256_t& key,
+                                       [[maybe_unused]] std::span<const Polynomial<fr>* const> polynomials)
+{
+#ifndef __wasm__
+    const auto path = get_path(key);
+    FileHeader header{
+        .magic = MAGIC, .version = VERSION, .num_polynomials = static_cast<uint32_t>(polynomials.size()), .key = {}
+    };
+    header.key = key_to_bytes(key);
+
+    std::vector<PolynomialHeader> polynomial_headers;
+    uint64_t data_offset = align_up(sizeof(FileHeader) + polynomials.size() * sizeof(PolynomialHeader));
+    for (const auto* polynomial : polynomials) {
+        polynomial_headers.push_back({ .start_index = polynomial->start_index(),
+                                       .size = polynomial->size(),
+                                       .virtual_size = polynomial->virtual_size(),
+                                       .data_offset = data_offset });
+        data_offset = align_up(data_offset + polynomial->size() * sizeof(fr));
+    }
+
+    // Write to a temporary file and move it in place, so that readers never see a partial entry.
+    auto temp_path = path;
+    temp_path += ".tmp-" + std::to_string(getpid()) + "-" +
+                 std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        const auto pad_to = [&](uint64_t offset) {
+            static const std::array<char, DATA_ALIGNMENT> zeroes{};
+            const auto position = static_cast<uint64_t>(file.tellp());
+            file.write(zeroes.data(), static_cast<std::streamsize>(offset - position));
+        };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(polynomial_headers.data()),
+                   static_cast<std::streamsize>(polynomial_headers.size() * sizeof(PolynomialHeader)));
+        for (auto [polynomial, polynomial_header] : zip_view(polynomials, polynomial_headers)) {
+            pad_to(polynomial_header.data_offset);
+            file.write(reinterpret_cast<const char*>(polynomial->data()),
+                       static_cast<std::streamsize>(polynomial->size() * sizeof(fr)));
+        }
+        if (!file) {
+            info("Could not write precomputed polynomial cache entry ", temp_path);
+            file.close();
+            std::filesystem::remove(temp_path);
+            return;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temp_path, path, error);
+    if (error) {
+        info("Could not write precomputed polynomial cache entry ", path, ": ", error.message());
+        std::filesystem::remove(temp_path, error);
+        return;
+    }
+    stores++;
+    vinfo("stored precomputed polynomials in ", path);
+#endif
+}
+
+std::shared_ptr<PrecomputedPolynomialCache> get_precomputed_polynomial_cache()
+{
+    auto& global_cache = get_global_cache();
+    std::unique_lock lock(global_cache.mutex);
+    return global_cache.cache;
+}
+
+void set_precomputed_polynomial_cache(std::shared_ptr<PrecomputedPolynomialCache> cache)
+{
+    auto& global_cache = get_global_cache();
+    std::unique_lock lock(global_cache.mutex);
+    global_cache.cache = std::move(cache);
+}
+
+} // namespace bb
@@ -0,0 +1,148 @@
+#pragma once
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief On-disk cache of the precomputed (witness-independent) polynomials of a proving key.
+ * @details Selectors, sigma/id permutation polynomials, table polynomials etc. only depend on the structure of the
+ * circuit, so when the same circuit is proved over and over with different witnesses they only need to be computed
+ * once. The cache stores them keyed by a hash of the circuit structure (see compute_precomputed_polynomials_key), one
+ * file per circuit, in the in-memory layout of the coefficients. Loading maps the file copy-on-write: nothing is
+ * computed or copied, and the pages are shared with other processes proving the same circuit.
+ *
+ * The files are only meant to be read back by the same build on the same kind of machine: they are checked for the
+ * format version, the number of polynomials and the key, but not against tampering.
+ */
+class PrecomputedPolynomialCache {
+  public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t stores = 0;
+    };
+
+    explicit PrecomputedPolynomialCache(std::filesystem::path directory);
+
+    /**
+     * @brief Replaces the polynomials by the ones cached under key.
+     * @return false, leaving the polynomials untouched, if there is no valid entry for the key.
+     */
+    bool load(const uint256_t& key, std::span<Polynomial<fr>* const> polynomials);
+
+    // Writes the polynomials under key. Concurrent stores of the same key are fine: the last one wins.
+    void store(const uint256_t& key, std::span<const Polynomial<fr>* const> polynomials);
+
+    Stats get_stats() const { return { hits.load(), misses.load(), stores.load() }; }
+
+    std::filesystem::path get_path(const uint256_t& key) const;
+
+  private:
+    std::filesystem::path directory;
+    std::atomic<uint64_t> hits = 0;
+    std::atomic<uint64_t> misses = 0;
+    std::atomic<uint64_t> stores = 0;
+};
+
+/**
+ * @brief The cache used when constructing proving keys, nullptr (the default) if there is none.
+ * @details It can be enabled by setting BB_PRECOMPUTED_CACHE_DIR to a directory, which is created if needed, or with
+ * set_precomputed_polynomial_cache.
+ */
+std::shared_ptr<PrecomputedPolynomialCache> get_precomputed_polynomial_cache();
+void set_precomputed_polynomial_cache(std::shared_ptr<PrecomputedPolynomialCache> cache);
+
+template <typename Polynomials> std::vector<Polynomial<fr>*> get_polynomial_pointers(Polynomials&& polynomials)
+{
+    std::vector<Polynomial<fr>*> result;
+    for (auto& polynomial : polynomials) {
+        result.push_back(&polynomial);
+    }
+    return result;
+}
+
+/**
+ * @brief Hash of everything the precomputed polynomials of a finalized circuit (with block offsets computed) depend on.
+ * @details Per gate, the selectors and the (real) variable indices and tags of the wires, which determine the copy
+ * cycles; per block, its offset and size; and the lookup tables used. The rows are hashed in parallel chunks.
+ */
+template <typename Flavor>
+uint256_t compute_precomputed_polynomials_key(const typename Flavor::CircuitBuilder& circuit,
+                                              size_t dyadic_circuit_size,
+                                              bool is_structured)
+{
+    using TraceBlock = std::remove_cvref_t<decltype(circuit.blocks.pub_inputs)>;
+    static constexpr size_t ROWS_PER_CHUNK = 1 << 12;
+
+    std::vector<uint8_t> metadata;
+    const auto append = [](std::vector<uint8_t>& buffer, const auto& value) {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+    };
+    append(metadata, Flavor::NUM_PRECOMPUTED_ENTITIES);
+    append(metadata, dyadic_circuit_size);
+    append(metadata, is_structured);
+    for (const auto& [tag, tau] : circuit.tau) {
+        append(metadata, tag);
+        append(metadata, tau);
+    }
+    for (const auto& table : circuit.lookup_tables) {
+        append(metadata, static_cast<uint64_t>(table.id));
+        append(metadata, table.table_index);
+        append(metadata, table.use_twin_keys);
+        append(metadata, table.size());
+    }
+
+    // Split the rows of every block into chunks that are hashed independently
+    struct Chunk {
+        const TraceBlock* block;
+        size_t start;
+        size_t end;
+    };
+    std::vector<Chunk> chunks;
+    for (const auto& block : circuit.blocks.get()) {
+        append(metadata, block.trace_offset);
+        append(metadata, block.size());
+        append(metadata, block.get_fixed_size(is_structured));
+        append(metadata, block.has_ram_rom);
+        append(metadata, block.is_pub_inputs);
+        for (size_t start = 0; start < block.size(); start += ROWS_PER_CHUNK) {
+            chunks.push_back({ &block, start, std::min(start + ROWS_PER_CHUNK, block.size()) });
+        }
+    }
+
+    std::vector<crypto::Sha256Hash> chunk_hashes(chunks.size());
+    parallel_for(chunks.size(), [&](size_t chunk_idx) {
+        const auto& [block, start, end] = chunks[chunk_idx];
+        std::vector<uint8_t> buffer;
+        for (size_t row = start; row < end; ++row) {
+            for (const auto& wire : block->wires) {
+                const uint32_t real_variable_index = circuit.real_variable_index[wire[row]];
+                append(buffer, real_variable_index);
+                append(buffer, circuit.real_variable_tags[real_variable_index]);
+            }
+            for (const auto& selector : block->selectors) {
+                append(buffer, selector[row]);
+            }
+        }
+        chunk_hashes[chunk_idx] = crypto::sha256(buffer);
+    });
+
+    for (const auto& hash : chunk_hashes) {
+        metadata.insert(metadata.end(), hash.begin(), hash.end());
+    }
+    return from_buffer<uint256_t>(crypto::sha256(metadata));
+}
+
+} // namespace bb
@@ -0,0 +1,120 @@
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "barretenberg/stdlib/pairing_points.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include "barretenberg/ultra_honk/precomputed_polynomial_cache.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+using namespace bb;
+
+#ifndef __wasm__
+template <typename Flavor> class PrecomputedPolynomialCacheTests : public ::testing::Test {
+  public:
+    using Builder = typename Flavor::CircuitBuilder;
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+
+    // A circuit whose structure only depends on num_gates; the witness is random.
+    static Builder construct_circuit(size_t num_gates)
+    {
+        Builder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 2);
+        MockCircuits::add_arithmetic_gates(builder, num_gates);
+        MockCircuits::add_lookup_gates(builder);
+        MockCircuits::add_RAM_gates(builder);
+        stdlib::recursion::PairingPoints<Builder>::add_default_to_public_inputs(builder);
+        return builder;
+    }
+
+    static void expect_same_precomputed(DeciderProvingKey& computed, DeciderProvingKey& loaded)
+    {
+        for (auto [expected, actual] : zip_view(computed.proving_key.polynomials.get_precomputed(),
+                                                loaded.proving_key.polynomials.get_precomputed())) {
+            EXPECT_EQ(expected, actual);
+        }
+    }
+
+  protected:
+    static void SetUpTestSuite() { bb::srs::init_file_crs_factory(bb::srs::bb_crs_path()); }
+
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / ("bb-precomputed-cache-" + std::to_string(getpid()));
+        cache = std::make_shared<PrecomputedPolynomialCache>(directory);
+        set_precomputed_polynomial_cache(cache);
+    }
+    void TearDown() override
+    {
+        set_precomputed_polynomial_cache(nullptr);
+        std::filesystem::remove_all(directory);
+    }
+
+    std::filesystem::path directory;
+    std::shared_ptr<PrecomputedPolynomialCache> cache;
+};
+
+using FlavorTypes = testing::Types<UltraFlavor, MegaFlavor>;
+TYPED_TEST_SUITE(PrecomputedPolynomialCacheTests, FlavorTypes);
+
+/**
+ * @brief The second proving key of a circuit loads the precomputed polynomials computed for the first one, and proves
+ * correctly with a different witness.
+ */
+TYPED_TEST(PrecomputedPolynomialCacheTests, HitForSameStructure)
+{
+    using Flavor = TypeParam;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+
+    auto first_circuit = TestFixture::construct_circuit(10);
+    auto first_key = std::make_shared<DeciderProvingKey>(first_circuit);
+    EXPECT_EQ(this->cache->get_stats().misses, 1);
+    EXPECT_EQ(this->cache->get_stats().stores, 1);
+
+    auto second_circuit = TestFixture::construct_circuit(10);
+    auto second_key = std::make_shared<DeciderProvingKey>(second_circuit);
+    EXPECT_EQ(this->cache->get_stats().hits, 1);
+    EXPECT_EQ(this->cache->get_stats().stores, 1);
+    TestFixture::expect_same_precomputed(*first_key, *second_key);
+
+    UltraProver_<Flavor> prover(second_key);
+    auto proof = prover.construct_proof();
+    auto verification_key = std::make_shared<typename Flavor::VerificationKey>(second_key->proving_key);
+    UltraVerifier_<Flavor> verifier(verification_key);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+TYPED_TEST(PrecomputedPolynomialCacheTests, MissForDifferentStructure)
+{
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+
+    auto first_circuit = TestFixture::construct_circuit(10);
+    DeciderProvingKey first_key(first_circuit);
+
+    auto second_circuit = TestFixture::construct_circuit(11);
+    DeciderProvingKey second_key(second_circuit);
+    EXPECT_EQ(this->cache->get_stats().hits, 0);
+    EXPECT_EQ(this->cache->get_stats().misses, 2);
+    EXPECT_EQ(this->cache->get_stats().stores, 2);
+}
+
+// Entries that do not match the key they are looked up with are ignored.
+TYPED_TEST(PrecomputedPolynomialCacheTests, IgnoresCorruptEntries)
+{
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+
+    auto first_circuit = TestFixture::construct_circuit(10);
+    DeciderProvingKey first_key(first_circuit);
+    for (const auto& entry : std::filesystem::directory_iterator(this->directory)) {
+        std::filesystem::resize_file(entry.path(), 16);
+    }
+
+    auto second_circuit = TestFixture::construct_circuit(10);
+    DeciderProvingKey second_key(second_circuit);
+    EXPECT_EQ(this->cache->get_stats().hits, 0);
+    EXPECT_EQ(this->cache->get_stats().misses, 2);
+    TestFixture::expect_same_precomputed(first_key, second_key);
+}
+#endif
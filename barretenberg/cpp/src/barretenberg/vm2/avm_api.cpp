@@ -1,6 +1,12 @@
 #include "barretenberg/vm2/avm_api.hpp"
 
+#include <memory>
+#include <span>
+
+#include "barretenberg/vm2/batch_trace_generator.hpp"
+#include "barretenberg/vm2/constraining/wire_commitment_pipeline.hpp"
 #include "barretenberg/vm2/proving_helper.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
 #include "barretenberg/vm2/simulation_helper.hpp"
 #include "barretenberg/vm2/tooling/stats.hpp"
 #include "barretenberg/vm2/tracegen_helper.hpp"
@@ -11,38 +17,82 @@ using namespace bb::avm2::simulation;
 
 std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmAPI::ProvingInputs& inputs)
 {
-    // Simulate.
-    info("Simulating...");
-    AvmSimulationHelper simulation_helper(inputs.hints);
-    auto events = AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate());
+    AvmProvingHelper proving_helper(precomputed_snapshot);
+    tracegen::TraceContainer trace;
+    // The wires are committed to as soon as they are final, while the rest of the trace is generated.
+    constraining::WireCommitmentPipeline wire_commitments(trace, proving_helper.get_commitment_key());
 
-    // Generate trace.
-    info("Generating trace...");
-    AvmTraceGenHelper tracegen_helper;
-    auto trace =
-        AVM_TRACK_TIME_V("tracegen/all", tracegen_helper.generate_trace(std::move(events), inputs.publicInputs));
+    // Simulate and generate trace. Part of the events are processed into the trace while simulating.
+    info("Simulating and generating trace...");
+    AvmSimulationHelper simulation_helper(inputs.hints);
+    AvmTraceGenHelper tracegen_helper(precomputed_snapshot);
+    AVM_TRACK_TIME("simulation_and_tracegen/all",
+                   tracegen_helper.fill_trace_streaming(
+                       trace,
+                       [&](EventBatchSinks& sinks) {
+                           return AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate(sinks));
+                       },
+                       inputs.publicInputs,
+                       [&](std::span<const Column> columns) { wire_commitments.add_columns(columns); }));
 
     // Prove.
     info("Proving...");
-    AvmProvingHelper proving_helper;
-    auto [proof, vk] = AVM_TRACK_TIME_V("proving/all", proving_helper.prove(std::move(trace)));
+    auto [proof, vk] = AVM_TRACK_TIME_V("proving/all", proving_helper.prove(std::move(trace), wire_commitments));
 
     info("Done!");
     return { std::move(proof), std::move(vk) };
 }
 
+std::vector<std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey>> AvmAPI::prove_batch(
+    std::span<const AvmAPI::ProvingInputs> inputs, size_t max_pending_traces)
+{
+    // The precomputed columns and their commitments are computed once for the whole batch.
+    auto batch_precomputed_snapshot =
+        precomputed_snapshot != nullptr ? precomputed_snapshot : PrecomputedSnapshot::build();
+
+    // The txs of a batch often call the same contracts, so their bytecodes are decoded once.
+    auto decoded_bytecode_cache = std::make_shared<DecodedBytecodeCache>();
+    const auto generate_trace = [&](const ProvingInputs& tx_inputs) {
+        AvmSimulationHelper simulation_helper(tx_inputs.hints, decoded_bytecode_cache);
+        AvmTraceGenHelper tracegen_helper(batch_precomputed_snapshot);
+        return AVM_TRACK_TIME_V("simulation_and_tracegen/all",
+                                tracegen_helper.generate_trace_streaming(
+                                    [&](EventBatchSinks& sinks) {
+                                        return AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate(sinks));
+                                    },
+                                    tx_inputs.publicInputs));
+    };
+
+    info("Proving ", inputs.size(), " txs...");
+    BatchTraceGenerator trace_generator(inputs, generate_trace, max_pending_traces);
+    // Each proof already uses all the cores, so they are done one at a time.
+    AvmProvingHelper proving_helper(batch_precomputed_snapshot);
+
+    std::vector<std::pair<AvmProof, AvmVerificationKey>> proofs;
+    proofs.reserve(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        auto trace = AVM_TRACK_TIME_V("simulation_and_tracegen/wait", trace_generator.next());
+        auto proof = AVM_TRACK_TIME_V("proving/all", proving_helper.prove(std::move(trace)));
+        proofs.push_back(std::move(proof));
+        info("Proved tx ", i + 1, "/", inputs.size());
+    }
+
+    info("Done!");
+    return proofs;
+}
+
 bool AvmAPI::check_circuit(const AvmAPI::ProvingInputs& inputs)
 {
-    // Simulate.
-    info("Simulating...");
+    // Simulate and generate trace. Part of the events are processed into the trace while simulating.
+    info("Simulating and generating trace...");
     AvmSimulationHelper simulation_helper(inputs.hints);
-    auto events = AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate());
-
-    // Generate trace.
-    info("Generating trace...");
-    AvmTraceGenHelper tracegen_helper;
-    auto trace =
-        AVM_TRACK_TIME_V("tracegen/all", tracegen_helper.generate_trace(std::move(events), inputs.publicInputs));
+    AvmTraceGenHelper tracegen_helper(precomputed_snapshot);
+    auto trace = AVM_TRACK_TIME_V("simulation_and_tracegen/all",
+                                  tracegen_helper.generate_trace_streaming(
+                                      [&](EventBatchSinks& sinks) {
+                                          return AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate(sinks));
+                                      },
+                                      inputs.publicInputs));
 
     // Check circuit.
     info("Checking circuit...");
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <span>
 #include <tuple>
+#include <vector>
 
 #include "barretenberg/vm2/common/avm_inputs.hpp"
+#include "barretenberg/vm2/precomputed_snapshot.hpp"
 #include "barretenberg/vm2/proving_helper.hpp"
 
 namespace bb::avm2 {
@@ -14,11 +19,24 @@ class AvmAPI {
     using ProvingInputs = AvmProvingInputs;
 
     AvmAPI() = default;
+    // Takes the precomputed columns and their commitments from the snapshot, instead of computing them for every proof.
+    explicit AvmAPI(std::shared_ptr<const PrecomputedSnapshot> precomputed_snapshot)
+        : precomputed_snapshot(std::move(precomputed_snapshot))
+    {}
 
     // NOTE: The public inputs are NOT part of the proof.
     std::pair<AvmProof, AvmVerificationKey> prove(const ProvingInputs& inputs);
+    // Proves independent txs, e.g. the public txs of a block, and returns their proofs in the same order.
+    // The proofs are done one after the other, while the next max_pending_traces txs are simulated and traced in the
+    // background (each pending trace is held in memory). All the txs share the precomputed columns, the commitment key
+    // and the decoded bytecodes.
+    std::vector<std::pair<AvmProof, AvmVerificationKey>> prove_batch(std::span<const ProvingInputs> inputs,
+                                                                     size_t max_pending_traces = 1);
     bool check_circuit(const ProvingInputs& inputs);
     bool verify(const AvmProof& proof, const PublicInputs& pi, const AvmVerificationKey& vk_data);
+
+  private:
+    std::shared_ptr<const PrecomputedSnapshot> precomputed_snapshot;
 };
 
 } // namespace bb::avm2
\ No newline at end of file
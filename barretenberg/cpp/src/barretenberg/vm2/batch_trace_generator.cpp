@@ -0,0 +1,81 @@
+#include "barretenberg/vm2/batch_trace_generator.hpp"
+
+#include <algorithm>
+
+namespace bb::avm2 {
+
+BatchTraceGenerator::BatchTraceGenerator(std::span<const AvmProvingInputs> inputs,
+                                         TraceGenerator generate_trace,
+                                         size_t max_pending_traces)
+    : inputs(inputs)
+    , generate_trace(std::move(generate_trace))
+    , max_pending_traces(std::max<size_t>(max_pending_traces, 1))
+    , traces(inputs.size())
+    , errors(inputs.size())
+{
+    for (size_t i = 0; i < std::min(this->max_pending_traces, inputs.size()); ++i) {
+        threads.emplace_back([this]() { work(); });
+    }
+}
+
+BatchTraceGenerator::~BatchTraceGenerator()
+{
+    {
+        std::unique_lock lock(mutex);
+        stopped = true;
+    }
+    changed.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+tracegen::TraceContainer BatchTraceGenerator::next()
+{
+    std::unique_lock lock(mutex);
+    const size_t i = next_to_consume;
+    changed.wait(lock, [&]() { return traces[i].has_value() || errors[i] != nullptr; });
+    if (errors[i] != nullptr) {
+        std::rethrow_exception(errors[i]);
+    }
+    tracegen::TraceContainer trace = std::move(*traces[i]);
+    traces[i].reset();
+    // The trace is not pending anymore, so the generation of the next tx can start.
+    ++next_to_consume;
+    changed.notify_all();
+    return trace;
+}
+
+void BatchTraceGenerator::work()
+{
+    while (true) {
+        size_t i = 0;
+        {
+            std::unique_lock lock(mutex);
+            changed.wait(lock, [&]() {
+                return stopped || next_to_generate == inputs.size() ||
+                       next_to_generate < next_to_consume + max_pending_traces;
+            });
+            if (stopped || next_to_generate == inputs.size()) {
+                return;
+            }
+            i = next_to_generate++;
+        }
+
+        std::optional<tracegen::TraceContainer> trace;
+        std::exception_ptr error;
+        try {
+            trace = generate_trace(inputs[i]);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        {
+            std::unique_lock lock(mutex);
+            traces[i] = std::move(trace);
+            errors[i] = error;
+        }
+        changed.notify_all();
+    }
+}
+
+} // namespace bb::avm2
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/vm2/common/avm_inputs.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2 {
+
+// Simulates and generates the traces of a batch of txs on background threads, at most max_pending_traces txs ahead of
+// the trace being consumed. The traces are handed over in the order of the txs.
+class BatchTraceGenerator {
+  public:
+    // Generates the trace of one tx. Called concurrently for different txs.
+    using TraceGenerator = std::function<tracegen::TraceContainer(const AvmProvingInputs&)>;
+
+    // The inputs must outlive the generator.
+    BatchTraceGenerator(std::span<const AvmProvingInputs> inputs,
+                        TraceGenerator generate_trace,
+                        size_t max_pending_traces);
+    BatchTraceGenerator(const BatchTraceGenerator&) = delete;
+    BatchTraceGenerator& operator=(const BatchTraceGenerator&) = delete;
+    // Pending txs are dropped. The ones being generated are finished first.
+    ~BatchTraceGenerator();
+
+    // Waits for the trace of the next tx. Rethrows the error of its simulation or tracegen.
+    tracegen::TraceContainer next();
+
+  private:
+    void work();
+
+    const std::span<const AvmProvingInputs> inputs;
+    const TraceGenerator generate_trace;
+    const size_t max_pending_traces;
+
+    std::mutex mutex;
+    // Notified when a trace is generated or consumed, and when stopping.
+    std::condition_variable changed;
+    std::vector<std::optional<tracegen::TraceContainer>> traces;
+    std::vector<std::exception_ptr> errors;
+    size_t next_to_generate = 0;
+    size_t next_to_consume = 0;
+    bool stopped = false;
+    std::vector<std::thread> threads;
+};
+
+} // namespace bb::avm2
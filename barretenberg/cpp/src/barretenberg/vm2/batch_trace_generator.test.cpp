@@ -0,0 +1,146 @@
+#include "barretenberg/vm2/batch_trace_generator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/vm2/generated/columns.hpp"
+
+namespace bb::avm2 {
+namespace {
+
+using tracegen::TraceContainer;
+
+// Traces that record the index of their tx, generated after some jitter so that they finish out of order.
+class BatchTraceGeneratorTest : public ::testing::Test {
+  protected:
+    BatchTraceGeneratorTest()
+        : inputs(NUM_TXS)
+    {}
+
+    size_t index_of(const AvmProvingInputs& tx_inputs) const
+    {
+        return static_cast<size_t>(&tx_inputs - inputs.data());
+    }
+
+    TraceContainer generate(const AvmProvingInputs& tx_inputs)
+    {
+        const size_t i = index_of(tx_inputs);
+        num_started++;
+        std::this_thread::sleep_for(std::chrono::milliseconds((i * 7) % 5));
+        TraceContainer trace;
+        trace.set(Column::execution_sel, 1, i + 1);
+        num_generated++;
+        return trace;
+    }
+
+    BatchTraceGenerator::TraceGenerator generator()
+    {
+        return [this](const AvmProvingInputs& tx_inputs) { return generate(tx_inputs); };
+    }
+
+    static uint64_t index_of(const TraceContainer& trace)
+    {
+        return static_cast<uint64_t>(trace.get(Column::execution_sel, 1)) - 1;
+    }
+
+    // Waits until the generation of the given number of txs has started, and gives the others time to (wrongly)
+    // start too.
+    void wait_for_started(size_t expected) const
+    {
+        for (size_t i = 0; i < 1000 && num_started < expected; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    static constexpr size_t NUM_TXS = 8;
+    std::vector<AvmProvingInputs> inputs;
+    std::atomic<size_t> num_started = 0;
+    std::atomic<size_t> num_generated = 0;
+};
+
+TEST_F(BatchTraceGeneratorTest, HandsOverTracesInOrder)
+{
+    for (size_t max_pending_traces : { size_t(1), size_t(3), NUM_TXS + 1 }) {
+        BatchTraceGenerator trace_generator(inputs, generator(), max_pending_traces);
+        for (size_t i = 0; i < NUM_TXS; ++i) {
+            EXPECT_EQ(index_of(trace_generator.next()), i);
+        }
+    }
+}
+
+TEST_F(BatchTraceGeneratorTest, BoundsPendingTraces)
+{
+    const size_t max_pending_traces = 3;
+    BatchTraceGenerator trace_generator(inputs, generator(), max_pending_traces);
+    wait_for_started(max_pending_traces);
+    EXPECT_EQ(num_started, max_pending_traces);
+
+    // Every consumed trace lets the generation of one more tx start.
+    for (size_t i = 0; i < NUM_TXS; ++i) {
+        EXPECT_EQ(index_of(trace_generator.next()), i);
+        const size_t expected = std::min(NUM_TXS, i + 1 + max_pending_traces);
+        wait_for_started(expected);
+        EXPECT_EQ(num_started, expected);
+    }
+}
+
+TEST_F(BatchTraceGeneratorTest, RethrowsAtTheFailingTx)
+{
+    const size_t failing_tx = 2;
+    BatchTraceGenerator trace_generator(
+        inputs,
+        [&](const AvmProvingInputs& tx_inputs) {
+            if (index_of(tx_inputs) == failing_tx) {
+                throw std::runtime_error("simulation failed");
+            }
+            return generate(tx_inputs);
+        },
+        /*max_pending_traces=*/4);
+
+    for (size_t i = 0; i < failing_tx; ++i) {
+        EXPECT_EQ(index_of(trace_generator.next()), i);
+    }
+    EXPECT_THROW(
+        {
+            try {
+                trace_generator.next();
+            } catch (const std::runtime_error& e) {
+                EXPECT_STREQ(e.what(), "simulation failed");
+                throw;
+            }
+        },
+        std::runtime_error);
+}
+
+TEST_F(BatchTraceGeneratorTest, DropsPendingTxsOnDestruction)
+{
+    {
+        BatchTraceGenerator trace_generator(inputs, generator(), /*max_pending_traces=*/2);
+        EXPECT_EQ(index_of(trace_generator.next()), 0);
+        // Destroyed while the next txs are being generated or waiting.
+    }
+    // The txs that were started are finished, the rest are never started.
+    EXPECT_EQ(num_generated, num_started);
+    EXPECT_LE(num_started, 3);
+
+    // Also when nothing was consumed.
+    {
+        BatchTraceGenerator trace_generator(inputs, generator(), /*max_pending_traces=*/2);
+    }
+    EXPECT_EQ(num_generated, num_started);
+}
+
+TEST_F(BatchTraceGeneratorTest, EmptyBatch)
+{
+    BatchTraceGenerator trace_generator({}, generator(), /*max_pending_traces=*/2);
+}
+
+} // namespace
+} // namespace bb::avm2
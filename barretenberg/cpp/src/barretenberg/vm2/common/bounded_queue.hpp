@@ -0,0 +1,65 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace bb::avm2 {
+
+// A multi-producer multi-consumer FIFO queue with a maximum size.
+// Producers block while the queue is full, which bounds the memory held by items in flight.
+// Consumers block until an item is available or the queue is closed and drained.
+template <typename T> class BoundedQueue {
+  public:
+    explicit BoundedQueue(size_t capacity)
+        : capacity(capacity)
+    {}
+
+    // Returns false (and drops the item) if the queue has been closed.
+    bool push(T&& item)
+    {
+        std::unique_lock lock(mutex);
+        not_full.wait(lock, [&] { return closed || items.size() < capacity; });
+        if (closed) {
+            return false;
+        }
+        items.push_back(std::move(item));
+        not_empty.notify_one();
+        return true;
+    }
+
+    // Returns std::nullopt once the queue is closed and there are no items left.
+    std::optional<T> pop()
+    {
+        std::unique_lock lock(mutex);
+        not_empty.wait(lock, [&] { return closed || !items.empty(); });
+        if (items.empty()) {
+            return std::nullopt;
+        }
+        T item = std::move(items.front());
+        items.pop_front();
+        not_full.notify_one();
+        return item;
+    }
+
+    // No more items will be pushed. Items already in the queue can still be popped.
+    void close()
+    {
+        std::unique_lock lock(mutex);
+        closed = true;
+        not_empty.notify_all();
+        not_full.notify_all();
+    }
+
+  private:
+    const size_t capacity;
+    bool closed = false;
+    std::deque<T> items;
+    std::mutex mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+};
+
+} // namespace bb::avm2
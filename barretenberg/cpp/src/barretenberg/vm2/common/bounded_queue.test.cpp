@@ -0,0 +1,51 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "barretenberg/vm2/common/bounded_queue.hpp"
+
+namespace bb::avm2 {
+namespace {
+
+TEST(BoundedQueueTest, PopsInOrderAndEndsWhenClosed)
+{
+    BoundedQueue<int> queue(4);
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+    queue.close();
+
+    // Items pushed before closing can still be popped.
+    EXPECT_EQ(queue.pop(), 1);
+    EXPECT_EQ(queue.pop(), 2);
+    EXPECT_EQ(queue.pop(), std::nullopt);
+    EXPECT_FALSE(queue.push(3));
+}
+
+TEST(BoundedQueueTest, ProducerAndConsumerThreads)
+{
+    BoundedQueue<std::vector<int>> queue(2);
+    const int num_items = 1000;
+
+    std::thread producer([&]() {
+        for (int i = 0; i < num_items; ++i) {
+            queue.push({ i });
+        }
+        queue.close();
+    });
+
+    std::vector<int> consumed;
+    while (auto item = queue.pop()) {
+        consumed.push_back(item->at(0));
+    }
+    producer.join();
+
+    ASSERT_EQ(consumed.size(), num_items);
+    for (int i = 0; i < num_items; ++i) {
+        EXPECT_EQ(consumed[static_cast<size_t>(i)], i);
+    }
+}
+
+} // namespace
+} // namespace bb::avm2
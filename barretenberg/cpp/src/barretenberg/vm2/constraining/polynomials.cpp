@@ -1,5 +1,6 @@
 #include "barretenberg/vm2/constraining/polynomials.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 #include "barretenberg/common/thread.hpp"
@@ -8,11 +9,49 @@
 #include "barretenberg/vm2/tooling/stats.hpp"
 
 namespace bb::avm2::constraining {
+namespace {
 
-AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace)
+bool is_to_be_shifted(Column col)
+{
+    return std::ranges::find(TO_BE_SHIFTED_COLUMNS_ARRAY, col) != TO_BE_SHIFTED_COLUMNS_ARRAY.end();
+}
+
+// Since we are shifting, we need to allocate one less row. The first row is always zero.
+uint32_t get_shiftable_size(uint32_t num_rows)
+{
+    return num_rows > 0 ? num_rows - 1 : 0;
+}
+
+// Dense columns are handed over without copying, skipping the (zero) first row.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+AvmProver::Polynomial make_shiftable_polynomial(const std::shared_ptr<AvmProver::FF[]>& memory, uint32_t num_rows)
+{
+    ASSERT(memory[0].is_zero());
+    return AvmProver::Polynomial(std::shared_ptr<AvmProver::FF[]>(memory, memory.get() + 1), // NOLINT
+                                 /*memory size*/ get_shiftable_size(num_rows),
+                                 /*largest possible index*/ CIRCUIT_SUBGROUP_SIZE,
+                                 /*make shiftable with offset*/ 1);
+}
+
+} // namespace
+
+AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace,
+                                                 ColumnPolynomials&& column_polynomials)
 {
     AvmProver::ProverPolynomials polys;
 
+    // The polynomials computed beforehand are moved in, and their columns are freed.
+    // They are skipped below, as they are not empty anymore.
+    {
+        auto unshifted = polys.get_unshifted();
+        for (size_t i = 0; i < column_polynomials.size(); i++) {
+            if (column_polynomials[i].has_value()) {
+                unshifted[i] = std::move(*column_polynomials[i]);
+                trace.clear_column(static_cast<Column>(i));
+            }
+        }
+    }
+
     // Polynomials that will be shifted need special care.
     AVM_TRACK_TIME("proving/init_polys_to_be_shifted", ({
                        auto to_be_shifted = polys.get_to_be_shifted();
@@ -20,15 +59,20 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
                        // NOTE: we can't parallelize because Polynomial construction uses parallelism.
                        for (size_t i = 0; i < to_be_shifted.size(); i++) {
                            auto& poly = to_be_shifted[i];
+                           if (poly.virtual_size() > 0) {
+                               // Given above.
+                               continue;
+                           }
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(TO_BE_SHIFTED_COLUMNS_ARRAY.at(i));
                            uint32_t num_rows = trace.get_column_rows(col);
-                           // Since we are shifting, we need to allocate one less row.
-                           // The first row is always zero.
-                           uint32_t allocated_size = num_rows > 0 ? num_rows - 1 : 0;
 
+                           if (auto memory = trace.release_dense_column(col); memory != nullptr) {
+                               poly = make_shiftable_polynomial(memory, num_rows);
+                               continue;
+                           }
                            poly = AvmProver::Polynomial(
-                               /*memory size*/ allocated_size,
+                               /*memory size*/ get_shiftable_size(num_rows),
                                /*largest possible index*/ CIRCUIT_SUBGROUP_SIZE,
                                /*make shiftable with offset*/ 1);
                        }
@@ -55,12 +99,17 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(i);
                            const auto num_rows = trace.get_column_rows(col);
+                           if (auto memory = trace.release_dense_column(col); memory != nullptr) {
+                               poly = AvmProver::Polynomial(std::move(memory), num_rows, CIRCUIT_SUBGROUP_SIZE);
+                               return;
+                           }
                            poly = AvmProver::Polynomial::create_non_parallel_zero_init(num_rows, CIRCUIT_SUBGROUP_SIZE);
                        });
                    }));
 
     AVM_TRACK_TIME("proving/set_polys_unshifted", ({
                        auto unshifted = polys.get_unshifted();
+                       // Only sparse columns are left in the trace at this point, dense ones were handed over above.
                        // TODO: We are now visiting per-column. Profile if per-row is better.
                        // This would need changes to the trace container.
                        bb::parallel_for(unshifted.size(), [&](size_t i) {
@@ -87,4 +136,19 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
     return polys;
 }
 
+AvmProver::Polynomial compute_polynomial(const tracegen::TraceContainer& trace, Column col)
+{
+    const uint32_t num_rows = trace.get_column_rows(col);
+    const bool shiftable = is_to_be_shifted(col);
+    if (auto memory = trace.share_dense_column(col); memory != nullptr) {
+        return shiftable ? make_shiftable_polynomial(memory, num_rows)
+                         : AvmProver::Polynomial(std::move(memory), num_rows, CIRCUIT_SUBGROUP_SIZE);
+    }
+
+    auto poly = shiftable ? AvmProver::Polynomial(get_shiftable_size(num_rows), CIRCUIT_SUBGROUP_SIZE, 1)
+                          : AvmProver::Polynomial::create_non_parallel_zero_init(num_rows, CIRCUIT_SUBGROUP_SIZE);
+    trace.visit_column(col, [&](size_t row, const AvmProver::FF& value) { poly.at(row) = value; });
+    return poly;
+}
+
 } // namespace bb::avm2::constraining
@@ -1,11 +1,25 @@
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "barretenberg/vm2/constraining/prover.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
 namespace bb::avm2::constraining {
 
+// Polynomials of some of the columns, computed ahead of compute_polynomials. Indexed by column.
+using ColumnPolynomials = std::vector<std::optional<AvmProver::Polynomial>>;
+
 // Computes the polynomials from the trace, and destroys it in the process.
-AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace);
+// The memory of dense trace columns is moved into the polynomials without copying.
+// The columns whose polynomial is given are not read again, only cleared.
+AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace,
+                                                 ColumnPolynomials&& column_polynomials = {});
+
+// Computes the polynomial of a single column, leaving the trace untouched. The memory of a dense column is shared with
+// the trace, so the column must not be written anymore.
+AvmProver::Polynomial compute_polynomial(const tracegen::TraceContainer& trace, Column col);
 
 } // namespace bb::avm2::constraining
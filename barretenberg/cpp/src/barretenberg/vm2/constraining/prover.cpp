@@ -51,6 +51,14 @@ void AvmProver::execute_wire_commitments_round()
     // logderivative phase)
     auto wire_polys = prover_polynomials.get_wires();
     const auto& labels = prover_polynomials.get_wires_labels();
+    if (!wire_commitments.empty()) {
+        // Already computed, we only send them (in the same order).
+        ASSERT(wire_commitments.size() == wire_polys.size());
+        for (size_t idx = 0; idx < wire_commitments.size(); ++idx) {
+            transcript->send_to_verifier(labels[idx], wire_commitments[idx]);
+        }
+        return;
+    }
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
         transcript->send_to_verifier(labels[idx], commitment_key->commit(wire_polys[idx]));
     }
@@ -50,6 +50,10 @@ class AvmProver {
 
     typename Flavor::WitnessCommitments witness_commitments;
 
+    // Commitments to the wires (in the order of get_wires), if they were computed before proving, e.g. while the trace
+    // was generated. Otherwise, the wires are committed to in execute_wire_commitments_round.
+    std::vector<typename Flavor::Commitment> wire_commitments;
+
     Polynomial quotient_W;
 
     SumcheckOutput<Flavor> sumcheck_output;
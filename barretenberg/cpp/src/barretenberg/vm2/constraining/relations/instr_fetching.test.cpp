@@ -611,7 +611,6 @@ TEST(InstrFetchingConstrainingTest, DISABLED_NegativeWrongWireInstructionSpecInt
 TEST(InstrFetchingConstrainingTest, NegativeWrongBcDecompositionInteractions)
 {
     TestTraceContainer trace;
-    BytecodeTraceBuilder bytecode_builder;
 
     // Some arbitrary chosen opcodes. We limit to one as this unit test is costly.
     // Test works if the following vector is extended to other opcodes though.
@@ -619,6 +618,8 @@ TEST(InstrFetchingConstrainingTest, NegativeWrongBcDecompositionInteractions)
 
     for (const auto& opcode : opcodes) {
         TestTraceContainer trace;
+        // Builders append rows across calls, so each trace needs its own.
+        BytecodeTraceBuilder bytecode_builder;
         const auto instr = testing::random_instruction(opcode);
         auto bytecode_ptr = std::make_shared<std::vector<uint8_t>>(instr.serialize());
         bytecode_builder.process_instruction_fetching({ {
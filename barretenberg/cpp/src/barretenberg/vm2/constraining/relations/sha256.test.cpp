@@ -115,7 +115,7 @@ TEST(Sha256ConstrainingTest, Interaction)
     precomputed_builder.process_misc(trace, 65);
     precomputed_builder.process_sha256_round_constants(trace);
 
-    builder.process(sha256_event_emitter.get_events());
+    builder.process(sha256_event_emitter.dump_events());
     LookupIntoIndexedByClk<lookup_sha256_round_relation::Settings>().process(trace);
 
     check_relation<sha256>(trace);
@@ -0,0 +1,127 @@
+#include "barretenberg/vm2/constraining/wire_commitment_pipeline.hpp"
+
+#include <limits>
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/tooling/stats.hpp"
+
+namespace bb::avm2::constraining {
+namespace {
+
+// The wires follow the precomputed columns (see AvmFlavor::AllEntities::get_unshifted).
+constexpr size_t FIRST_WIRE = AvmFlavor::NUM_PRECOMPUTED_ENTITIES;
+
+} // namespace
+
+WireCommitmentPipeline::WireCommitmentPipeline(const tracegen::TraceContainer& trace,
+                                               std::shared_ptr<AvmProver::PCSCommitmentKey> commitment_key)
+    : trace(trace)
+    , commitment_key(std::move(commitment_key))
+    , num_wires(AvmProver::ProverPolynomials::get_wires_labels().size())
+    , queue(std::numeric_limits<size_t>::max())
+    , added(num_wires)
+    , polynomials(FIRST_WIRE + num_wires)
+    , commitments(num_wires)
+{
+    ASSERT(AvmProver::ProverPolynomials::get_wires_labels().front() == COLUMN_NAMES.at(FIRST_WIRE));
+    ASSERT(AvmProver::ProverPolynomials::get_wires_labels().back() == COLUMN_NAMES.at(FIRST_WIRE + num_wires - 1));
+#ifndef NO_MULTITHREADING
+    thread = std::thread([this]() { consume(); });
+#endif
+}
+
+WireCommitmentPipeline::~WireCommitmentPipeline()
+{
+    cancelled = true;
+    join();
+}
+
+void WireCommitmentPipeline::add_columns(std::span<const Column> columns)
+{
+#ifdef NO_MULTITHREADING
+    process_group(std::vector<Column>(columns.begin(), columns.end()));
+#else
+    queue.push(std::vector<Column>(columns.begin(), columns.end()));
+#endif
+}
+
+WireCommitmentPipeline::Result WireCommitmentPipeline::finish()
+{
+    join();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    std::vector<Column> all_wires;
+    all_wires.reserve(num_wires);
+    for (size_t i = 0; i < num_wires; ++i) {
+        all_wires.push_back(static_cast<Column>(FIRST_WIRE + i));
+    }
+    AVM_TRACK_TIME("proving/wire_commitments/remaining", process(all_wires));
+
+    Result result{ .polynomials = std::move(polynomials), .commitments = {} };
+    result.commitments.reserve(num_wires);
+    for (const auto& commitment : commitments) {
+        result.commitments.push_back(*commitment);
+    }
+    return result;
+}
+
+void WireCommitmentPipeline::consume()
+{
+    while (auto columns = queue.pop()) {
+        // On error, we keep draining the queue so that the producers do not block.
+        if (!error && !cancelled) {
+            process_group(*columns);
+        }
+    }
+}
+
+void WireCommitmentPipeline::process_group(const std::vector<Column>& columns)
+{
+    try {
+        AVM_TRACK_TIME("proving/wire_commitments/pipelined", process(columns));
+    } catch (...) {
+        error = std::current_exception();
+    }
+}
+
+void WireCommitmentPipeline::process(const std::vector<Column>& columns)
+{
+    std::vector<Column> wires;
+    for (const Column col : columns) {
+        const auto i = static_cast<size_t>(col);
+        if (i < FIRST_WIRE || i >= FIRST_WIRE + num_wires || added[i - FIRST_WIRE]) {
+            continue;
+        }
+        added[i - FIRST_WIRE] = true;
+        wires.push_back(col);
+    }
+    if (wires.empty()) {
+        return;
+    }
+
+    parallel_for(wires.size(), [&](size_t i) {
+        polynomials[static_cast<size_t>(wires[i])] = compute_polynomial(trace, wires[i]);
+    });
+    std::vector<PolynomialSpan<const AvmProver::FF>> spans;
+    spans.reserve(wires.size());
+    for (const Column col : wires) {
+        spans.emplace_back(*polynomials[static_cast<size_t>(col)]);
+    }
+    const auto group_commitments = commitment_key->batch_commit(spans);
+    for (size_t i = 0; i < wires.size(); ++i) {
+        commitments[static_cast<size_t>(wires[i]) - FIRST_WIRE] = group_commitments[i];
+    }
+}
+
+void WireCommitmentPipeline::join()
+{
+    queue.close();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+} // namespace bb::avm2::constraining
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/vm2/common/bounded_queue.hpp"
+#include "barretenberg/vm2/constraining/polynomials.hpp"
+#include "barretenberg/vm2/constraining/prover.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::constraining {
+
+// Commits to the wires of a trace while the trace is still being generated. Columns are added as soon as they are
+// final (nothing writes them anymore, but they can still be read), and each group of added columns is converted into
+// polynomials and committed to on a background thread. The prover then only has to send the commitments, in the usual
+// order (see AvmProver::execute_wire_commitments_round).
+class WireCommitmentPipeline {
+  public:
+    using Commitment = AvmProver::Flavor::Commitment;
+
+    struct Result {
+        // The polynomials of the wires, to be moved into compute_polynomials.
+        ColumnPolynomials polynomials;
+        // In the order of the wires.
+        std::vector<Commitment> commitments;
+    };
+
+    // The trace must outlive the pipeline. The commitment key must not be used by anyone else until finish().
+    WireCommitmentPipeline(const tracegen::TraceContainer& trace,
+                           std::shared_ptr<AvmProver::PCSCommitmentKey> commitment_key);
+    WireCommitmentPipeline(const WireCommitmentPipeline&) = delete;
+    WireCommitmentPipeline& operator=(const WireCommitmentPipeline&) = delete;
+    // Drops the columns that are still pending.
+    ~WireCommitmentPipeline();
+
+    // Can be called concurrently. Columns that are not wires, or that were already added, are ignored.
+    void add_columns(std::span<const Column> columns);
+    // Commits to the wires that were not added (so the whole trace must be final by now), and waits for all the
+    // commitments. Rethrows the first error found while committing.
+    Result finish();
+
+  private:
+    void consume();
+    void process_group(const std::vector<Column>& columns);
+    void process(const std::vector<Column>& columns);
+    void join();
+
+    const tracegen::TraceContainer& trace;
+    const std::shared_ptr<AvmProver::PCSCommitmentKey> commitment_key;
+    const size_t num_wires;
+    // There are few groups and they are small, so producers never wait for the queue in practice.
+    BoundedQueue<std::vector<Column>> queue;
+    std::atomic<bool> cancelled = false;
+    // Only used by the consumer until it is joined.
+    std::vector<bool> added;
+    ColumnPolynomials polynomials;
+    std::vector<std::optional<Commitment>> commitments;
+    std::exception_ptr error;
+    std::thread thread;
+};
+
+} // namespace bb::avm2::constraining
@@ -0,0 +1,72 @@
+#include "barretenberg/vm2/constraining/wire_commitment_pipeline.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/constraining/polynomials.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::constraining {
+namespace {
+
+using tracegen::TraceContainer;
+using C = Column;
+
+// Dense and sparse columns, with and without shifts.
+TraceContainer make_trace()
+{
+    TraceContainer trace;
+    trace.reserve_column(C::execution_sel, 1 << 12);
+    trace.reserve_column(C::bc_decomposition_bytes, 1 << 12);
+    for (uint32_t row = 1; row < 3000; ++row) {
+        trace.set(C::execution_sel, row, 1);
+        trace.set(C::bc_decomposition_bytes, row, row % 256);
+    }
+    trace.set(C::alu_ia, 7, 42);
+    trace.set(C::alu_ia, 1000, 43);
+    trace.set(C::bc_decomposition_bytes_pc_plus_1, 5, 17);
+    trace.set(C::precomputed_clk, 3, 3);
+    return trace;
+}
+
+TEST(WireCommitmentPipelineTest, CommitsAsTheProver)
+{
+    bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
+    auto commitment_key = std::make_shared<AvmProver::PCSCommitmentKey>(CIRCUIT_SUBGROUP_SIZE);
+
+    TraceContainer expected_trace = make_trace();
+    auto expected_polys = compute_polynomials(expected_trace);
+
+    TraceContainer trace = make_trace();
+    WireCommitmentPipeline pipeline(trace, commitment_key);
+    // Non-wires and repeated columns are ignored. The rest of the wires are committed to by finish().
+    pipeline.add_columns(std::vector<Column>{ C::alu_ia, C::precomputed_clk, C::bc_decomposition_bytes });
+    pipeline.add_columns(std::vector<Column>{ C::alu_ia, C::bc_decomposition_bytes_pc_plus_1 });
+    // The added columns can still be read.
+    EXPECT_EQ(trace.get(C::bc_decomposition_bytes, 300), 300 % 256);
+    auto result = pipeline.finish();
+    auto polys = compute_polynomials(trace, std::move(result.polynomials));
+
+    auto wires = expected_polys.get_wires();
+    ASSERT_EQ(result.commitments.size(), wires.size());
+    for (size_t i = 0; i < wires.size(); ++i) {
+        EXPECT_EQ(result.commitments[i], commitment_key->commit(wires[i])) << expected_polys.get_wires_labels()[i];
+    }
+    for (const auto col : { ColumnAndShifts::execution_sel,
+                            ColumnAndShifts::bc_decomposition_bytes,
+                            ColumnAndShifts::bc_decomposition_bytes_shift,
+                            ColumnAndShifts::alu_ia,
+                            ColumnAndShifts::bc_decomposition_bytes_pc_plus_1_shift,
+                            ColumnAndShifts::precomputed_clk }) {
+        EXPECT_EQ(polys.get(col), expected_polys.get(col)) << COLUMN_NAMES[static_cast<size_t>(col)];
+    }
+}
+
+} // namespace
+} // namespace bb::avm2::constraining
@@ -0,0 +1,281 @@
+#include "barretenberg/vm2/precomputed_snapshot.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/constraining/prover.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tooling/stats.hpp"
+#include "barretenberg/vm2/tracegen/precomputed_trace.hpp"
+#include "barretenberg/vm2/tracegen_helper.hpp"
+
+namespace bb::avm2 {
+namespace {
+
+using tracegen::TraceContainer;
+
+constexpr std::array<char, 8> MAGIC = { 'A', 'V', 'M', '2', 'P', 'R', 'E', 'C' };
+constexpr uint64_t FORMAT_VERSION = 2;
+// The columns are aligned in the file so that they can be mapped with any page size up to 64KiB.
+constexpr size_t COLUMN_ALIGNMENT = 1 << 16;
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    uint64_t format_version;
+    uint64_t fingerprint;
+    // Checked on load. Unlike the columns, the commitments have no hash pinned in the binary.
+    uint64_t commitments_hash;
+    std::array<uint64_t, PrecomputedSnapshot::NUM_COLUMNS> num_rows;
+    // Position of the values of each column in the file.
+    std::array<uint64_t, PrecomputedSnapshot::NUM_COLUMNS> offsets;
+    PrecomputedSnapshot::Commitments commitments;
+};
+static_assert(std::is_trivially_copyable_v<FileHeader>);
+
+constexpr uint64_t align_column(uint64_t num_bytes)
+{
+    return (num_bytes + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT * COLUMN_ALIGNMENT;
+}
+
+// FNV-1a, which unlike std::hash gives the same result in every build.
+class Fnv1a {
+  public:
+    void absorb(uint64_t word)
+    {
+        hash ^= word;
+        hash *= PRIME;
+    }
+    void absorb(std::string_view bytes)
+    {
+        for (char byte : bytes) {
+            absorb(static_cast<uint8_t>(byte));
+        }
+        absorb(0xff);
+    }
+    uint64_t get() const { return hash; }
+
+  private:
+    static constexpr uint64_t PRIME = 1099511628211ULL;
+    uint64_t hash = 14695981039346656037ULL;
+};
+
+uint64_t hash_commitments(const PrecomputedSnapshot::Commitments& commitments)
+{
+    Fnv1a hash;
+    for (const auto& commitment : commitments) {
+        for (const uint64_t limb : commitment.x.data) {
+            hash.absorb(limb);
+        }
+        for (const uint64_t limb : commitment.y.data) {
+            hash.absorb(limb);
+        }
+    }
+    return hash.get();
+}
+
+} // namespace
+
+uint64_t PrecomputedSnapshot::get_fingerprint()
+{
+    Fnv1a hash;
+    for (const auto& column_name : COLUMN_NAMES) {
+        hash.absorb(std::string_view(column_name));
+    }
+    hash.absorb(std::to_string(NUM_COLUMNS));
+    hash.absorb(std::to_string(CIRCUIT_SUBGROUP_SIZE));
+    hash.absorb(std::to_string(tracegen::PRECOMPUTED_TRACE_HASH));
+    return hash.get();
+}
+
+uint64_t PrecomputedSnapshot::get_content_hash() const
+{
+    Fnv1a hash;
+    for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+        hash.absorb(num_rows[i]);
+        const FF* values = columns[i].get();
+        for (size_t row = 0; row < num_rows[i]; ++row) {
+            // The values are hashed in Montgomery form, which is the same in every build.
+            for (const uint64_t limb : values[row].data) {
+                hash.absorb(limb);
+            }
+        }
+    }
+    return hash.get();
+}
+
+std::shared_ptr<const PrecomputedSnapshot> PrecomputedSnapshot::build()
+{
+#ifdef __wasm__
+    throw std::runtime_error("Precomputed snapshots are not supported in WASM");
+#else
+    auto trace = AVM_TRACK_TIME_V("precomputed_snapshot/tracegen", AvmTraceGenHelper().generate_precomputed_columns());
+
+    std::shared_ptr<PrecomputedSnapshot> snapshot(new PrecomputedSnapshot());
+    std::vector<AvmFlavor::Polynomial> polynomials(NUM_COLUMNS);
+    for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+        const auto col = static_cast<Column>(i);
+        snapshot->num_rows[i] = trace.get_column_rows(col);
+        // Sparse columns are made dense, so that all the columns are shared in the same way.
+        trace.reserve_column(col, std::max<size_t>(snapshot->num_rows[i], TraceContainer::MIN_DENSE_COLUMN_VALUES));
+        snapshot->columns[i] = trace.release_dense_column(col);
+        if (snapshot->columns[i] == nullptr) {
+            throw std::runtime_error("Failed to allocate precomputed column " + COLUMN_NAMES.at(i));
+        }
+        polynomials[i] = AvmFlavor::Polynomial(snapshot->columns[i], snapshot->num_rows[i], CIRCUIT_SUBGROUP_SIZE);
+    }
+
+    AvmProver::PCSCommitmentKey commitment_key(CIRCUIT_SUBGROUP_SIZE);
+    std::vector<PolynomialSpan<const FF>> spans(polynomials.begin(), polynomials.end());
+    const auto commitments = AVM_TRACK_TIME_V("precomputed_snapshot/commit", commitment_key.batch_commit(spans));
+    std::copy(commitments.begin(), commitments.end(), snapshot->commitments.begin());
+
+    // The columns are shared by all the traces filled from the snapshot, so any write to them is a bug.
+    for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+        if (mprotect(snapshot->columns[i].get(), snapshot->num_rows[i] * sizeof(FF), PROT_READ) != 0) {
+            throw std::runtime_error("Failed to protect precomputed column " + COLUMN_NAMES.at(i) + ": " +
+                                     std::strerror(errno));
+        }
+    }
+    return snapshot;
+#endif
+}
+
+void PrecomputedSnapshot::write(const std::filesystem::path& path) const
+{
+    FileHeader header{ .magic = MAGIC,
+                       .format_version = FORMAT_VERSION,
+                       .fingerprint = get_fingerprint(),
+                       .commitments_hash = hash_commitments(commitments),
+                       .num_rows = {},
+                       .offsets = {},
+                       .commitments = commitments };
+    uint64_t offset = align_column(sizeof(FileHeader));
+    for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+        header.num_rows[i] = num_rows[i];
+        header.offsets[i] = offset;
+        offset += align_column(num_rows[i] * sizeof(FF));
+    }
+
+    // The snapshot is written to a temporary file first, so that it is never loaded partially written.
+    std::filesystem::path tmp_path = path;
+    tmp_path += ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+        for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+            file.seekp(static_cast<std::streamoff>(header.offsets[i]));
+            file.write(reinterpret_cast<const char*>(columns[i].get()),
+                       static_cast<std::streamsize>(num_rows[i] * sizeof(FF)));
+        }
+        if (!file) {
+            throw std::runtime_error("Failed to write precomputed snapshot " + tmp_path.string());
+        }
+    }
+    // Columns are mapped in multiples of the alignment, which must be within the file.
+    std::filesystem::resize_file(tmp_path, offset);
+    std::filesystem::rename(tmp_path, path);
+}
+
+std::shared_ptr<const PrecomputedSnapshot> PrecomputedSnapshot::load(const std::filesystem::path& path)
+{
+#ifdef __wasm__
+    throw std::runtime_error("Precomputed snapshots are not supported in WASM");
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open precomputed snapshot " + path.string() + ": " + std::strerror(errno));
+    }
+    // The mappings stay valid once the file is closed.
+    std::unique_ptr<const int, void (*)(const int*)> fd_guard(&fd, [](const int* fd) { close(*fd); });
+
+    FileHeader header;
+    struct stat file_stat;
+    if (pread(fd, &header, sizeof(FileHeader), 0) != static_cast<ssize_t>(sizeof(FileHeader)) ||
+        header.magic != MAGIC || fstat(fd, &file_stat) != 0) {
+        throw std::runtime_error(path.string() + " is not a precomputed snapshot");
+    }
+    if (header.format_version != FORMAT_VERSION || header.fingerprint != get_fingerprint()) {
+        throw std::runtime_error("Precomputed snapshot " + path.string() + " was built for another circuit");
+    }
+    for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+        if (header.num_rows[i] > TraceContainer::DENSE_COLUMN_CAPACITY || header.offsets[i] % COLUMN_ALIGNMENT != 0 ||
+            header.offsets[i] + align_column(header.num_rows[i] * sizeof(FF)) >
+                static_cast<uint64_t>(file_stat.st_size)) {
+            throw std::runtime_error("Precomputed snapshot " + path.string() + " is corrupted");
+        }
+    }
+
+    // Every column is mapped at the start of a zero-filled region of at least one row.
+    std::array<uint64_t, NUM_COLUMNS> region_offsets{};
+    size_t num_bytes = 0;
+    for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+        region_offsets[i] = num_bytes;
+        num_bytes += align_column(std::max<uint64_t>(header.num_rows[i], 1) * sizeof(FF));
+    }
+    void* mapping = mmap(nullptr, num_bytes, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error(std::string("Failed to map precomputed snapshot: ") + std::strerror(errno));
+    }
+    std::shared_ptr<FF> memory(static_cast<FF*>(mapping), [num_bytes](FF* ptr) { munmap(ptr, num_bytes); });
+
+    std::shared_ptr<PrecomputedSnapshot> snapshot(new PrecomputedSnapshot());
+    for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+        FF* column = memory.get() + (region_offsets[i] / sizeof(FF));
+        const uint64_t column_bytes = align_column(header.num_rows[i] * sizeof(FF));
+        if (column_bytes > 0 && mmap(column,
+                                     column_bytes,
+                                     PROT_READ,
+                                     MAP_PRIVATE | MAP_FIXED,
+                                     fd,
+                                     static_cast<off_t>(header.offsets[i])) == MAP_FAILED) {
+            throw std::runtime_error(std::string("Failed to map precomputed snapshot: ") + std::strerror(errno));
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        snapshot->columns[i] = std::shared_ptr<FF[]>(memory, column);
+        snapshot->num_rows[i] = static_cast<uint32_t>(header.num_rows[i]);
+    }
+    snapshot->commitments = header.commitments;
+    if (hash_commitments(snapshot->commitments) != header.commitments_hash ||
+        snapshot->get_content_hash() != tracegen::PRECOMPUTED_TRACE_HASH) {
+        throw std::runtime_error("Precomputed snapshot " + path.string() + " is corrupted");
+    }
+    return snapshot;
+#endif
+}
+
+std::shared_ptr<const PrecomputedSnapshot> PrecomputedSnapshot::load_or_build(const std::filesystem::path& path)
+{
+    if (std::filesystem::exists(path)) {
+        try {
+            return AVM_TRACK_TIME_V("precomputed_snapshot/load", load(path));
+        } catch (const std::runtime_error& e) {
+            info("Rebuilding precomputed snapshot: ", e.what());
+        }
+    }
+    auto snapshot = build();
+    snapshot->write(path);
+    return snapshot;
+}
+
+void PrecomputedSnapshot::fill_trace(TraceContainer& trace) const
+{
+    for (size_t i = 0; i < NUM_COLUMNS; ++i) {
+        trace.set_dense_column(static_cast<Column>(i), columns[i], num_rows[i]);
+    }
+}
+
+} // namespace bb::avm2
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+#include "barretenberg/vm2/constraining/flavor.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2 {
+
+/**
+ * @brief The precomputed columns of the AVM circuit and their commitments, which are the same for every proof.
+ * @details A snapshot is built once, by generating the columns and committing to them, and can be written to disk.
+ * Loading it maps the columns from the file: all the traces filled from a snapshot share its (read-only) memory, and
+ * the prover takes the commitments from the snapshot instead of committing to the columns again.
+ *
+ * The file records a fingerprint of the compiled circuit (its columns and size, and the hash of the precomputed
+ * columns) and is rejected if it does not match the one of the binary. The hash is pinned in the binary (see
+ * tracegen::PRECOMPUTED_TRACE_HASH), so that loading does not need to generate the columns. The commitments depend on
+ * the CRS as well, so the file records their hash instead, which loading checks.
+ */
+class PrecomputedSnapshot {
+  public:
+    using Commitment = AvmFlavor::Commitment;
+    static constexpr size_t NUM_COLUMNS = AvmFlavor::NUM_PRECOMPUTED_ENTITIES;
+    using Commitments = std::array<Commitment, NUM_COLUMNS>;
+
+    // Generates the precomputed columns and commits to them.
+    static std::shared_ptr<const PrecomputedSnapshot> build();
+    // Throws if the file can not be read or was written for another circuit.
+    static std::shared_ptr<const PrecomputedSnapshot> load(const std::filesystem::path& path);
+    // Loads the snapshot, or builds it and writes it to the given path if it is missing or outdated.
+    static std::shared_ptr<const PrecomputedSnapshot> load_or_build(const std::filesystem::path& path);
+
+    void write(const std::filesystem::path& path) const;
+
+    // Sets the precomputed columns of the trace, which must be empty. They must not be written afterwards.
+    void fill_trace(tracegen::TraceContainer& trace) const;
+    const Commitments& get_commitments() const { return commitments; }
+
+    static uint64_t get_fingerprint();
+    // Hash of the values of the columns, which must be tracegen::PRECOMPUTED_TRACE_HASH.
+    uint64_t get_content_hash() const;
+
+  private:
+    PrecomputedSnapshot() = default;
+
+    // Each column holds at least max(num_rows, 1) rows.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::array<std::shared_ptr<FF[]>, NUM_COLUMNS> columns;
+    std::array<uint32_t, NUM_COLUMNS> num_rows{};
+    Commitments commitments;
+};
+
+} // namespace bb::avm2
@@ -0,0 +1,151 @@
+#include "barretenberg/vm2/precomputed_snapshot.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/constraining/prover.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/precomputed_trace.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+#include "barretenberg/vm2/tracegen_helper.hpp"
+
+namespace bb::avm2 {
+namespace {
+
+using tracegen::TraceContainer;
+
+class PrecomputedSnapshotTest : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite()
+    {
+        bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
+        snapshot = PrecomputedSnapshot::build();
+    }
+    static void TearDownTestSuite() { snapshot = nullptr; }
+
+    void SetUp() override
+    {
+        path = std::filesystem::path(::testing::TempDir()) /
+               ("avm2_precomputed_snapshot_" + std::to_string(getpid()) + ".bin");
+    }
+    void TearDown() override { std::filesystem::remove(path); }
+
+    static std::shared_ptr<const PrecomputedSnapshot> snapshot;
+    std::filesystem::path path;
+};
+
+std::shared_ptr<const PrecomputedSnapshot> PrecomputedSnapshotTest::snapshot;
+
+void expect_precomputed_columns(const PrecomputedSnapshot& snapshot)
+{
+    TraceContainer expected = AvmTraceGenHelper().generate_precomputed_columns();
+    TraceContainer trace;
+    snapshot.fill_trace(trace);
+
+    for (size_t i = 0; i < PrecomputedSnapshot::NUM_COLUMNS; ++i) {
+        const auto col = static_cast<Column>(i);
+        ASSERT_EQ(trace.get_column_rows(col), expected.get_column_rows(col)) << COLUMN_NAMES[i];
+        expected.visit_column(col, [&](uint32_t row, const FF& value) {
+            ASSERT_EQ(trace.get(col, row), value) << COLUMN_NAMES[i] << " row " << row;
+        });
+    }
+}
+
+TEST_F(PrecomputedSnapshotTest, CommitsToPrecomputedColumns)
+{
+    TraceContainer expected = AvmTraceGenHelper().generate_precomputed_columns();
+    AvmProver::PCSCommitmentKey commitment_key(CIRCUIT_SUBGROUP_SIZE);
+
+    for (const Column col : { Column::precomputed_first_row, Column::precomputed_clk, Column::public_inputs_sel }) {
+        AvmFlavor::Polynomial polynomial(expected.get_column_rows(col), CIRCUIT_SUBGROUP_SIZE);
+        expected.visit_column(col, [&](uint32_t row, const FF& value) { polynomial.at(row) = value; });
+        EXPECT_EQ(snapshot->get_commitments()[static_cast<size_t>(col)], commitment_key.commit(polynomial))
+            << COLUMN_NAMES[static_cast<size_t>(col)];
+    }
+}
+
+// Fails whenever the values of the precomputed columns change, until the pinned hash (and with it the fingerprint of
+// the snapshots) is updated.
+TEST_F(PrecomputedSnapshotTest, ContentMatchesPinnedHash)
+{
+    EXPECT_EQ(snapshot->get_content_hash(), tracegen::PRECOMPUTED_TRACE_HASH)
+        << "The precomputed columns changed, set tracegen::PRECOMPUTED_TRACE_HASH to 0x" << std::hex
+        << snapshot->get_content_hash();
+}
+
+TEST_F(PrecomputedSnapshotTest, WriteAndLoad)
+{
+    snapshot->write(path);
+    auto loaded = PrecomputedSnapshot::load(path);
+
+    EXPECT_EQ(loaded->get_commitments(), snapshot->get_commitments());
+    EXPECT_EQ(loaded->get_content_hash(), snapshot->get_content_hash());
+    expect_precomputed_columns(*loaded);
+}
+
+TEST_F(PrecomputedSnapshotTest, RejectsSnapshotOfOtherCircuit)
+{
+    snapshot->write(path);
+    {
+        // Overwrites the fingerprint, which follows the magic and the format version.
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(16);
+        const uint64_t fingerprint = PrecomputedSnapshot::get_fingerprint() + 1;
+        file.write(reinterpret_cast<const char*>(&fingerprint), sizeof(fingerprint));
+    }
+    EXPECT_THROW(PrecomputedSnapshot::load(path), std::runtime_error);
+
+    // The outdated file is replaced.
+    auto rebuilt = PrecomputedSnapshot::load_or_build(path);
+    EXPECT_EQ(rebuilt->get_commitments(), snapshot->get_commitments());
+    EXPECT_EQ(PrecomputedSnapshot::load(path)->get_commitments(), snapshot->get_commitments());
+}
+
+TEST_F(PrecomputedSnapshotTest, RejectsCorruptedColumns)
+{
+    snapshot->write(path);
+    {
+        // Overwrites the first value of the first non-empty column, which starts at the first aligned offset.
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(1 << 16);
+        const FF value = 42;
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    EXPECT_THROW(PrecomputedSnapshot::load(path), std::runtime_error);
+}
+
+TEST_F(PrecomputedSnapshotTest, RejectsCorruptedCommitments)
+{
+    snapshot->write(path);
+    {
+        // Changes the first commitment, which follows the magic, the format version, the fingerprint, the hash of
+        // the commitments and the number of rows and offset of each column.
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        const auto offset = static_cast<std::streamoff>(32 + (2 * PrecomputedSnapshot::NUM_COLUMNS * sizeof(uint64_t)));
+        PrecomputedSnapshot::Commitment commitment = snapshot->get_commitments()[0];
+        commitment.x.data[0] ^= 1;
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char*>(&commitment), sizeof(commitment));
+    }
+    EXPECT_THROW(PrecomputedSnapshot::load(path), std::runtime_error);
+}
+
+TEST_F(PrecomputedSnapshotTest, RejectsOtherFiles)
+{
+    EXPECT_THROW(PrecomputedSnapshot::load(path), std::runtime_error);
+    std::ofstream(path) << "not a snapshot";
+    EXPECT_THROW(PrecomputedSnapshot::load(path), std::runtime_error);
+}
+
+} // namespace
+} // namespace bb::avm2
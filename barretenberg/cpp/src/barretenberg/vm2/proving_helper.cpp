@@ -21,7 +21,8 @@ namespace bb::avm2 {
 namespace {
 
 // TODO: This doesn't need to be a shared_ptr, but BB requires it.
-std::shared_ptr<AvmProver::ProvingKey> create_proving_key(AvmProver::ProverPolynomials& polynomials)
+std::shared_ptr<AvmProver::ProvingKey> create_proving_key(
+    AvmProver::ProverPolynomials& polynomials, std::shared_ptr<AvmProver::PCSCommitmentKey> commitment_key)
 {
     // TODO: Why is num_public_inputs 0?
     auto proving_key = std::make_shared<AvmProver::ProvingKey>(CIRCUIT_SUBGROUP_SIZE, /*num_public_inputs=*/0);
@@ -31,7 +32,7 @@ std::shared_ptr<AvmProver::ProvingKey> create_proving_key(AvmProver::ProverPolyn
         key_poly = std::move(prover_poly);
     }
 
-    proving_key->commitment_key = std::make_shared<AvmProver::PCSCommitmentKey>(CIRCUIT_SUBGROUP_SIZE);
+    proving_key->commitment_key = std::move(commitment_key);
 
     return proving_key;
 }
@@ -69,14 +70,45 @@ std::shared_ptr<AvmVerifier::VerificationKey> AvmProvingHelper::create_verificat
     return std::make_shared<VerificationKey>(circuit_size, num_public_inputs, precomputed_cmts);
 }
 
+std::shared_ptr<AvmProver::PCSCommitmentKey> AvmProvingHelper::get_commitment_key()
+{
+    if (commitment_key == nullptr) {
+        commitment_key = AVM_TRACK_TIME_V("proving/prove:commitment_key",
+                                          std::make_shared<AvmProver::PCSCommitmentKey>(CIRCUIT_SUBGROUP_SIZE));
+    }
+    return commitment_key;
+}
+
 std::pair<AvmProvingHelper::Proof, AvmProvingHelper::VkData> AvmProvingHelper::prove(tracegen::TraceContainer&& trace)
 {
     auto polynomials = AVM_TRACK_TIME_V("proving/prove:compute_polynomials", constraining::compute_polynomials(trace));
-    auto proving_key = AVM_TRACK_TIME_V("proving/prove:proving_key", create_proving_key(polynomials));
+    return prove_polynomials(polynomials, /*wire_commitments=*/{});
+}
+
+std::pair<AvmProvingHelper::Proof, AvmProvingHelper::VkData> AvmProvingHelper::prove(
+    tracegen::TraceContainer&& trace, constraining::WireCommitmentPipeline& wire_commitments)
+{
+    auto [column_polynomials, commitments] =
+        AVM_TRACK_TIME_V("proving/prove:wire_commitments", wire_commitments.finish());
+    auto polynomials = AVM_TRACK_TIME_V("proving/prove:compute_polynomials",
+                                        constraining::compute_polynomials(trace, std::move(column_polynomials)));
+    return prove_polynomials(polynomials, std::move(commitments));
+}
+
+std::pair<AvmProvingHelper::Proof, AvmProvingHelper::VkData> AvmProvingHelper::prove_polynomials(
+    AvmProver::ProverPolynomials& polynomials, std::vector<AvmProver::Flavor::Commitment>&& wire_commitments)
+{
+    auto proving_key =
+        AVM_TRACK_TIME_V("proving/prove:proving_key", create_proving_key(polynomials, get_commitment_key()));
     auto prover =
         AVM_TRACK_TIME_V("proving/prove:construct_prover", AvmProver(proving_key, proving_key->commitment_key));
-    auto verification_key =
-        AVM_TRACK_TIME_V("proving/prove:verification_key", std::make_shared<AvmVerifier::VerificationKey>(proving_key));
+    prover.wire_commitments = std::move(wire_commitments);
+    auto verification_key = AVM_TRACK_TIME_V(
+        "proving/prove:verification_key",
+        precomputed_snapshot != nullptr
+            ? std::make_shared<AvmVerifier::VerificationKey>(
+                  CIRCUIT_SUBGROUP_SIZE, /*num_public_inputs=*/0, precomputed_snapshot->get_commitments())
+            : std::make_shared<AvmVerifier::VerificationKey>(proving_key));
 
     auto proof = AVM_TRACK_TIME_V("proving/construct_proof", prover.construct_proof());
     auto serialized_vk = to_buffer(verification_key->to_field_elements());
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <memory>
+
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/vm2/common/avm_inputs.hpp"
 #include "barretenberg/vm2/constraining/prover.hpp"
 #include "barretenberg/vm2/constraining/verifier.hpp"
+#include "barretenberg/vm2/constraining/wire_commitment_pipeline.hpp"
+#include "barretenberg/vm2/precomputed_snapshot.hpp"
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
 namespace bb::avm2 {
@@ -11,13 +15,31 @@ namespace bb::avm2 {
 class AvmProvingHelper {
   public:
     AvmProvingHelper() = default;
+    // The verification key is built from the commitments of the snapshot, instead of committing to the precomputed
+    // columns of every trace. The traces must have been filled from the same snapshot.
+    explicit AvmProvingHelper(std::shared_ptr<const PrecomputedSnapshot> precomputed_snapshot)
+        : precomputed_snapshot(std::move(precomputed_snapshot))
+    {}
     using Proof = AvmProver::Proof;
     using VkData = std::vector<uint8_t>;
 
     static std::shared_ptr<AvmVerifier::VerificationKey> create_verification_key(const VkData& vk_data);
     std::pair<Proof, VkData> prove(tracegen::TraceContainer&& trace);
+    // Proves a trace whose wires were committed to while it was generated. The pipeline is finished here.
+    std::pair<Proof, VkData> prove(tracegen::TraceContainer&& trace,
+                                   constraining::WireCommitmentPipeline& wire_commitments);
     bool check_circuit(tracegen::TraceContainer&& trace);
     bool verify(const Proof& proof, const PublicInputs& pi, const VkData& vk_data);
+    // The commitment key of the proofs, created on first use.
+    std::shared_ptr<AvmProver::PCSCommitmentKey> get_commitment_key();
+
+  private:
+    std::pair<Proof, VkData> prove_polynomials(AvmProver::ProverPolynomials& polynomials,
+                                               std::vector<AvmProver::Flavor::Commitment>&& wire_commitments);
+
+    std::shared_ptr<const PrecomputedSnapshot> precomputed_snapshot;
+    // Created by the first proof, and shared by the next ones.
+    std::shared_ptr<AvmProver::PCSCommitmentKey> commitment_key;
 };
 
 } // namespace bb::avm2
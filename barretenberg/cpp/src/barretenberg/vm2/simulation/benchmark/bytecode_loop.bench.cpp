@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "barretenberg/vm2/common/aztec_types.hpp"
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/simulation/alu.hpp"
+#include "barretenberg/vm2/simulation/bytecode_manager.hpp"
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/simulation/execution.hpp"
+#include "barretenberg/vm2/simulation/execution_components.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
+#include "barretenberg/vm2/simulation/lib/instruction_info.hpp"
+#include "barretenberg/vm2/simulation/lib/serialization.hpp"
+#include "barretenberg/vm2/simulation/range_check.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+using namespace bb::avm2::simulation;
+
+namespace {
+
+// Serves a single bytecode. Instructions are either decoded on every read, or read from a DecodedBytecode.
+class BenchTxBytecodeManager : public TxBytecodeManagerInterface {
+  public:
+    BenchTxBytecodeManager(std::shared_ptr<std::vector<uint8_t>> bytecode, bool use_cache)
+        : decoded_bytecode(std::move(bytecode))
+        , use_cache(use_cache)
+    {}
+
+    BytecodeId get_bytecode(const AztecAddress&) override { return 0; }
+    const Instruction& read_instruction(BytecodeId, uint32_t pc) override
+    {
+        if (use_cache) {
+            return decoded_bytecode.get_instruction(pc).instruction;
+        }
+        last_instruction = decode_instruction(*decoded_bytecode.get_bytecode(), pc).instruction;
+        return last_instruction;
+    }
+
+  private:
+    DecodedBytecode decoded_bytecode;
+    bool use_cache;
+    // The instruction decoded by the last read, if not using the cache.
+    Instruction last_instruction;
+};
+
+// A loop that increments a u16 counter until it wraps around to zero, after num_iterations iterations.
+std::shared_ptr<std::vector<uint8_t>> make_loop_bytecode(uint32_t num_iterations)
+{
+    const auto u8 = [](uint32_t value) { return Operand::from<uint8_t>(static_cast<uint8_t>(value)); };
+    const auto u16 = [](uint32_t value) { return Operand::from<uint16_t>(static_cast<uint16_t>(value)); };
+    const auto tag = [](MemoryTag tag) { return Operand::from<uint8_t>(static_cast<uint8_t>(tag)); };
+
+    const std::vector<Instruction> prologue = {
+        { .opcode = WireOpCode::SET_16, .operands = { u16(0), tag(MemoryTag::U16), u16((1 << 16) - num_iterations) } },
+        { .opcode = WireOpCode::SET_16, .operands = { u16(1), tag(MemoryTag::U16), u16(1) } },
+        { .opcode = WireOpCode::SET_16, .operands = { u16(2), tag(MemoryTag::U32), u16(0) } },
+    };
+    auto bytecode = std::make_shared<std::vector<uint8_t>>();
+    for (const auto& instruction : prologue) {
+        const auto serialized = instruction.serialize();
+        bytecode->insert(bytecode->end(), serialized.begin(), serialized.end());
+    }
+
+    const auto loop_pc = static_cast<uint32_t>(bytecode->size());
+    const std::vector<Instruction> loop = {
+        { .opcode = WireOpCode::ADD_8, .operands = { u8(0), u8(1), u8(0) } },
+        { .opcode = WireOpCode::MOV_8, .operands = { u8(0), u8(3) } },
+        { .opcode = WireOpCode::JUMPI_32, .operands = { u16(0), Operand::from<uint32_t>(loop_pc) } },
+        { .opcode = WireOpCode::RETURN, .operands = { u16(2), u16(2) } },
+    };
+    for (const auto& instruction : loop) {
+        const auto serialized = instruction.serialize();
+        bytecode->insert(bytecode->end(), serialized.begin(), serialized.end());
+    }
+    return bytecode;
+}
+
+// Simulates a loop of num_iterations iterations, emitting events as when proving.
+// Reports the number of simulated opcodes per second.
+void BM_loop_opcodes(State& state, bool use_cache)
+{
+    const auto num_iterations = static_cast<uint32_t>(state.range(0));
+    auto bytecode = make_loop_bytecode(num_iterations);
+
+    size_t num_opcodes = 0;
+    for (auto _ : state) {
+        EventEmitter<MemoryEvent> memory_events;
+        DeduplicatingEventEmitter<RangeCheckEvent> range_check_events;
+        DeduplicatingEventEmitter<AluEvent> alu_events;
+        NoopEventEmitter<ExecutionEvent> execution_events;
+        NoopEventEmitter<ContextStackEvent> context_stack_events;
+
+        RangeCheck range_check(range_check_events);
+        Alu alu(alu_events);
+        InstructionInfoDB instruction_info_db;
+        BenchTxBytecodeManager tx_bytecode_manager(bytecode, use_cache);
+        ExecutionComponentsProvider provider(tx_bytecode_manager, range_check, memory_events, instruction_info_db);
+        Execution execution(alu, provider, instruction_info_db, execution_events, context_stack_events);
+        auto context = provider.make_enqueued_context(AztecAddress(1), AztecAddress(2), {}, false);
+
+        DoNotOptimize(execution.execute(*context));
+        // The prologue, 3 opcodes per iteration and the return.
+        num_opcodes += 3 + (3 * num_iterations) + 1;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(num_opcodes));
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_loop_opcodes, decode_every_read, false)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 15);
+BENCHMARK_CAPTURE(BM_loop_opcodes, decoded_bytecode, true)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 15);
+BENCHMARK_MAIN();
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/simulation/events/memory_event.hpp"
+#include "barretenberg/vm2/simulation/events/range_check_event.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+using namespace bb::avm2::simulation;
+
+namespace {
+
+MemoryEvent make_memory_event(size_t i)
+{
+    return {
+        .mode = i % 2 == 0 ? MemoryMode::READ : MemoryMode::WRITE,
+        .addr = static_cast<MemoryAddress>(i),
+        .value = MemoryValue::from<FF>(i),
+        .space_id = 1,
+    };
+}
+
+// Emits events and hands them over as a vector, as the simulation does at the end of a transaction.
+void BM_emit_memory_events(State& state)
+{
+    const auto num_events = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        EventEmitter<MemoryEvent> emitter;
+        for (size_t i = 0; i < num_events; ++i) {
+            emitter.emit(make_memory_event(i));
+        }
+        DoNotOptimize(emitter.dump_events());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Emits events and consumes them in place, without moving them into a vector.
+void BM_emit_memory_events_in_place(State& state)
+{
+    const auto num_events = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        EventEmitter<MemoryEvent> emitter;
+        for (size_t i = 0; i < num_events; ++i) {
+            emitter.emit(make_memory_event(i));
+        }
+        uint64_t sum = 0;
+        emitter.get_events().for_each_chunk([&](std::span<const MemoryEvent> chunk) {
+            for (const auto& event : chunk) {
+                sum += event.addr;
+            }
+        });
+        DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Baseline: the same events pushed into a growing vector.
+void BM_emit_memory_events_vector(State& state)
+{
+    const auto num_events = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        std::vector<MemoryEvent> events;
+        for (size_t i = 0; i < num_events; ++i) {
+            events.push_back(make_memory_event(i));
+        }
+        DoNotOptimize(events);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Range check events go through a deduplicating emitter. Half of the events are duplicates.
+void BM_emit_range_check_events_dedup(State& state)
+{
+    const auto num_events = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        DeduplicatingEventEmitter<RangeCheckEvent> emitter;
+        for (size_t i = 0; i < num_events; ++i) {
+            emitter.emit({ .value = i / 2, .num_bits = 64 });
+        }
+        DoNotOptimize(emitter.dump_events());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_emit_memory_events)->Unit(kMillisecond)->RangeMultiplier(8)->Range(1 << 12, 1 << 21);
+BENCHMARK(BM_emit_memory_events_in_place)->Unit(kMillisecond)->RangeMultiplier(8)->Range(1 << 12, 1 << 21);
+BENCHMARK(BM_emit_memory_events_vector)->Unit(kMillisecond)->RangeMultiplier(8)->Range(1 << 12, 1 << 21);
+BENCHMARK(BM_emit_range_check_events_dedup)->Unit(kMillisecond)->RangeMultiplier(8)->Range(1 << 12, 1 << 21);
+BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "barretenberg/vm2/common/aztec_types.hpp"
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/simulation/addressing.hpp"
+#include "barretenberg/vm2/simulation/alu.hpp"
+#include "barretenberg/vm2/simulation/context.hpp"
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/simulation/execution.hpp"
+#include "barretenberg/vm2/simulation/execution_components.hpp"
+#include "barretenberg/vm2/simulation/lib/instruction_info.hpp"
+#include "barretenberg/vm2/simulation/memory.hpp"
+#include "barretenberg/vm2/simulation/range_check.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+using namespace bb::avm2::simulation;
+
+namespace {
+
+// Only creates enqueued call contexts, which is all the opcodes below need.
+class BenchComponentsProvider : public ExecutionComponentsProviderInterface {
+  public:
+    BenchComponentsProvider(MemoryModel memory_model,
+                            RangeCheckInterface& range_check,
+                            EventEmitterInterface<MemoryEvent>& memory_events)
+        : memory_model(memory_model)
+        , range_check(range_check)
+        , memory_events(memory_events)
+    {}
+
+    std::unique_ptr<ContextInterface> make_nested_context(
+        AztecAddress, AztecAddress, ContextInterface&, MemoryAddress, MemoryAddress, bool) override
+    {
+        return nullptr;
+    }
+    std::unique_ptr<ContextInterface> make_enqueued_context(AztecAddress address,
+                                                            AztecAddress msg_sender,
+                                                            std::span<const FF> calldata,
+                                                            bool is_static) override
+    {
+        const uint32_t context_id = next_context_id++;
+        return std::make_unique<EnqueuedCallContext>(context_id,
+                                                     address,
+                                                     msg_sender,
+                                                     is_static,
+                                                     /*bytecode=*/nullptr,
+                                                     make_memory(memory_model, context_id, range_check, memory_events),
+                                                     calldata);
+    }
+    std::unique_ptr<AddressingInterface> make_addressing(AddressingEvent&) override { return nullptr; }
+    uint32_t get_next_context_id() override { return next_context_id; }
+
+  private:
+    uint32_t next_context_id = 1;
+    MemoryModel memory_model;
+    RangeCheckInterface& range_check;
+    EventEmitterInterface<MemoryEvent>& memory_events;
+};
+
+// Runs SET, ADD and MOV opcodes over a contiguous range of num_slots addresses, emitting events as when proving.
+// Reports the number of opcodes per second.
+void BM_memory_heavy_opcodes(State& state, MemoryModel memory_model)
+{
+    const auto num_slots = static_cast<MemoryAddress>(state.range(0));
+    // Contracts usually work on an offset from the start of memory.
+    const MemoryAddress base = 1000;
+    const size_t num_rounds = 4;
+
+    size_t num_opcodes = 0;
+    for (auto _ : state) {
+        EventEmitter<MemoryEvent> memory_events;
+        DeduplicatingEventEmitter<RangeCheckEvent> range_check_events;
+        DeduplicatingEventEmitter<AluEvent> alu_events;
+        NoopEventEmitter<ExecutionEvent> execution_events;
+        NoopEventEmitter<ContextStackEvent> context_stack_events;
+
+        RangeCheck range_check(range_check_events);
+        Alu alu(alu_events);
+        InstructionInfoDB instruction_info_db;
+        BenchComponentsProvider provider(memory_model, range_check, memory_events);
+        Execution execution(alu, provider, instruction_info_db, execution_events, context_stack_events);
+        auto context = provider.make_enqueued_context(AztecAddress(1), AztecAddress(2), {}, false);
+
+        for (MemoryAddress i = 0; i < num_slots; ++i) {
+            execution.set(*context, base + i, static_cast<uint8_t>(ValueTag::U32), i);
+        }
+        for (size_t round = 0; round < num_rounds; ++round) {
+            for (MemoryAddress i = 0; i + 2 < num_slots; ++i) {
+                execution.add(*context, base + i, base + i + 1, base + i + 2);
+                execution.mov(*context, base + i + 2, base + num_slots + i);
+            }
+        }
+        num_opcodes += num_slots + num_rounds * 2 * (num_slots - 2);
+        DoNotOptimize(memory_events.get_events().size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(num_opcodes));
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_memory_heavy_opcodes, sparse, MemoryModel::SPARSE)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(8)
+    ->Range(1 << 8, 1 << 14);
+BENCHMARK_CAPTURE(BM_memory_heavy_opcodes, paged, MemoryModel::PAGED)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(8)
+    ->Range(1 << 8, 1 << 14);
+BENCHMARK_MAIN();
@@ -42,12 +42,16 @@ BytecodeId TxBytecodeManager::get_bytecode(const AztecAddress& address)
     (void)bytecode_commitment; // Avoid GCC unused parameter warning when asserts are disabled.
     assert(bytecode_commitment == klass.public_bytecode_commitment);
     // We convert the bytecode to a shared_ptr because it will be shared by some events.
-    auto shared_bytecode = std::make_shared<std::vector<uint8_t>>(std::move(klass.packed_bytecode));
-    decomposition_events.emit({ .bytecode_id = bytecode_id, .bytecode = shared_bytecode });
+    auto decoded_bytecode = decoded_bytecode_cache.get(
+        instance.current_class_id, std::make_shared<std::vector<uint8_t>>(std::move(klass.packed_bytecode)));
+    decomposition_events.emit({ .bytecode_id = bytecode_id, .bytecode = decoded_bytecode->get_bytecode() });
 
     // We now save the bytecode so that we don't repeat this process.
     resolved_addresses[address] = bytecode_id;
-    bytecodes.emplace(bytecode_id, std::move(shared_bytecode));
+    const size_t bytecode_size = decoded_bytecode->get_bytecode()->size();
+    bytecodes.emplace(bytecode_id,
+                      TxBytecode{ .decoded = std::move(decoded_bytecode),
+                                  .fetched_pcs = std::vector<bool>(bytecode_size) });
 
     auto tree_snapshots = merkle_db.get_tree_roots();
 
@@ -65,47 +69,41 @@ BytecodeId TxBytecodeManager::get_bytecode(const AztecAddress& address)
     return bytecode_id;
 }
 
-Instruction TxBytecodeManager::read_instruction(BytecodeId bytecode_id, uint32_t pc)
+const Instruction& TxBytecodeManager::read_instruction(BytecodeId bytecode_id, uint32_t pc)
 {
-    // We'll be filling in the event as we progress.
-    InstructionFetchingEvent instr_fetching_event;
-
     auto it = bytecodes.find(bytecode_id);
     if (it == bytecodes.end()) {
         throw std::runtime_error("Bytecode not found");
     }
-
-    instr_fetching_event.bytecode_id = bytecode_id;
-    instr_fetching_event.pc = pc;
-
-    auto bytecode_ptr = it->second;
-    instr_fetching_event.bytecode = bytecode_ptr;
-
-    const auto& bytecode = *bytecode_ptr;
+    TxBytecode& bytecode = it->second;
 
     // TODO: Propagate instruction fetching error to the upper layer (execution loop)
-    try {
-        instr_fetching_event.instruction = deserialize_instruction(bytecode, pc);
-
-        // If the following code is executed, no error was thrown in deserialize_instruction().
-        if (!check_tag(instr_fetching_event.instruction)) {
-            instr_fetching_event.error = InstrDeserializationError::TAG_OUT_OF_RANGE;
-        };
-    } catch (const InstrDeserializationError& error) {
-        assert(error != InstrDeserializationError::TAG_OUT_OF_RANGE);
-        instr_fetching_event.error = error;
+    const DecodedInstruction& decoded = bytecode.decoded->get_instruction(pc);
+
+    // The fetching events are deduplicated by pc, so only the first fetch of a pc builds one (and range checks the
+    // pc). The pcs out of the bytecode are rare, and left to the deduplicating event emitter.
+    if (pc < bytecode.fetched_pcs.size()) {
+        if (bytecode.fetched_pcs[pc]) {
+            return decoded.instruction;
+        }
+        bytecode.fetched_pcs[pc] = true;
     }
 
     // We are showing whether bytecode_size > pc or not. If there is no fetching error,
     // we always have bytecode_size > pc.
-    const auto bytecode_size = bytecode_ptr->size();
+    const auto bytecode_size = bytecode.decoded->get_bytecode()->size();
     const uint128_t pc_diff = bytecode_size > pc ? bytecode_size - pc - 1 : pc - bytecode_size;
     range_check.assert_range(pc_diff, AVM_PC_SIZE_IN_BITS);
 
-    // The event will be deduplicated internally.
-    fetching_events.emit(InstructionFetchingEvent(instr_fetching_event));
+    fetching_events.emit({
+        .bytecode_id = bytecode_id,
+        .pc = pc,
+        .instruction = decoded.instruction,
+        .bytecode = bytecode.decoded->get_bytecode(),
+        .error = decoded.error,
+    });
 
-    return instr_fetching_event.instruction;
+    return decoded.instruction;
 }
 
 } // namespace bb::avm2::simulation
@@ -16,6 +16,7 @@
 #include "barretenberg/vm2/simulation/events/bytecode_events.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/lib/db_interfaces.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
 #include "barretenberg/vm2/simulation/lib/serialization.hpp"
 #include "barretenberg/vm2/simulation/range_check.hpp"
 #include "barretenberg/vm2/simulation/siloing.hpp"
@@ -33,8 +34,8 @@ class TxBytecodeManagerInterface {
     // (1) sets up the address-class id connection,
     // (2) hashes it if needed.
     virtual BytecodeId get_bytecode(const AztecAddress& address) = 0;
-    // Retrieves an instruction and decomposes it if needed.
-    virtual Instruction read_instruction(BytecodeId bytecode_id, uint32_t pc) = 0;
+    // Retrieves an instruction and decomposes it if needed. The instruction lives as long as the manager.
+    virtual const Instruction& read_instruction(BytecodeId bytecode_id, uint32_t pc) = 0;
 };
 
 class TxBytecodeManager : public TxBytecodeManagerInterface {
@@ -48,7 +49,8 @@ class TxBytecodeManager : public TxBytecodeManagerInterface {
                       uint32_t current_block_number,
                       EventEmitterInterface<BytecodeRetrievalEvent>& retrieval_events,
                       EventEmitterInterface<BytecodeDecompositionEvent>& decomposition_events,
-                      EventEmitterInterface<InstructionFetchingEvent>& fetching_events)
+                      EventEmitterInterface<InstructionFetchingEvent>& fetching_events,
+                      DecodedBytecodeCache& decoded_bytecode_cache)
         : contract_db(contract_db)
         , merkle_db(merkle_db)
         , poseidon2(poseidon2)
@@ -59,12 +61,19 @@ class TxBytecodeManager : public TxBytecodeManagerInterface {
         , retrieval_events(retrieval_events)
         , decomposition_events(decomposition_events)
         , fetching_events(fetching_events)
+        , decoded_bytecode_cache(decoded_bytecode_cache)
     {}
 
     BytecodeId get_bytecode(const AztecAddress& address) override;
-    Instruction read_instruction(BytecodeId bytecode_id, uint32_t pc) override;
+    const Instruction& read_instruction(BytecodeId bytecode_id, uint32_t pc) override;
 
   private:
+    struct TxBytecode {
+        std::shared_ptr<DecodedBytecode> decoded;
+        // The pcs (within the bytecode) whose instruction fetching event was already emitted.
+        std::vector<bool> fetched_pcs;
+    };
+
     ContractDBInterface& contract_db;
     HighLevelMerkleDBInterface& merkle_db;
     Poseidon2Interface& poseidon2;
@@ -76,7 +85,9 @@ class TxBytecodeManager : public TxBytecodeManagerInterface {
     EventEmitterInterface<BytecodeRetrievalEvent>& retrieval_events;
     EventEmitterInterface<BytecodeDecompositionEvent>& decomposition_events;
     EventEmitterInterface<InstructionFetchingEvent>& fetching_events;
-    unordered_flat_map<BytecodeId, std::shared_ptr<std::vector<uint8_t>>> bytecodes;
+    // Instructions are decoded once per contract class, rather than every time they are executed.
+    DecodedBytecodeCache& decoded_bytecode_cache;
+    unordered_flat_map<BytecodeId, TxBytecode> bytecodes;
     unordered_flat_map<AztecAddress, BytecodeId> resolved_addresses;
     BytecodeId next_bytecode_id = 0;
 };
@@ -87,7 +98,7 @@ class BytecodeManagerInterface {
   public:
     virtual ~BytecodeManagerInterface() = default;
 
-    virtual Instruction read_instruction(uint32_t pc) = 0;
+    virtual const Instruction& read_instruction(uint32_t pc) = 0;
     // Returns the id of the current bytecode. Tries to fetch it if not already done.
     virtual BytecodeId get_bytecode_id() = 0;
 };
@@ -99,7 +110,7 @@ class BytecodeManager : public BytecodeManagerInterface {
         , tx_bytecode_manager(tx_bytecode_manager)
     {}
 
-    Instruction read_instruction(uint32_t pc) override
+    const Instruction& read_instruction(uint32_t pc) override
     {
         return tx_bytecode_manager.read_instruction(get_bytecode_id(), pc);
     }
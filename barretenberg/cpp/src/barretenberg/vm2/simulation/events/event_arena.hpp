@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace bb::avm2::simulation {
+
+/**
+ * @brief Append-only store for events, made of fixed-size chunks.
+ * @details Events are constructed in place and never move while they are in the arena: growing the arena allocates a
+ * new chunk instead of reallocating and copying the existing events, as a vector would. All the memory is released at
+ * once by clear(), or chunk by chunk while the events are moved out by move_to_vector().
+ *
+ * The events can be consumed in place, either by iterating over the arena or chunk by chunk with for_each_chunk().
+ * Moving the arena hands over its chunks, not the events, and leaves it empty.
+ */
+template <typename Event> class EventArena {
+  public:
+    using value_type = Event;
+    using size_type = size_t;
+
+    // Aim for chunks of ~256KiB. A power of two keeps the index arithmetic cheap.
+    static constexpr size_t CHUNK_SIZE = std::bit_floor(std::max<size_t>(1, (size_t(1) << 18) / sizeof(Event)));
+
+    class const_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Event;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Event*;
+        using reference = const Event&;
+
+        const_iterator() = default;
+        const_iterator(const EventArena* arena, size_t index)
+            : arena(arena)
+            , index(index)
+        {}
+
+        reference operator*() const { return (*arena)[index]; }
+        pointer operator->() const { return &(*arena)[index]; }
+        const_iterator& operator++()
+        {
+            ++index;
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            const_iterator result = *this;
+            ++index;
+            return result;
+        }
+        bool operator==(const const_iterator& other) const { return index == other.index; }
+
+      private:
+        const EventArena* arena = nullptr;
+        size_t index = 0;
+    };
+    using iterator = const_iterator;
+
+    EventArena() = default;
+    EventArena(const EventArena&) = delete;
+    EventArena& operator=(const EventArena&) = delete;
+    EventArena(EventArena&& other) noexcept { swap(other); }
+    EventArena& operator=(EventArena&& other) noexcept
+    {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+    ~EventArena() { clear(); }
+
+    template <typename... Args> Event& emplace_back(Args&&... args)
+    {
+        if (next == chunk_end) [[unlikely]] {
+            add_chunk();
+        }
+        Event* event = std::construct_at(next, std::forward<Args>(args)...);
+        ++next;
+        ++num_events;
+        return *event;
+    }
+    void push_back(Event&& event) { emplace_back(std::move(event)); }
+
+    size_t size() const { return num_events; }
+    bool empty() const { return num_events == 0; }
+
+    const Event& operator[](size_t index) const { return chunks[index / CHUNK_SIZE][index % CHUNK_SIZE]; }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, num_events); }
+
+    // Calls f with a std::span<const Event> for each chunk, in order.
+    template <typename F> void for_each_chunk(F&& f) const
+    {
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            f(std::span<const Event>(chunks[i], chunk_size(i)));
+        }
+    }
+
+    // Destroys all the events and frees all the memory.
+    void clear()
+    {
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            std::destroy_n(chunks[i], chunk_size(i));
+            allocator.deallocate(chunks[i], CHUNK_SIZE);
+        }
+        reset();
+    }
+
+    // Moves the events into a vector, which is allocated once. Chunks are freed as soon as they are moved out,
+    // so the peak memory is that of the events plus one chunk. The arena is left empty.
+    std::vector<Event> move_to_vector()
+    {
+        std::vector<Event> result;
+        result.reserve(num_events);
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            const size_t n = chunk_size(i);
+            std::move(chunks[i], chunks[i] + n, std::back_inserter(result));
+            std::destroy_n(chunks[i], n);
+            allocator.deallocate(chunks[i], CHUNK_SIZE);
+        }
+        reset();
+        return result;
+    }
+
+  private:
+    size_t chunk_size(size_t chunk_index) const
+    {
+        return std::min(CHUNK_SIZE, num_events - chunk_index * CHUNK_SIZE);
+    }
+
+    void add_chunk()
+    {
+        chunks.push_back(allocator.allocate(CHUNK_SIZE));
+        next = chunks.back();
+        chunk_end = next + CHUNK_SIZE;
+    }
+
+    // Forgets about the chunks, which must have been freed.
+    void reset()
+    {
+        std::vector<Event*>().swap(chunks);
+        num_events = 0;
+        next = nullptr;
+        chunk_end = nullptr;
+    }
+
+    void swap(EventArena& other) noexcept
+    {
+        std::swap(chunks, other.chunks);
+        std::swap(num_events, other.num_events);
+        std::swap(next, other.next);
+        std::swap(chunk_end, other.chunk_end);
+    }
+
+    [[no_unique_address]] std::allocator<Event> allocator;
+    std::vector<Event*> chunks;
+    size_t num_events = 0;
+    // Where the next event goes, and the end of the last chunk.
+    Event* next = nullptr;
+    Event* chunk_end = nullptr;
+};
+
+} // namespace bb::avm2::simulation
@@ -0,0 +1,83 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "barretenberg/vm2/simulation/events/event_arena.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+TEST(EventArenaTest, AddressesAreStable)
+{
+    EventArena<size_t> arena;
+    const size_t num_events = 3 * EventArena<size_t>::CHUNK_SIZE + 5;
+
+    const size_t* first = &arena.emplace_back(0);
+    for (size_t i = 1; i < num_events; ++i) {
+        arena.emplace_back(i);
+    }
+    EXPECT_EQ(&arena[0], first);
+    EXPECT_EQ(arena.size(), num_events);
+
+    size_t expected = 0;
+    for (const auto& event : arena) {
+        EXPECT_EQ(event, expected++);
+    }
+    EXPECT_EQ(expected, num_events);
+
+    // Chunks are visited in order and only the last one is partially filled.
+    std::vector<size_t> chunk_sizes;
+    expected = 0;
+    arena.for_each_chunk([&](std::span<const size_t> chunk) {
+        chunk_sizes.push_back(chunk.size());
+        for (const auto& event : chunk) {
+            EXPECT_EQ(event, expected++);
+        }
+    });
+    const size_t chunk_size = EventArena<size_t>::CHUNK_SIZE;
+    EXPECT_THAT(chunk_sizes, ElementsAre(chunk_size, chunk_size, chunk_size, 5));
+}
+
+TEST(EventArenaTest, MoveToVector)
+{
+    EventArena<std::unique_ptr<int>> arena;
+    for (int i = 0; i < 10; ++i) {
+        arena.emplace_back(std::make_unique<int>(i));
+    }
+
+    auto events = arena.move_to_vector();
+    ASSERT_EQ(events.size(), 10);
+    for (size_t i = 0; i < events.size(); ++i) {
+        EXPECT_EQ(*events[i], static_cast<int>(i));
+    }
+    EXPECT_TRUE(arena.empty());
+    EXPECT_THAT(arena, IsEmpty());
+
+    // The arena can be reused.
+    arena.emplace_back(std::make_unique<int>(42));
+    EXPECT_EQ(*arena[0], 42);
+}
+
+TEST(EventArenaTest, ClearDestroysEvents)
+{
+    auto counter = std::make_shared<int>(0);
+    EventArena<std::shared_ptr<int>> arena;
+    for (size_t i = 0; i < 100; ++i) {
+        arena.emplace_back(counter);
+    }
+    EXPECT_EQ(counter.use_count(), 101);
+
+    arena.clear();
+    EXPECT_EQ(counter.use_count(), 1);
+    EXPECT_TRUE(arena.empty());
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
@@ -1,12 +1,20 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <functional>
+#include <utility>
 #include <vector>
 
 #include "barretenberg/vm2/common/set.hpp"
+#include "barretenberg/vm2/simulation/events/event_arena.hpp"
 
 namespace bb::avm2::simulation {
 
+// Receives batches of events when an emitter streams its events instead of collecting them. A batch is the arena the
+// events were emitted into, handed over as a whole.
+template <typename Event> using EventBatchSink = std::function<void(EventArena<Event>&&)>;
+
 template <typename Event> class EventEmitterInterface {
   public:
     using Container = std::vector<Event>;
@@ -21,14 +29,41 @@ template <typename Event> class EventEmitter : public EventEmitterInterface<Even
     using Container = std::vector<Event>;
 
     virtual ~EventEmitter() = default;
-    void emit(Event&& event) override { events.push_back(std::move(event)); };
+    void emit(Event&& event) override
+    {
+        events.emplace_back(std::move(event));
+        if (sink && events.size() >= batch_size) {
+            flush();
+        }
+    };
 
-    const Container& get_events() const { return events; }
-    // Transfers ownership of the events to the caller (clears the internal container).
-    Container dump_events() { return std::move(events); }
+    // The events can be consumed in place, without dumping them.
+    const EventArena<Event>& get_events() const { return events; }
+    // Transfers ownership of the events to the caller (clears the internal container). The events are not moved.
+    EventArena<Event> take_events() { return std::exchange(events, EventArena<Event>()); }
+    // Like take_events(), but moves the events into a vector, which is what the tests compare against.
+    Container dump_events() { return events.move_to_vector(); }
+
+    // From now on, hands the events over to the sink in batches of batch_size, as they are emitted.
+    void stream_to(EventBatchSink<Event> batch_sink, size_t batch_size)
+    {
+        assert(batch_size > 0);
+        sink = std::move(batch_sink);
+        this->batch_size = batch_size;
+    }
+    // Hands the pending events over to the sink, if streaming. Only the arena's chunks change hands, the events stay
+    // where they were emitted. Emitting continues into a fresh arena.
+    void flush()
+    {
+        if (sink && !events.empty()) {
+            sink(std::exchange(events, EventArena<Event>()));
+        }
+    }
 
   private:
-    Container events;
+    EventArena<Event> events;
+    EventBatchSink<Event> sink;
+    size_t batch_size = 0;
 };
 
 // This is an EventEmitter that eagerly deduplicates events based on a provided key.
@@ -38,13 +73,17 @@ template <typename Event> class DeduplicatingEventEmitter : public EventEmitter<
 
     void emit(Event&& event) override
     {
-        typename Event::Key key = event.get_key();
-        if (!elements_seen.contains(key)) {
-            elements_seen.insert(key);
+        // A single lookup both checks and records the key.
+        if (elements_seen.insert(event.get_key()).second) {
             EventEmitter<Event>::emit(std::move(event));
         }
     };
     // Transfers ownership of the events to the caller (clears the internal container).
+    EventArena<Event> take_events()
+    {
+        elements_seen.clear();
+        return EventEmitter<Event>::take_events();
+    }
     EventEmitter<Event>::Container dump_events()
     {
         elements_seen.clear();
@@ -63,7 +102,10 @@ template <typename Event> class NoopEventEmitter : public EventEmitterInterface<
 
     void emit(Event&&) override{};
     // TODO: Get rid of this.
+    EventArena<Event> take_events() { return {}; };
     EventEmitter<Event>::Container dump_events() { return {}; };
+    void stream_to(EventBatchSink<Event>, size_t){};
+    void flush(){};
 };
 
 // This is an event emitter which only emits events once (it actually just _sets_ an event).
@@ -0,0 +1,112 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+struct TestEvent {
+    int value;
+
+    bool operator==(const TestEvent& other) const = default;
+};
+
+std::vector<TestEvent> to_vector(const EventArena<TestEvent>& events)
+{
+    return { events.begin(), events.end() };
+}
+
+TEST(EventEmitterTest, StreamsBatches)
+{
+    EventEmitter<TestEvent> emitter;
+    std::vector<EventArena<TestEvent>> batches;
+    emitter.stream_to([&](EventArena<TestEvent>&& batch) { batches.push_back(std::move(batch)); },
+                      /*batch_size=*/2);
+
+    for (int i = 0; i < 5; ++i) {
+        emitter.emit({ i });
+    }
+    ASSERT_EQ(batches.size(), 2);
+    EXPECT_THAT(to_vector(batches[0]), ElementsAre(TestEvent{ 0 }, TestEvent{ 1 }));
+    EXPECT_THAT(to_vector(batches[1]), ElementsAre(TestEvent{ 2 }, TestEvent{ 3 }));
+    EXPECT_THAT(emitter.get_events(), ElementsAre(TestEvent{ 4 }));
+
+    // Flushing hands over the last (partial) batch.
+    emitter.flush();
+    EXPECT_EQ(batches.size(), 3);
+    EXPECT_THAT(to_vector(batches.back()), ElementsAre(TestEvent{ 4 }));
+    EXPECT_THAT(emitter.dump_events(), IsEmpty());
+
+    // Flushing with no pending events does nothing.
+    emitter.flush();
+    EXPECT_EQ(batches.size(), 3);
+}
+
+TEST(EventEmitterTest, HandsOverEventsWithoutMovingThem)
+{
+    EventEmitter<TestEvent> emitter;
+    std::vector<EventArena<TestEvent>> batches;
+    emitter.stream_to([&](EventArena<TestEvent>&& batch) { batches.push_back(std::move(batch)); },
+                      /*batch_size=*/3);
+
+    emitter.emit({ 0 });
+    emitter.emit({ 1 });
+    const TestEvent* first = &emitter.get_events()[0];
+    emitter.emit({ 2 });
+    ASSERT_EQ(batches.size(), 1);
+    EXPECT_EQ(&batches[0][0], first);
+    EXPECT_TRUE(emitter.get_events().empty());
+
+    // The next events go to a fresh arena.
+    emitter.emit({ 3 });
+    EXPECT_THAT(emitter.get_events(), ElementsAre(TestEvent{ 3 }));
+    EXPECT_THAT(to_vector(batches[0]), ElementsAre(TestEvent{ 0 }, TestEvent{ 1 }, TestEvent{ 2 }));
+}
+
+TEST(EventEmitterTest, FlushWithoutSinkKeepsEvents)
+{
+    EventEmitter<TestEvent> emitter;
+    emitter.emit({ 1 });
+    emitter.flush();
+    EXPECT_THAT(emitter.dump_events(), ElementsAre(TestEvent{ 1 }));
+}
+
+TEST(EventEmitterTest, TakesEventsWithoutMovingThem)
+{
+    EventEmitter<TestEvent> emitter;
+    emitter.emit({ 1 });
+    const TestEvent* first = &emitter.get_events()[0];
+
+    EventArena<TestEvent> events = emitter.take_events();
+    EXPECT_EQ(&events[0], first);
+    EXPECT_TRUE(emitter.get_events().empty());
+}
+
+struct KeyedTestEvent {
+    using Key = int;
+    int value;
+
+    Key get_key() const { return value; }
+    bool operator==(const KeyedTestEvent& other) const = default;
+};
+
+TEST(EventEmitterTest, TakingEventsResetsDeduplication)
+{
+    DeduplicatingEventEmitter<KeyedTestEvent> emitter;
+    emitter.emit({ 1 });
+    emitter.emit({ 1 });
+    EXPECT_THAT(emitter.take_events(), ElementsAre(KeyedTestEvent{ 1 }));
+
+    emitter.emit({ 1 });
+    EXPECT_THAT(emitter.take_events(), ElementsAre(KeyedTestEvent{ 1 }));
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
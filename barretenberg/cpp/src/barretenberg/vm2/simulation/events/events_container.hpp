@@ -7,6 +7,7 @@
 #include "barretenberg/vm2/simulation/events/bytecode_events.hpp"
 #include "barretenberg/vm2/simulation/events/class_id_derivation_event.hpp"
 #include "barretenberg/vm2/simulation/events/ecc_events.hpp"
+#include "barretenberg/vm2/simulation/events/event_arena.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/events/execution_event.hpp"
 #include "barretenberg/vm2/simulation/events/field_gt_event.hpp"
@@ -23,31 +24,43 @@
 
 namespace bb::avm2::simulation {
 
+// The events are handed over in the arenas they were emitted into, and consumed there by tracegen.
 struct EventsContainer {
-    EventEmitterInterface<ExecutionEvent>::Container execution;
-    EventEmitterInterface<AluEvent>::Container alu;
-    EventEmitterInterface<BitwiseEvent>::Container bitwise;
-    EventEmitterInterface<MemoryEvent>::Container memory;
-    EventEmitterInterface<BytecodeRetrievalEvent>::Container bytecode_retrieval;
-    EventEmitterInterface<BytecodeHashingEvent>::Container bytecode_hashing;
-    EventEmitterInterface<BytecodeDecompositionEvent>::Container bytecode_decomposition;
-    EventEmitterInterface<InstructionFetchingEvent>::Container instruction_fetching;
-    EventEmitterInterface<AddressDerivationEvent>::Container address_derivation;
-    EventEmitterInterface<ClassIdDerivationEvent>::Container class_id_derivation;
-    EventEmitterInterface<SiloingEvent>::Container siloing;
-    EventEmitterInterface<Sha256CompressionEvent>::Container sha256_compression;
-    EventEmitterInterface<EccAddEvent>::Container ecc_add;
-    EventEmitterInterface<ScalarMulEvent>::Container scalar_mul;
-    EventEmitterInterface<Poseidon2HashEvent>::Container poseidon2_hash;
-    EventEmitterInterface<Poseidon2PermutationEvent>::Container poseidon2_permutation;
-    EventEmitterInterface<ToRadixEvent>::Container to_radix;
-    EventEmitterInterface<FieldGreaterThanEvent>::Container field_gt;
-    EventEmitterInterface<MerkleCheckEvent>::Container merkle_check;
-    EventEmitterInterface<RangeCheckEvent>::Container range_check;
-    EventEmitterInterface<ContextStackEvent>::Container context_stack;
-    EventEmitterInterface<PublicDataTreeCheckEvent>::Container public_data_tree_check_events;
-    EventEmitterInterface<UpdateCheckEvent>::Container update_check_events;
-    EventEmitterInterface<NullifierTreeCheckEvent>::Container nullifier_tree_check_events;
+    EventArena<ExecutionEvent> execution;
+    EventArena<AluEvent> alu;
+    EventArena<BitwiseEvent> bitwise;
+    EventArena<MemoryEvent> memory;
+    EventArena<BytecodeRetrievalEvent> bytecode_retrieval;
+    EventArena<BytecodeHashingEvent> bytecode_hashing;
+    EventArena<BytecodeDecompositionEvent> bytecode_decomposition;
+    EventArena<InstructionFetchingEvent> instruction_fetching;
+    EventArena<AddressDerivationEvent> address_derivation;
+    EventArena<ClassIdDerivationEvent> class_id_derivation;
+    EventArena<SiloingEvent> siloing;
+    EventArena<Sha256CompressionEvent> sha256_compression;
+    EventArena<EccAddEvent> ecc_add;
+    EventArena<ScalarMulEvent> scalar_mul;
+    EventArena<Poseidon2HashEvent> poseidon2_hash;
+    EventArena<Poseidon2PermutationEvent> poseidon2_permutation;
+    EventArena<ToRadixEvent> to_radix;
+    EventArena<FieldGreaterThanEvent> field_gt;
+    EventArena<MerkleCheckEvent> merkle_check;
+    EventArena<RangeCheckEvent> range_check;
+    EventArena<ContextStackEvent> context_stack;
+    EventArena<PublicDataTreeCheckEvent> public_data_tree_check_events;
+    EventArena<UpdateCheckEvent> update_check_events;
+    EventArena<NullifierTreeCheckEvent> nullifier_tree_check_events;
+};
+
+// Sinks for the event types that can be streamed to tracegen in batches while the simulation runs.
+// The trace builders of these events append rows independently of the other events.
+struct EventBatchSinks {
+    size_t batch_size;
+    EventBatchSink<MemoryEvent> memory;
+    EventBatchSink<AluEvent> alu;
+    EventBatchSink<RangeCheckEvent> range_check;
+    EventBatchSink<FieldGreaterThanEvent> field_gt;
+    EventBatchSink<Poseidon2PermutationEvent> poseidon2_permutation;
 };
 
 } // namespace bb::avm2::simulation
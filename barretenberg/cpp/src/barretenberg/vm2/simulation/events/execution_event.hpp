@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 
@@ -35,12 +36,12 @@ struct ExecutionEvent {
     AddressingEvent addressing_event;
     ContextEvent context_event;
 
-    // Not thread safe.
+    // Txs can be simulated concurrently. The order is shared by all of them, but increasing within each one.
     static ExecutionEvent allocate()
     {
-        static uint32_t last_order = 0;
+        static std::atomic<uint32_t> last_order = 0;
         ExecutionEvent event;
-        event.order = last_order++;
+        event.order = last_order.fetch_add(1, std::memory_order_relaxed);
         return event;
     }
 
@@ -16,6 +16,8 @@ struct MemoryEvent {
     MemoryAddress addr;
     MemoryValue value;
     uint32_t space_id;
+
+    bool operator==(const MemoryEvent& other) const = default;
 };
 
 } // namespace bb::avm2::simulation
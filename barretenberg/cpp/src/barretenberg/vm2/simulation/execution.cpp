@@ -149,7 +149,7 @@ ExecutionResult Execution::execute_internal(ContextInterface& context)
             // We try to fetch an instruction.
             // WARNING: the bytecode has already been fetched in make_context. Maybe it is wrong and should be here.
             // But then we have no way to know the bytecode id when constructing the manager.
-            Instruction instruction = context.get_bytecode_manager().read_instruction(pc);
+            const Instruction& instruction = context.get_bytecode_manager().read_instruction(pc);
             ex_event.wire_instruction = instruction;
 
             // Go from a wire instruction to an execution opcode.
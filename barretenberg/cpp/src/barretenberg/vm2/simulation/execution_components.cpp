@@ -14,12 +14,13 @@ std::unique_ptr<ContextInterface> ExecutionComponentsProvider::make_nested_conte
                                                                                    bool is_static)
 {
     uint32_t context_id = next_context_id++;
+    auto memory = make_memory(get_memory_model(/*is_enqueued=*/false), context_id, range_check, memory_events);
     return std::make_unique<NestedContext>(context_id,
                                            address,
                                            msg_sender,
                                            is_static,
                                            std::make_unique<BytecodeManager>(address, tx_bytecode_manager),
-                                           std::make_unique<Memory>(context_id, range_check, memory_events),
+                                           std::move(memory),
                                            parent_context,
                                            cd_offset_address,
                                            cd_size_address);
@@ -32,12 +33,13 @@ std::unique_ptr<ContextInterface> ExecutionComponentsProvider::make_enqueued_con
 {
 
     uint32_t context_id = next_context_id++;
+    auto memory = make_memory(get_memory_model(/*is_enqueued=*/true), context_id, range_check, memory_events);
     return std::make_unique<EnqueuedCallContext>(context_id,
                                                  address,
                                                  msg_sender,
                                                  is_static,
                                                  std::make_unique<BytecodeManager>(address, tx_bytecode_manager),
-                                                 std::make_unique<Memory>(context_id, range_check, memory_events),
+                                                 std::move(memory),
                                                  calldata);
 }
 
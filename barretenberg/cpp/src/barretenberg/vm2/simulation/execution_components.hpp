@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <span>
 
 #include "barretenberg/vm2/common/aztec_types.hpp"
@@ -45,11 +46,13 @@ class ExecutionComponentsProvider : public ExecutionComponentsProviderInterface
     ExecutionComponentsProvider(TxBytecodeManagerInterface& tx_bytecode_manager,
                                 RangeCheckInterface& range_check,
                                 EventEmitterInterface<MemoryEvent>& memory_events,
-                                const InstructionInfoDBInterface& instruction_info_db)
+                                const InstructionInfoDBInterface& instruction_info_db,
+                                std::optional<MemoryModel> memory_model = std::nullopt)
         : tx_bytecode_manager(tx_bytecode_manager)
         , range_check(range_check)
         , memory_events(memory_events)
         , instruction_info_db(instruction_info_db)
+        , memory_model(memory_model)
     {}
     std::unique_ptr<ContextInterface> make_nested_context(AztecAddress address,
                                                           AztecAddress msg_sender,
@@ -64,6 +67,7 @@ class ExecutionComponentsProvider : public ExecutionComponentsProviderInterface
     std::unique_ptr<AddressingInterface> make_addressing(AddressingEvent& event) override;
 
     uint32_t get_next_context_id() override { return next_context_id; }
+    void set_memory_model(MemoryModel model) { memory_model = model; }
 
   private:
     uint32_t next_context_id = 1; // 0 is reserved to denote the parent of a top level context
@@ -72,6 +76,15 @@ class ExecutionComponentsProvider : public ExecutionComponentsProviderInterface
     RangeCheckInterface& range_check;
     EventEmitterInterface<MemoryEvent>& memory_events;
     const InstructionInfoDBInterface& instruction_info_db;
+    // If set, used for the memory of all the contexts created from now on (see get_memory_model).
+    std::optional<MemoryModel> memory_model;
+
+    // Enqueued calls run the bulk of a tx, on the mostly contiguous memory of contracts, so they use paged memory.
+    // Nested calls can be alive at once at every call depth and are often short, so they stay sparse.
+    MemoryModel get_memory_model(bool is_enqueued) const
+    {
+        return memory_model.value_or(is_enqueued ? MemoryModel::PAGED : MemoryModel::SPARSE);
+    }
 
     // Sadly someone has to own these.
     // TODO(fcarreiro): We are creating one of these per execution row and only releasing them at
@@ -0,0 +1,67 @@
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
+
+#include <cassert>
+
+namespace bb::avm2::simulation {
+
+DecodedInstruction decode_instruction(std::span<const uint8_t> bytecode, uint32_t pc)
+{
+    DecodedInstruction decoded;
+    try {
+        decoded.instruction = deserialize_instruction(bytecode, pc);
+
+        // If the following code is executed, no error was thrown in deserialize_instruction().
+        if (!check_tag(decoded.instruction)) {
+            decoded.error = InstrDeserializationError::TAG_OUT_OF_RANGE;
+        }
+    } catch (const InstrDeserializationError& error) {
+        assert(error != InstrDeserializationError::TAG_OUT_OF_RANGE);
+        decoded.error = error;
+    }
+    return decoded;
+}
+
+DecodedBytecode::DecodedBytecode(std::shared_ptr<std::vector<uint8_t>> bytecode)
+    : bytecode(std::move(bytecode))
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    , instructions(std::make_unique<std::atomic<const DecodedInstruction*>[]>(this->bytecode->size()))
+    , out_of_range(decode_instruction(*this->bytecode, static_cast<uint32_t>(this->bytecode->size())))
+{}
+
+DecodedBytecode::~DecodedBytecode()
+{
+    for (size_t pc = 0; pc < bytecode->size(); ++pc) {
+        delete instructions[pc].load(std::memory_order_relaxed);
+    }
+}
+
+const DecodedInstruction& DecodedBytecode::get_instruction(uint32_t pc)
+{
+    if (pc >= bytecode->size()) {
+        return out_of_range;
+    }
+    auto& instruction = instructions[pc];
+    const DecodedInstruction* decoded = instruction.load(std::memory_order_acquire);
+    if (decoded == nullptr) {
+        auto new_decoded = std::make_unique<const DecodedInstruction>(decode_instruction(*bytecode, pc));
+        // Another reader might have decoded the same pc meanwhile, in which case we use its instruction.
+        if (instruction.compare_exchange_strong(
+                decoded, new_decoded.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+            decoded = new_decoded.release();
+        }
+    }
+    return *decoded;
+}
+
+std::shared_ptr<DecodedBytecode> DecodedBytecodeCache::get(const ContractClassId& class_id,
+                                                           std::shared_ptr<std::vector<uint8_t>> bytecode)
+{
+    std::lock_guard lock(mutex);
+    auto& decoded_bytecode = decoded_bytecodes[class_id];
+    if (decoded_bytecode == nullptr) {
+        decoded_bytecode = std::make_shared<DecodedBytecode>(std::move(bytecode));
+    }
+    return decoded_bytecode;
+}
+
+} // namespace bb::avm2::simulation
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "barretenberg/vm2/common/aztec_types.hpp"
+#include "barretenberg/vm2/common/map.hpp"
+#include "barretenberg/vm2/simulation/lib/serialization.hpp"
+
+namespace bb::avm2::simulation {
+
+// The instruction at some pc of a bytecode, or the error found while decoding it.
+struct DecodedInstruction {
+    Instruction instruction;
+    std::optional<InstrDeserializationError> error;
+};
+
+// Deserializes the instruction at the given pc and checks its tag.
+DecodedInstruction decode_instruction(std::span<const uint8_t> bytecode, uint32_t pc);
+
+// The instructions of a bytecode, indexed by pc. Each instruction is decoded the first time its pc is read, so that
+// loops do not decode the same instructions again. Can be read concurrently.
+class DecodedBytecode {
+  public:
+    explicit DecodedBytecode(std::shared_ptr<std::vector<uint8_t>> bytecode);
+    DecodedBytecode(const DecodedBytecode& other) = delete;
+    DecodedBytecode(DecodedBytecode&& other) = delete;
+    DecodedBytecode& operator=(const DecodedBytecode& other) = delete;
+    DecodedBytecode& operator=(DecodedBytecode&& other) = delete;
+    ~DecodedBytecode();
+
+    const DecodedInstruction& get_instruction(uint32_t pc);
+    const std::shared_ptr<std::vector<uint8_t>>& get_bytecode() const { return bytecode; }
+
+  private:
+    std::shared_ptr<std::vector<uint8_t>> bytecode;
+    // Null until the instruction at that pc is decoded.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::unique_ptr<std::atomic<const DecodedInstruction*>[]> instructions;
+    // Returned for every pc out of the bytecode.
+    DecodedInstruction out_of_range;
+};
+
+// The decoded bytecodes of the contract classes. It can be shared by the simulations of several txs (e.g., the ones of
+// a block), so that the bytecode of a class is only decoded once. Thread-safe.
+class DecodedBytecodeCache {
+  public:
+    // The bytecode must be the one of the class, it is only used the first time the class is seen.
+    std::shared_ptr<DecodedBytecode> get(const ContractClassId& class_id,
+                                         std::shared_ptr<std::vector<uint8_t>> bytecode);
+
+  private:
+    std::mutex mutex;
+    unordered_flat_map<ContractClassId, std::shared_ptr<DecodedBytecode>> decoded_bytecodes;
+};
+
+} // namespace bb::avm2::simulation
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
+#include "barretenberg/vm2/simulation/lib/serialization.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+std::shared_ptr<std::vector<uint8_t>> make_bytecode()
+{
+    const std::vector<Instruction> instructions = {
+        { .opcode = WireOpCode::SET_16,
+          .indirect = 0,
+          .operands = { Operand::from<uint16_t>(10),
+                        Operand::from<uint8_t>(static_cast<uint8_t>(MemoryTag::U16)),
+                        Operand::from<uint16_t>(1) } },
+        { .opcode = WireOpCode::ADD_8,
+          .indirect = 0,
+          .operands = { Operand::from<uint8_t>(10), Operand::from<uint8_t>(10), Operand::from<uint8_t>(11) } },
+        // Tag out of range.
+        { .opcode = WireOpCode::SET_8,
+          .indirect = 0,
+          .operands = { Operand::from<uint8_t>(10), Operand::from<uint8_t>(42), Operand::from<uint8_t>(1) } },
+    };
+    auto bytecode = std::make_shared<std::vector<uint8_t>>();
+    for (const auto& instruction : instructions) {
+        const auto serialized = instruction.serialize();
+        bytecode->insert(bytecode->end(), serialized.begin(), serialized.end());
+    }
+    // Opcode out of range.
+    bytecode->push_back(0xff);
+    return bytecode;
+}
+
+void expect_decoded(const DecodedInstruction& decoded, const std::vector<uint8_t>& bytecode, uint32_t pc)
+{
+    const auto expected = decode_instruction(bytecode, pc);
+    EXPECT_EQ(decoded.instruction, expected.instruction) << "pc " << pc;
+    EXPECT_EQ(decoded.error, expected.error) << "pc " << pc;
+}
+
+TEST(DecodedBytecodeTest, DecodesEveryPc)
+{
+    auto bytecode = make_bytecode();
+    DecodedBytecode decoded_bytecode(bytecode);
+
+    // Pcs in the middle of instructions are decoded as well, as a jump can land anywhere.
+    for (uint32_t pc = 0; pc < bytecode->size() + 2; ++pc) {
+        expect_decoded(decoded_bytecode.get_instruction(pc), *bytecode, pc);
+    }
+    EXPECT_FALSE(decoded_bytecode.get_instruction(0).error.has_value());
+    EXPECT_EQ(decoded_bytecode.get_instruction(static_cast<uint32_t>(bytecode->size())).error,
+              InstrDeserializationError::PC_OUT_OF_RANGE);
+    EXPECT_EQ(decoded_bytecode.get_instruction(static_cast<uint32_t>(bytecode->size() - 1)).error,
+              InstrDeserializationError::OPCODE_OUT_OF_RANGE);
+}
+
+TEST(DecodedBytecodeTest, DecodesOnce)
+{
+    DecodedBytecode decoded_bytecode(make_bytecode());
+
+    const DecodedInstruction* first = &decoded_bytecode.get_instruction(5);
+    EXPECT_EQ(&decoded_bytecode.get_instruction(5), first);
+}
+
+TEST(DecodedBytecodeTest, ConcurrentReads)
+{
+    auto bytecode = make_bytecode();
+    DecodedBytecode decoded_bytecode(bytecode);
+    const auto num_pcs = static_cast<uint32_t>(bytecode->size());
+
+    std::vector<const DecodedInstruction*> read(num_pcs * 8);
+    parallel_for(read.size(), [&](size_t i) {
+        read[i] = &decoded_bytecode.get_instruction(static_cast<uint32_t>(i % num_pcs));
+    });
+
+    for (size_t i = 0; i < read.size(); ++i) {
+        EXPECT_EQ(read[i], &decoded_bytecode.get_instruction(static_cast<uint32_t>(i % num_pcs)));
+        expect_decoded(*read[i], *bytecode, static_cast<uint32_t>(i % num_pcs));
+    }
+}
+
+TEST(DecodedBytecodeCacheTest, SharedByClassId)
+{
+    DecodedBytecodeCache cache;
+    auto bytecode = make_bytecode();
+
+    auto decoded_bytecode = cache.get(ContractClassId(1), bytecode);
+    EXPECT_EQ(decoded_bytecode->get_bytecode(), bytecode);
+    // The bytecode of a known class is not used.
+    EXPECT_EQ(cache.get(ContractClassId(1), std::make_shared<std::vector<uint8_t>>(*bytecode)), decoded_bytecode);
+    EXPECT_NE(cache.get(ContractClassId(2), bytecode), decoded_bytecode);
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
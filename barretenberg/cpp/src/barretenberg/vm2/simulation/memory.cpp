@@ -20,23 +20,83 @@ bool MemoryInterface::is_valid_address(const MemoryValue& address)
     return is_valid_address(address.as_ff()) && address.get_tag() == MemoryAddressTag;
 }
 
-void Memory::set(MemoryAddress index, MemoryValue value)
+namespace {
+
+const MemoryValue& default_value()
+{
+    static const auto value = MemoryValue::from<FF>(0);
+    return value;
+}
+
+} // namespace
+
+const MemoryValue& SparseMemoryStorage::get(MemoryAddress index) const
+{
+    auto it = memory.find(index);
+    return it != memory.end() ? it->second : default_value();
+}
+
+PagedMemoryStorage::Page* PagedMemoryStorage::find_page(uint32_t page_index) const
+{
+    if (last_page != nullptr && last_page_index == page_index) {
+        return last_page;
+    }
+    auto it = pages.find(page_index);
+    if (it == pages.end()) {
+        return nullptr;
+    }
+    last_page_index = page_index;
+    last_page = it->second.get();
+    return last_page;
+}
+
+const MemoryValue& PagedMemoryStorage::get(MemoryAddress index) const
+{
+    const Page* page = find_page(page_index(index));
+    return page != nullptr ? (*page)[index % PAGE_SIZE] : overflow.get(index);
+}
+
+void PagedMemoryStorage::set(MemoryAddress index, const MemoryValue& value)
+{
+    if (Page* page = get_or_create_page(index); page != nullptr) {
+        (*page)[index % PAGE_SIZE] = value;
+        return;
+    }
+    overflow.set(index, value);
+}
+
+PagedMemoryStorage::Page* PagedMemoryStorage::get_or_create_page(MemoryAddress index)
+{
+    const uint32_t page_idx = page_index(index);
+    if (Page* page = find_page(page_idx); page != nullptr) {
+        return page;
+    }
+    // Pages are never created after this point, so the addresses of the overflow never get a page.
+    if (pages.size() >= MAX_PAGES) {
+        return nullptr;
+    }
+    auto page = std::make_unique<Page>();
+    page->fill(default_value());
+    last_page_index = page_idx;
+    last_page = page.get();
+    pages.emplace(page_idx, std::move(page));
+    return last_page;
+}
+
+template <typename Storage> void MemoryWithStorage<Storage>::set(MemoryAddress index, MemoryValue value)
 {
     // TODO: validate address?
     // TODO: reconsider tag validation.
     validate_tag(value);
-    memory[index] = value;
+    memory.set(index, value);
     debug("Memory write: ", index, " <- ", value.to_string());
     events.emit({ .mode = MemoryMode::WRITE, .addr = index, .value = value, .space_id = space_id });
 }
 
-const MemoryValue& Memory::get(MemoryAddress index) const
+template <typename Storage> const MemoryValue& MemoryWithStorage<Storage>::get(MemoryAddress index) const
 {
     // TODO: validate address?
-    static const auto default_value = MemoryValue::from<FF>(0);
-
-    auto it = memory.find(index);
-    const auto& vt = it != memory.end() ? it->second : default_value;
+    const auto& vt = memory.get(index);
     events.emit({ .mode = MemoryMode::READ, .addr = index, .value = vt, .space_id = space_id });
 
     debug("Memory read: ", index, " -> ", vt.to_string());
@@ -45,7 +105,7 @@ const MemoryValue& Memory::get(MemoryAddress index) const
 
 // Sadly this is circuit leaking. In simulation we know the tag-value is consistent.
 // But the circuit does need to force a range check.
-void Memory::validate_tag(const MemoryValue& value) const
+template <typename Storage> void MemoryWithStorage<Storage>::validate_tag(const MemoryValue& value) const
 {
     if (value.get_tag() == MemoryTag::FF) {
         return;
@@ -56,4 +116,21 @@ void Memory::validate_tag(const MemoryValue& value) const
     range_check.assert_range(value_as_uint128, tag_bits);
 }
 
+template class MemoryWithStorage<SparseMemoryStorage>;
+template class MemoryWithStorage<PagedMemoryStorage>;
+
+std::unique_ptr<MemoryInterface> make_memory(MemoryModel model,
+                                             uint32_t space_id,
+                                             RangeCheckInterface& range_check,
+                                             EventEmitterInterface<MemoryEvent>& event_emitter)
+{
+    switch (model) {
+    case MemoryModel::SPARSE:
+        return std::make_unique<Memory>(space_id, range_check, event_emitter);
+    case MemoryModel::PAGED:
+        return std::make_unique<PagedMemory>(space_id, range_check, event_emitter);
+    }
+    __builtin_unreachable();
+}
+
 } // namespace bb::avm2::simulation
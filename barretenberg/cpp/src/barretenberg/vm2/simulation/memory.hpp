@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 #include "barretenberg/vm2/common/map.hpp"
@@ -25,9 +28,60 @@ class MemoryInterface {
     static bool is_valid_address(const FF& address);
 };
 
-class Memory : public MemoryInterface {
+// How the values of a memory space are stored.
+enum class MemoryModel {
+    // A hash map from address to value. Best for a few scattered addresses.
+    SPARSE,
+    // Lazily allocated fixed-size pages. Best for contiguous address ranges, which is what contracts mostly use.
+    // The number of pages is capped, so scattered writes (e.g., by hostile bytecode) fall back to a hash map.
+    PAGED,
+};
+
+// Unset addresses read as FF(0) in both storages.
+class SparseMemoryStorage {
   public:
-    Memory(uint32_t space_id, RangeCheckInterface& range_check, EventEmitterInterface<MemoryEvent>& event_emitter)
+    const MemoryValue& get(MemoryAddress index) const;
+    void set(MemoryAddress index, const MemoryValue& value) { memory[index] = value; }
+
+  private:
+    unordered_flat_map<MemoryAddress, MemoryValue> memory;
+};
+
+class PagedMemoryStorage {
+  public:
+    static constexpr size_t LOG_PAGE_SIZE = 10;
+    static constexpr size_t PAGE_SIZE = 1 << LOG_PAGE_SIZE;
+    // Each page allocates PAGE_SIZE values on its first write. Once this many pages exist, addresses of other pages are
+    // stored sparsely, which bounds the memory spent on mostly empty pages.
+    static constexpr size_t MAX_PAGES = 64;
+
+    const MemoryValue& get(MemoryAddress index) const;
+    void set(MemoryAddress index, const MemoryValue& value);
+
+    size_t num_pages() const { return pages.size(); }
+
+  private:
+    using Page = std::array<MemoryValue, PAGE_SIZE>;
+
+    static uint32_t page_index(MemoryAddress index) { return index >> LOG_PAGE_SIZE; }
+    Page* find_page(uint32_t page_index) const;
+    // Returns nullptr if the page does not exist and no more pages can be created.
+    Page* get_or_create_page(MemoryAddress index);
+
+    unordered_flat_map<uint32_t, std::unique_ptr<Page>> pages;
+    // The values of the addresses whose page could not be created.
+    SparseMemoryStorage overflow;
+    // Accesses are mostly to the same page as the previous one, so we save the lookup.
+    // Pages never move, so the pointer survives rehashing the map.
+    mutable uint32_t last_page_index = 0;
+    mutable Page* last_page = nullptr;
+};
+
+template <typename Storage> class MemoryWithStorage : public MemoryInterface {
+  public:
+    MemoryWithStorage(uint32_t space_id,
+                      RangeCheckInterface& range_check,
+                      EventEmitterInterface<MemoryEvent>& event_emitter)
         : space_id(space_id)
         , range_check(range_check)
         , events(event_emitter)
@@ -40,7 +94,7 @@ class Memory : public MemoryInterface {
 
   private:
     uint32_t space_id;
-    unordered_flat_map<size_t, MemoryValue> memory;
+    Storage memory;
 
     RangeCheckInterface& range_check;
     // TODO: consider a deduplicating event emitter (within the same clk).
@@ -49,6 +103,14 @@ class Memory : public MemoryInterface {
     void validate_tag(const MemoryValue& value) const;
 };
 
+using Memory = MemoryWithStorage<SparseMemoryStorage>;
+using PagedMemory = MemoryWithStorage<PagedMemoryStorage>;
+
+std::unique_ptr<MemoryInterface> make_memory(MemoryModel model,
+                                             uint32_t space_id,
+                                             RangeCheckInterface& range_check,
+                                             EventEmitterInterface<MemoryEvent>& event_emitter);
+
 // Just a map that doesn't emit events or do anything else.
 class MemoryStore : public MemoryInterface {
   public:
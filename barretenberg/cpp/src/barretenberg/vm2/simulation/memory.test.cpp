@@ -0,0 +1,117 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/simulation/events/memory_event.hpp"
+#include "barretenberg/vm2/simulation/memory.hpp"
+#include "barretenberg/vm2/simulation/testing/mock_range_check.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::StrictMock;
+
+template <typename MemoryType> class MemorySimulationTest : public ::testing::Test {};
+
+using MemoryTypes = ::testing::Types<Memory, PagedMemory>;
+TYPED_TEST_SUITE(MemorySimulationTest, MemoryTypes);
+
+TYPED_TEST(MemorySimulationTest, ReadsAndWrites)
+{
+    StrictMock<MockRangeCheck> range_check;
+    EventEmitter<MemoryEvent> emitter;
+    TypeParam memory(/*space_id=*/7, range_check, emitter);
+
+    const auto value = MemoryValue::from<uint32_t>(42);
+    EXPECT_CALL(range_check, assert_range(42, 32));
+    memory.set(10, value);
+
+    EXPECT_EQ(memory.get(10), value);
+    // Unset addresses read as FF(0).
+    EXPECT_EQ(memory.get(11), MemoryValue::from<FF>(0));
+
+    EXPECT_THAT(emitter.dump_events(),
+                ElementsAre(MemoryEvent{ .mode = MemoryMode::WRITE, .addr = 10, .value = value, .space_id = 7 },
+                            MemoryEvent{ .mode = MemoryMode::READ, .addr = 10, .value = value, .space_id = 7 },
+                            MemoryEvent{ .mode = MemoryMode::READ,
+                                         .addr = 11,
+                                         .value = MemoryValue::from<FF>(0),
+                                         .space_id = 7 }));
+}
+
+TYPED_TEST(MemorySimulationTest, FarApartAddresses)
+{
+    StrictMock<MockRangeCheck> range_check;
+    NoopEventEmitter<MemoryEvent> emitter;
+    TypeParam memory(/*space_id=*/1, range_check, emitter);
+
+    const MemoryAddress addresses[] = { 0, 1, 1023, 1024, 1025, 0xFFFF, 0x7FFFFFFF, 0xFFFFFFFF };
+    for (MemoryAddress addr : addresses) {
+        memory.set(addr, MemoryValue::from<FF>(FF(addr) + 1));
+    }
+    for (MemoryAddress addr : addresses) {
+        EXPECT_EQ(memory.get(addr), MemoryValue::from<FF>(FF(addr) + 1));
+    }
+    EXPECT_EQ(memory.get(2), MemoryValue::from<FF>(0));
+    EXPECT_EQ(memory.get(0xFFFFFFFE), MemoryValue::from<FF>(0));
+}
+
+TEST(PagedMemoryStorageTest, AllocatesPagesLazily)
+{
+    PagedMemoryStorage storage;
+    EXPECT_EQ(storage.get(5), MemoryValue::from<FF>(0));
+    EXPECT_EQ(storage.num_pages(), 0);
+
+    storage.set(5, MemoryValue::from<uint8_t>(1));
+    storage.set(PagedMemoryStorage::PAGE_SIZE - 1, MemoryValue::from<uint8_t>(2));
+    EXPECT_EQ(storage.num_pages(), 1);
+
+    storage.set(PagedMemoryStorage::PAGE_SIZE, MemoryValue::from<uint8_t>(3));
+    EXPECT_EQ(storage.num_pages(), 2);
+
+    EXPECT_EQ(storage.get(5), MemoryValue::from<uint8_t>(1));
+    EXPECT_EQ(storage.get(PagedMemoryStorage::PAGE_SIZE - 1), MemoryValue::from<uint8_t>(2));
+    EXPECT_EQ(storage.get(PagedMemoryStorage::PAGE_SIZE), MemoryValue::from<uint8_t>(3));
+    EXPECT_EQ(storage.get(PagedMemoryStorage::PAGE_SIZE + 1), MemoryValue::from<FF>(0));
+}
+
+TEST(PagedMemoryStorageTest, CapsThePages)
+{
+    PagedMemoryStorage storage;
+    // Writes far apart would allocate a page each.
+    const size_t num_writes = PagedMemoryStorage::MAX_PAGES + 10;
+    for (size_t i = 0; i < num_writes; ++i) {
+        const auto index = static_cast<MemoryAddress>(i * PagedMemoryStorage::PAGE_SIZE);
+        storage.set(index, MemoryValue::from<uint32_t>(static_cast<uint32_t>(i + 1)));
+    }
+    EXPECT_EQ(storage.num_pages(), PagedMemoryStorage::MAX_PAGES);
+
+    for (size_t i = 0; i < num_writes; ++i) {
+        const auto index = static_cast<MemoryAddress>(i * PagedMemoryStorage::PAGE_SIZE);
+        EXPECT_EQ(storage.get(index), MemoryValue::from<uint32_t>(static_cast<uint32_t>(i + 1)));
+        EXPECT_EQ(storage.get(index + 1), MemoryValue::from<FF>(0));
+    }
+    // Existing pages are still used, overflowed ones are overwritten in place.
+    const auto last_index = static_cast<MemoryAddress>((num_writes - 1) * PagedMemoryStorage::PAGE_SIZE);
+    storage.set(3, MemoryValue::from<uint8_t>(7));
+    storage.set(last_index, MemoryValue::from<uint8_t>(8));
+    EXPECT_EQ(storage.num_pages(), PagedMemoryStorage::MAX_PAGES);
+    EXPECT_EQ(storage.get(3), MemoryValue::from<uint8_t>(7));
+    EXPECT_EQ(storage.get(last_index), MemoryValue::from<uint8_t>(8));
+}
+
+TEST(MemorySimulationTest, MakeMemory)
+{
+    StrictMock<MockRangeCheck> range_check;
+    NoopEventEmitter<MemoryEvent> emitter;
+    EXPECT_NE(dynamic_cast<Memory*>(make_memory(MemoryModel::SPARSE, 1, range_check, emitter).get()), nullptr);
+    EXPECT_NE(dynamic_cast<PagedMemory*>(make_memory(MemoryModel::PAGED, 1, range_check, emitter).get()), nullptr);
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
@@ -16,7 +16,7 @@ class MockBytecodeManager : public BytecodeManagerInterface {
     MockBytecodeManager();
     ~MockBytecodeManager() override;
 
-    MOCK_METHOD(Instruction, read_instruction, (uint32_t pc), (override));
+    MOCK_METHOD(const Instruction&, read_instruction, (uint32_t pc), (override));
     MOCK_METHOD(BytecodeId, get_bytecode_id, (), (override));
 };
 
@@ -65,7 +65,7 @@ struct FastSettings {
 
 } // namespace
 
-template <typename S> EventsContainer AvmSimulationHelper::simulate_with_settings()
+template <typename S> EventsContainer AvmSimulationHelper::simulate_with_settings(EventBatchSinks* sinks)
 {
     typename S::template DefaultEventEmitter<ExecutionEvent> execution_emitter;
     typename S::template DefaultDeduplicatingEventEmitter<AluEvent> alu_emitter;
@@ -123,7 +123,8 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
                                        current_block_number,
                                        bytecode_retrieval_emitter,
                                        bytecode_decomposition_emitter,
-                                       instruction_fetching_emitter);
+                                       instruction_fetching_emitter,
+                                       *decoded_bytecode_cache);
     ExecutionComponentsProvider execution_components(
         bytecode_manager, range_check, memory_emitter, instruction_info_db);
 
@@ -132,32 +133,48 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
     TxExecution tx_execution(execution, merkle_db);
     Sha256 sha256(sha256_compression_emitter);
 
+    if (sinks != nullptr) {
+        memory_emitter.stream_to(sinks->memory, sinks->batch_size);
+        alu_emitter.stream_to(sinks->alu, sinks->batch_size);
+        range_check_emitter.stream_to(sinks->range_check, sinks->batch_size);
+        field_gt_emitter.stream_to(sinks->field_gt, sinks->batch_size);
+        poseidon2_perm_emitter.stream_to(sinks->poseidon2_permutation, sinks->batch_size);
+    }
+
     tx_execution.simulate(hints.tx);
 
-    return { execution_emitter.dump_events(),
-             alu_emitter.dump_events(),
-             bitwise_emitter.dump_events(),
-             memory_emitter.dump_events(),
-             bytecode_retrieval_emitter.dump_events(),
-             bytecode_hashing_emitter.dump_events(),
-             bytecode_decomposition_emitter.dump_events(),
-             instruction_fetching_emitter.dump_events(),
-             address_derivation_emitter.dump_events(),
-             class_id_derivation_emitter.dump_events(),
-             siloing_emitter.dump_events(),
-             sha256_compression_emitter.dump_events(),
-             ecc_add_emitter.dump_events(),
-             scalar_mul_emitter.dump_events(),
-             poseidon2_hash_emitter.dump_events(),
-             poseidon2_perm_emitter.dump_events(),
-             to_radix_emitter.dump_events(),
-             field_gt_emitter.dump_events(),
-             merkle_check_emitter.dump_events(),
-             range_check_emitter.dump_events(),
-             context_stack_emitter.dump_events(),
-             public_data_tree_check_emitter.dump_events(),
-             update_check_emitter.dump_events(),
-             nullifier_tree_check_emitter.dump_events() };
+    if (sinks != nullptr) {
+        memory_emitter.flush();
+        alu_emitter.flush();
+        range_check_emitter.flush();
+        field_gt_emitter.flush();
+        poseidon2_perm_emitter.flush();
+    }
+
+    return { execution_emitter.take_events(),
+             alu_emitter.take_events(),
+             bitwise_emitter.take_events(),
+             memory_emitter.take_events(),
+             bytecode_retrieval_emitter.take_events(),
+             bytecode_hashing_emitter.take_events(),
+             bytecode_decomposition_emitter.take_events(),
+             instruction_fetching_emitter.take_events(),
+             address_derivation_emitter.take_events(),
+             class_id_derivation_emitter.take_events(),
+             siloing_emitter.take_events(),
+             sha256_compression_emitter.take_events(),
+             ecc_add_emitter.take_events(),
+             scalar_mul_emitter.take_events(),
+             poseidon2_hash_emitter.take_events(),
+             poseidon2_perm_emitter.take_events(),
+             to_radix_emitter.take_events(),
+             field_gt_emitter.take_events(),
+             merkle_check_emitter.take_events(),
+             range_check_emitter.take_events(),
+             context_stack_emitter.take_events(),
+             public_data_tree_check_emitter.take_events(),
+             update_check_emitter.take_events(),
+             nullifier_tree_check_emitter.take_events() };
 }
 
 EventsContainer AvmSimulationHelper::simulate()
@@ -165,6 +182,11 @@ EventsContainer AvmSimulationHelper::simulate()
     return simulate_with_settings<ProvingSettings>();
 }
 
+EventsContainer AvmSimulationHelper::simulate(EventBatchSinks& sinks)
+{
+    return simulate_with_settings<ProvingSettings>(&sinks);
+}
+
 void AvmSimulationHelper::simulate_fast()
 {
     simulate_with_settings<FastSettings>();
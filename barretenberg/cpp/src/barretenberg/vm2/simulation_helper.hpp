@@ -1,7 +1,10 @@
 #pragma once
 
+#include <memory>
+
 #include "barretenberg/vm2/common/avm_inputs.hpp"
 #include "barretenberg/vm2/simulation/events/events_container.hpp"
+#include "barretenberg/vm2/simulation/lib/decoded_bytecode.hpp"
 
 namespace bb::avm2 {
 
@@ -9,18 +12,29 @@ class AvmSimulationHelper {
   public:
     AvmSimulationHelper(ExecutionHints hints)
         : hints(std::move(hints))
+        , decoded_bytecode_cache(std::make_shared<simulation::DecodedBytecodeCache>())
+    {}
+    // The cache can be shared with the simulations of other txs, e.g. the ones of the same block.
+    AvmSimulationHelper(ExecutionHints hints, std::shared_ptr<simulation::DecodedBytecodeCache> decoded_bytecode_cache)
+        : hints(std::move(hints))
+        , decoded_bytecode_cache(std::move(decoded_bytecode_cache))
     {}
 
     // Full simulation with event collection.
     simulation::EventsContainer simulate();
+    // Full simulation where the events supported by the sinks are streamed to them in batches, while simulating.
+    // These events are not part of the returned container.
+    simulation::EventsContainer simulate(simulation::EventBatchSinks& sinks);
 
     // Fast simulation without event collection.
     void simulate_fast();
 
   private:
-    template <typename S> simulation::EventsContainer simulate_with_settings();
+    template <typename S>
+    simulation::EventsContainer simulate_with_settings(simulation::EventBatchSinks* sinks = nullptr);
 
     ExecutionHints hints;
+    std::shared_ptr<simulation::DecodedBytecodeCache> decoded_bytecode_cache;
 };
 
 } // namespace bb::avm2
@@ -15,15 +15,14 @@
 
 namespace bb::avm2::tracegen {
 
-void AddressDerivationTraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::AddressDerivationEvent>::Container& events,
-    TraceContainer& trace)
+void AddressDerivationTraceBuilder::process(std::span<const simulation::AddressDerivationEvent> events,
+                                            TraceContainer& trace)
 {
     using C = Column;
 
     EmbeddedCurvePoint g1 = EmbeddedCurvePoint::one();
 
-    uint32_t row = 0;
+    uint32_t row = next_row;
     for (const auto& event : events) {
         trace.set(
             row,
@@ -55,6 +54,7 @@ void AddressDerivationTraceBuilder::process(
                 { C::address_derivation_address_y, event.address_point.y() } } });
         row++;
     }
+    next_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> AddressDerivationTraceBuilder::lookup_jobs()
@@ -25,12 +25,11 @@ Column get_operation_selector(simulation::AluOperation operation)
 
 } // namespace
 
-void AluTraceBuilder::process(const simulation::EventEmitterInterface<simulation::AluEvent>::Container& events,
-                              TraceContainer& trace)
+void AluTraceBuilder::process(std::span<const simulation::AluEvent> events, TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
+    uint32_t row = next_row;
     for (const auto& event : events) {
         C opcode_selector = get_operation_selector(event.operation);
 
@@ -46,6 +45,7 @@ void AluTraceBuilder::process(const simulation::EventEmitterInterface<simulation
 
         row++;
     }
+    next_row = row;
 }
 
 } // namespace bb::avm2::tracegen
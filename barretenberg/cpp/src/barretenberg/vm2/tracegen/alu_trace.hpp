@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
+
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/simulation/events/alu_event.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
@@ -10,7 +13,16 @@ namespace bb::avm2::tracegen {
 class AluTraceBuilder final {
   public:
     void process(const simulation::EventEmitterInterface<simulation::AluEvent>::Container& events,
-                 TraceContainer& trace);
+                 TraceContainer& trace)
+    {
+        process(std::span<const simulation::AluEvent>(events), trace);
+    }
+    // Also takes the chunks of the batches streamed from the simulation.
+    void process(std::span<const simulation::AluEvent> events, TraceContainer& trace);
+
+  private:
+    // Rows are appended across calls to process(), so that events can be processed in batches.
+    uint32_t next_row = 0;
 };
 
 } // namespace bb::avm2::tracegen
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "barretenberg/vm2/generated/relations/lookups_bitwise.hpp"
+#include "barretenberg/vm2/generated/relations/lookups_range_check.hpp"
+#include "barretenberg/vm2/tracegen/lib/lookup_builder.hpp"
+#include "barretenberg/vm2/tracegen/lib/lookup_into_bitwise.hpp"
+#include "barretenberg/vm2/tracegen/lib/lookup_into_indexed_by_clk.hpp"
+#include "barretenberg/vm2/tracegen/precomputed_trace.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+using namespace bb::avm2::tracegen;
+
+namespace {
+
+using C = Column;
+
+// Pseudo-random byte or 16-bit values, skewed towards small ones as in real traces.
+uint32_t sample_value(uint32_t row, uint32_t num_bits)
+{
+    return (row * 2654435761U) >> (32 - num_bits + (row % 4));
+}
+
+void fill_range_check_rows(TraceContainer& trace, uint32_t num_rows)
+{
+    PrecomputedTraceBuilder precomputed_builder;
+    precomputed_builder.process_misc(trace, 1 << 16);
+    precomputed_builder.process_sel_range_16(trace);
+    for (uint32_t row = 0; row < num_rows; ++row) {
+        const uint32_t value = sample_value(row, 16);
+        trace.set(row, { { { C::range_check_sel_r0_16_bit_rng_lookup, 1 }, { C::range_check_u16_r0, value } } });
+    }
+}
+
+void fill_bitwise_rows(TraceContainer& trace, uint32_t num_rows)
+{
+    PrecomputedTraceBuilder precomputed_builder;
+    precomputed_builder.process_misc(trace, 1 << 16);
+    precomputed_builder.process_bitwise(trace);
+    for (uint32_t row = 0; row < num_rows; ++row) {
+        const uint32_t a = sample_value(row, 8);
+        const uint32_t b = sample_value(row + 1, 8);
+        // Row of the AND operation in the precomputed table.
+        const uint32_t dst_row = (a << 8) | b;
+        trace.set(row,
+                  { { { C::bitwise_sel, 1 },
+                      { C::bitwise_op_id, 0 },
+                      { C::bitwise_ia_byte, a },
+                      { C::bitwise_ib_byte, b },
+                      { C::bitwise_ic_byte, trace.get(C::precomputed_bitwise_output, dst_row) } } });
+    }
+}
+
+/**
+ * @brief Computation of the counts of a lookup with 2**n source rows. Compare with HARDWARE_CONCURRENCY=1 for the
+ * serial baseline.
+ */
+template <template <typename> class Builder, typename Settings>
+void lookup_counts(State& state, void (*fill_rows)(TraceContainer&, uint32_t))
+{
+    const auto num_rows = static_cast<uint32_t>(1 << state.range(0));
+    TraceContainer trace;
+    fill_rows(trace, num_rows);
+
+    for (auto _ : state) {
+        Builder<Settings>().process(trace);
+        state.PauseTiming();
+        trace.clear_column(Settings::COUNTS);
+        trace.clear_column(Settings::INVERSES);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_rows);
+}
+
+void lookup_range_check_u16(State& state)
+{
+    lookup_counts<LookupIntoIndexedByClk, lookup_range_check_r0_is_u16_settings>(state, fill_range_check_rows);
+}
+
+void lookup_range_check_u16_dynamic(State& state)
+{
+    lookup_counts<LookupIntoDynamicTableGeneric, lookup_range_check_r0_is_u16_settings>(state, fill_range_check_rows);
+}
+
+void lookup_bitwise(State& state)
+{
+    lookup_counts<LookupIntoBitwise, lookup_bitwise_byte_operations_settings>(state, fill_bitwise_rows);
+}
+
+} // namespace
+
+BENCHMARK(lookup_range_check_u16)->DenseRange(16, 20, 2)->Unit(kMillisecond)->UseRealTime();
+BENCHMARK(lookup_range_check_u16_dynamic)->DenseRange(16, 20, 2)->Unit(kMillisecond)->UseRealTime();
+BENCHMARK(lookup_bitwise)->DenseRange(16, 20, 2)->Unit(kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
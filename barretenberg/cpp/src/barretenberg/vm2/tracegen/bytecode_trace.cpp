@@ -26,14 +26,12 @@ using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldPar
 
 namespace bb::avm2::tracegen {
 
-void BytecodeTraceBuilder::process_decomposition(
-    const simulation::EventEmitterInterface<simulation::BytecodeDecompositionEvent>::Container& events,
-    TraceContainer& trace)
+void BytecodeTraceBuilder::process_decomposition(std::span<const simulation::BytecodeDecompositionEvent> events,
+                                                 TraceContainer& trace)
 {
     using C = Column;
 
-    // We start from row 1 because we need a row of zeroes for the shifts.
-    uint32_t row = 1;
+    uint32_t row = next_decomposition_row;
 
     for (const auto& event : events) {
         const auto& bytecode = *event.bytecode;
@@ -127,13 +125,14 @@ void BytecodeTraceBuilder::process_decomposition(
         // We advance to the next bytecode.
         row += bytecode_len;
     }
+    next_decomposition_row = row;
 }
 
-void BytecodeTraceBuilder::process_hashing(
-    const simulation::EventEmitterInterface<simulation::BytecodeHashingEvent>::Container& events, TraceContainer& trace)
+void BytecodeTraceBuilder::process_hashing(std::span<const simulation::BytecodeHashingEvent> events,
+                                           TraceContainer& trace)
 {
     using C = Column;
-    uint32_t row = 1;
+    uint32_t row = next_hashing_row;
 
     for (const auto& event : events) {
         const auto id = event.bytecode_id;
@@ -158,15 +157,15 @@ void BytecodeTraceBuilder::process_hashing(
             row++;
         }
     }
+    next_hashing_row = row;
 }
 
-void BytecodeTraceBuilder::process_retrieval(
-    const simulation::EventEmitterInterface<simulation::BytecodeRetrievalEvent>::Container& events,
-    TraceContainer& trace)
+void BytecodeTraceBuilder::process_retrieval(std::span<const simulation::BytecodeRetrievalEvent> events,
+                                             TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
+    uint32_t row = next_retrieval_row;
     for (const auto& event : events) {
         trace.set(
             row,
@@ -204,11 +203,11 @@ void BytecodeTraceBuilder::process_retrieval(
                 { C::bc_retrieval_nullifier_exists, true } } });
         row++;
     }
+    next_retrieval_row = row;
 }
 
-void BytecodeTraceBuilder::process_instruction_fetching(
-    const simulation::EventEmitterInterface<simulation::InstructionFetchingEvent>::Container& events,
-    TraceContainer& trace)
+void BytecodeTraceBuilder::process_instruction_fetching(std::span<const simulation::InstructionFetchingEvent> events,
+                                                        TraceContainer& trace)
 {
     using C = Column;
     using simulation::BytecodeId;
@@ -218,8 +217,7 @@ void BytecodeTraceBuilder::process_instruction_fetching(
     using simulation::InstrDeserializationError::PC_OUT_OF_RANGE;
     using simulation::InstrDeserializationError::TAG_OUT_OF_RANGE;
 
-    // We start from row 1 because we need a row of zeroes for the shifts.
-    uint32_t row = 1;
+    uint32_t row = next_instruction_fetching_row;
 
     for (const auto& event : events) {
         const auto bytecode_id = event.bytecode_id;
@@ -375,6 +373,7 @@ void BytecodeTraceBuilder::process_instruction_fetching(
                   } });
         row++;
     }
+    next_instruction_fetching_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> BytecodeTraceBuilder::lookup_jobs()
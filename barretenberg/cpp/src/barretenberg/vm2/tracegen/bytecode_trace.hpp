@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/simulation/events/bytecode_events.hpp"
@@ -14,21 +16,50 @@ constexpr uint32_t DECOMPOSE_WINDOW_SIZE = 37;
 class BytecodeTraceBuilder final {
   public:
     void process_hashing(const simulation::EventEmitterInterface<simulation::BytecodeHashingEvent>::Container& events,
-                         TraceContainer& trace);
+                         TraceContainer& trace)
+    {
+        process_hashing(std::span<const simulation::BytecodeHashingEvent>(events), trace);
+    }
+    // Also takes the chunks of the events collected by the simulation (see EventArena::for_each_chunk).
+    void process_hashing(std::span<const simulation::BytecodeHashingEvent> events, TraceContainer& trace);
 
     void process_retrieval(
         const simulation::EventEmitterInterface<simulation::BytecodeRetrievalEvent>::Container& events,
-        TraceContainer& trace);
+        TraceContainer& trace)
+    {
+        process_retrieval(std::span<const simulation::BytecodeRetrievalEvent>(events), trace);
+    }
+    // Also takes the chunks of the events collected by the simulation (see EventArena::for_each_chunk).
+    void process_retrieval(std::span<const simulation::BytecodeRetrievalEvent> events, TraceContainer& trace);
 
     void process_decomposition(
         const simulation::EventEmitterInterface<simulation::BytecodeDecompositionEvent>::Container& events,
-        TraceContainer& trace);
+        TraceContainer& trace)
+    {
+        process_decomposition(std::span<const simulation::BytecodeDecompositionEvent>(events), trace);
+    }
+    // Also takes the chunks of the events collected by the simulation (see EventArena::for_each_chunk).
+    void process_decomposition(std::span<const simulation::BytecodeDecompositionEvent> events, TraceContainer& trace);
 
     void process_instruction_fetching(
         const simulation::EventEmitterInterface<simulation::InstructionFetchingEvent>::Container& events,
-        TraceContainer& trace);
+        TraceContainer& trace)
+    {
+        process_instruction_fetching(std::span<const simulation::InstructionFetchingEvent>(events), trace);
+    }
+    // Also takes the chunks of the events collected by the simulation (see EventArena::for_each_chunk).
+    void process_instruction_fetching(std::span<const simulation::InstructionFetchingEvent> events,
+                                      TraceContainer& trace);
 
     static std::vector<std::unique_ptr<class InteractionBuilderInterface>> lookup_jobs();
+
+  private:
+    // Rows are appended across calls to each process_*() method, so that events can be processed chunk by chunk.
+    // The traces with shifted columns start from row 1, because they need a row of zeroes for the shifts.
+    uint32_t next_hashing_row = 1;
+    uint32_t next_retrieval_row = 0;
+    uint32_t next_decomposition_row = 1;
+    uint32_t next_instruction_fetching_row = 1;
 };
 
 } // namespace bb::avm2::tracegen
@@ -13,13 +13,12 @@
 
 namespace bb::avm2::tracegen {
 
-void ClassIdDerivationTraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::ClassIdDerivationEvent>::Container& events,
-    TraceContainer& trace)
+void ClassIdDerivationTraceBuilder::process(std::span<const simulation::ClassIdDerivationEvent> events,
+                                            TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
+    uint32_t row = next_row;
     for (const auto& event : events) {
         trace.set(row,
                   { {
@@ -34,6 +33,7 @@ void ClassIdDerivationTraceBuilder::process(
                   } });
         row++;
     }
+    next_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> ClassIdDerivationTraceBuilder::lookup_jobs()
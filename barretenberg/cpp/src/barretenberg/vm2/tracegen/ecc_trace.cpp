@@ -35,12 +35,11 @@ FF compute_lambda(bool double_predicate,
 
 } // namespace
 
-void EccTraceBuilder::process_add(const simulation::EventEmitterInterface<simulation::EccAddEvent>::Container& events,
-                                  TraceContainer& trace)
+void EccTraceBuilder::process_add(std::span<const simulation::EccAddEvent> events, TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
+    uint32_t row = next_add_row;
     for (const auto& event : events) {
         EmbeddedCurvePoint p = event.p;
         EmbeddedCurvePoint q = event.q;
@@ -100,14 +99,14 @@ void EccTraceBuilder::process_add(const simulation::EventEmitterInterface<simula
 
         row++;
     }
+    next_add_row = row;
 }
 
-void EccTraceBuilder::process_scalar_mul(
-    const simulation::EventEmitterInterface<simulation::ScalarMulEvent>::Container& events, TraceContainer& trace)
+void EccTraceBuilder::process_scalar_mul(std::span<const simulation::ScalarMulEvent> events, TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 1; // We start from row 1 because this trace contains shifted columns.
+    uint32_t row = next_scalar_mul_row;
     for (const auto& event : events) {
         size_t num_intermediate_states = event.intermediate_states.size();
         EmbeddedCurvePoint point = event.point;
@@ -156,6 +155,7 @@ void EccTraceBuilder::process_scalar_mul(
             row++;
         }
     }
+    next_scalar_mul_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> EccTraceBuilder::lookup_jobs()
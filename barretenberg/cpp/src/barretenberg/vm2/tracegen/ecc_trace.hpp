@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/simulation/events/ecc_events.hpp"
@@ -12,11 +14,26 @@ namespace bb::avm2::tracegen {
 class EccTraceBuilder final {
   public:
     void process_add(const simulation::EventEmitterInterface<simulation::EccAddEvent>::Container& events,
-                     TraceContainer& trace);
+                     TraceContainer& trace)
+    {
+        process_add(std::span<const simulation::EccAddEvent>(events), trace);
+    }
+    // Also takes the chunks of the events collected by the simulation (see EventArena::for_each_chunk).
+    void process_add(std::span<const simulation::EccAddEvent> events, TraceContainer& trace);
     void process_scalar_mul(const simulation::EventEmitterInterface<simulation::ScalarMulEvent>::Container& events,
-                            TraceContainer& trace);
+                            TraceContainer& trace)
+    {
+        process_scalar_mul(std::span<const simulation::ScalarMulEvent>(events), trace);
+    }
+    // Also takes the chunks of the events collected by the simulation (see EventArena::for_each_chunk).
+    void process_scalar_mul(std::span<const simulation::ScalarMulEvent> events, TraceContainer& trace);
 
     static std::vector<std::unique_ptr<class InteractionBuilderInterface>> lookup_jobs();
+
+  private:
+    // Rows are appended across calls to each process_*() method, so that events can be processed chunk by chunk.
+    uint32_t next_add_row = 0;
+    uint32_t next_scalar_mul_row = 1; // Row 0 is skipped because this trace contains shifted columns.
 };
 
 } // namespace bb::avm2::tracegen
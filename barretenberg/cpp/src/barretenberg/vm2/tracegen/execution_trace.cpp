@@ -3,8 +3,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <sys/types.h>
+#include <utility>
+#include <vector>
 
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/zip_view.hpp"
@@ -26,14 +29,32 @@ constexpr size_t operand_columns = 7;
 // we should be able to leverage the instruction specification table for this
 void ExecutionTraceBuilder::process(
     const simulation::EventEmitterInterface<simulation::ExecutionEvent>::Container& orig_events, TraceContainer& trace)
+{
+    std::vector<const simulation::ExecutionEvent*> ex_events(orig_events.size());
+    std::transform(orig_events.begin(), orig_events.end(), ex_events.begin(), [](const auto& event) { return &event; });
+    process_events(std::move(ex_events), trace);
+}
+
+void ExecutionTraceBuilder::process(const simulation::EventArena<simulation::ExecutionEvent>& orig_events,
+                                    TraceContainer& trace)
+{
+    std::vector<const simulation::ExecutionEvent*> ex_events;
+    ex_events.reserve(orig_events.size());
+    orig_events.for_each_chunk([&](std::span<const simulation::ExecutionEvent> chunk) {
+        for (const auto& event : chunk) {
+            ex_events.push_back(&event);
+        }
+    });
+    process_events(std::move(ex_events), trace);
+}
+
+void ExecutionTraceBuilder::process_events(std::vector<const simulation::ExecutionEvent*> ex_events,
+                                           TraceContainer& trace)
 {
     using C = Column;
     uint32_t row = 1; // We start from row 1 because this trace contains shifted columns.
 
     // We need to sort the events by their order/sort id.
-    // We allocate a vector of pointers so that the sorting doesn't move the whole events around.
-    std::vector<const simulation::ExecutionEvent*> ex_events(orig_events.size());
-    std::transform(orig_events.begin(), orig_events.end(), ex_events.begin(), [](const auto& event) { return &event; });
     std::ranges::sort(ex_events, [](const auto& lhs, const auto& rhs) { return lhs->order < rhs->order; });
 
     uint32_t last_seen_parent_id = 0;
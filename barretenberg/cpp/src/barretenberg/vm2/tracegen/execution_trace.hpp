@@ -1,5 +1,8 @@
 #pragma once
 
+#include <vector>
+
+#include "barretenberg/vm2/simulation/events/event_arena.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/events/execution_event.hpp"
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
@@ -10,6 +13,13 @@ class ExecutionTraceBuilder final {
   public:
     void process(const simulation::EventEmitterInterface<simulation::ExecutionEvent>::Container& ex_events,
                  TraceContainer& trace);
+    // Takes the events collected by the simulation in place. Rows follow the order of the events, not the one in which
+    // they were emitted, so the events can not be processed chunk by chunk.
+    void process(const simulation::EventArena<simulation::ExecutionEvent>& ex_events, TraceContainer& trace);
+
+  private:
+    // Sorts the events by their order. They are taken by pointer so that sorting does not move them around.
+    void process_events(std::vector<const simulation::ExecutionEvent*> ex_events, TraceContainer& trace);
 };
 
 } // namespace bb::avm2::tracegen
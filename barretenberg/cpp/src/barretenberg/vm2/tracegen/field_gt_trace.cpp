@@ -14,13 +14,12 @@ namespace bb::avm2::tracegen {
 using simulation::LimbsComparisonWitness;
 using simulation::U256Decomposition;
 
-void FieldGreaterThanTraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::FieldGreaterThanEvent>::Container& events,
-    TraceContainer& trace)
+void FieldGreaterThanTraceBuilder::process(std::span<const simulation::FieldGreaterThanEvent> events,
+                                           TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 1;
+    uint32_t row = next_row;
     for (const auto& event : events) {
         // Copy the things that will need range checks since we'll mutate them in the shifts
         U256Decomposition a_limbs = event.a_limbs;
@@ -81,6 +80,7 @@ void FieldGreaterThanTraceBuilder::process(
             cmp_rng_ctr--;
         }
     }
+    next_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> FieldGreaterThanTraceBuilder::lookup_jobs()
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
@@ -12,9 +14,18 @@ namespace bb::avm2::tracegen {
 class FieldGreaterThanTraceBuilder final {
   public:
     void process(const simulation::EventEmitterInterface<simulation::FieldGreaterThanEvent>::Container& events,
-                 TraceContainer& trace);
+                 TraceContainer& trace)
+    {
+        process(std::span<const simulation::FieldGreaterThanEvent>(events), trace);
+    }
+    // Also takes the chunks of the batches streamed from the simulation.
+    void process(std::span<const simulation::FieldGreaterThanEvent> events, TraceContainer& trace);
 
     static std::vector<std::unique_ptr<class InteractionBuilderInterface>> lookup_jobs();
+
+  private:
+    // Rows are appended across calls to process(), so that events can be processed in batches.
+    uint32_t next_row = 1; // Row 0 is skipped because this trace contains shifted columns.
 };
 
 } // namespace bb::avm2::tracegen
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
 namespace bb::avm2::tracegen {
@@ -8,6 +10,8 @@ class InteractionBuilderInterface {
   public:
     virtual ~InteractionBuilderInterface() = default;
     virtual void process(TraceContainer& trace) = 0;
+    // The columns that process() writes. Every other column can be considered final before the interactions.
+    virtual std::vector<Column> get_written_columns() const = 0;
 };
 
 // We set a dummy value in the inverse column so that the size of the column is right.
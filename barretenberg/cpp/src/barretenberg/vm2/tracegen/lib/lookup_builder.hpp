@@ -1,11 +1,14 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
+#include <vector>
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/utils.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/common/map.hpp"
@@ -31,19 +34,82 @@ template <typename LookupSettings_> class BaseLookupTraceBuilder : public Intera
         // find a row dst_row in the target columns {d1, d2, ...} where the values match.
         // Then we increment the count in the counts column at dst_row.
         // The complexity is O(|src_selector|) * O(find_in_dst).
-        trace.visit_column(LookupSettings::SRC_SELECTOR, [&](uint32_t row, const FF&) {
-            auto src_values = trace.get_multiple(LookupSettings::SRC_COLUMNS, row);
-            uint32_t dst_row = find_in_dst(src_values); // Assumes an efficient implementation.
-            assert(src_values == trace.get_multiple(LookupSettings::DST_COLUMNS, dst_row));
+        std::vector<uint32_t> src_rows;
+        src_rows.reserve(trace.get_column_rows(LookupSettings::SRC_SELECTOR));
+        trace.visit_column(LookupSettings::SRC_SELECTOR, [&](uint32_t row, const FF&) { src_rows.push_back(row); });
+
+        // Large lookups (e.g., into range check or bitwise tables) are split in chunks of source rows, whose counts
+        // are accumulated in a histogram of the destination rows per chunk, and then added to the counts column.
+        const size_t num_dst_rows = trace.get_column_rows(LookupSettings::DST_SELECTOR);
+        const size_t num_chunks =
+            std::min(calculate_num_threads(src_rows.size(), MIN_SRC_ROWS_PER_CHUNK),
+                     std::max<size_t>(1, MAX_HISTOGRAM_ENTRIES / std::max<size_t>(num_dst_rows, 1)));
+        if (num_chunks <= 1) {
+            for (uint32_t row : src_rows) {
+                auto src_values = trace.get_multiple(LookupSettings::SRC_COLUMNS, row);
+                uint32_t dst_row = find_in_dst(src_values); // Assumes an efficient implementation.
+                check_dst_row(dst_row, num_dst_rows);
+                assert(src_values == trace.get_multiple(LookupSettings::DST_COLUMNS, dst_row));
+
+                trace.set(LookupSettings::COUNTS, dst_row, trace.get(LookupSettings::COUNTS, dst_row) + 1);
+            }
+            return;
+        }
 
-            trace.set(LookupSettings::COUNTS, dst_row, trace.get(LookupSettings::COUNTS, dst_row) + 1);
+        // The chunks below write the counts concurrently.
+        trace.reserve_column(LookupSettings::COUNTS, num_dst_rows);
+        std::vector<std::vector<uint32_t>> histograms(num_chunks);
+        parallel_for(num_chunks, [&](size_t chunk) {
+            auto& histogram = histograms[chunk];
+            histogram.resize(num_dst_rows);
+            const size_t start = chunk * src_rows.size() / num_chunks;
+            const size_t end = (chunk + 1) * src_rows.size() / num_chunks;
+            for (size_t i = start; i < end; ++i) {
+                auto src_values = trace.get_multiple(LookupSettings::SRC_COLUMNS, src_rows[i]);
+                uint32_t dst_row = find_in_dst(src_values);
+                check_dst_row(dst_row, num_dst_rows);
+                assert(src_values == trace.get_multiple(LookupSettings::DST_COLUMNS, dst_row));
+                ++histogram[dst_row];
+            }
+        });
+
+        parallel_for_range(num_dst_rows, [&](size_t start, size_t end) {
+            for (size_t dst_row = start; dst_row < end; ++dst_row) {
+                uint32_t count = 0;
+                for (const auto& histogram : histograms) {
+                    count += histogram[dst_row];
+                }
+                if (count != 0) {
+                    const auto row = static_cast<uint32_t>(dst_row);
+                    trace.set(LookupSettings::COUNTS, row, trace.get(LookupSettings::COUNTS, row) + count);
+                }
+            }
         });
     }
 
+    std::vector<Column> get_written_columns() const override
+    {
+        return { LookupSettings::COUNTS, LookupSettings::INVERSES };
+    }
+
   protected:
     using LookupSettings = LookupSettings_;
     virtual uint32_t find_in_dst(const std::array<FF, LookupSettings::LOOKUP_TUPLE_SIZE>& tup) const = 0;
     virtual void init(TraceContainer&){}; // Optional initialization step.
+
+  private:
+    static void check_dst_row(uint32_t dst_row, size_t num_dst_rows)
+    {
+        if (dst_row >= num_dst_rows) {
+            throw std::runtime_error("Failed computing counts for " + std::string(LookupSettings::NAME) +
+                                     ". Could not find tuple in destination.");
+        }
+    }
+
+    // Minimum number of source rows per chunk when computing the counts in parallel.
+    static constexpr size_t MIN_SRC_ROWS_PER_CHUNK = 1 << 13;
+    // Bound on the total size of the histograms of the chunks (num_chunks * num_dst_rows).
+    static constexpr size_t MAX_HISTOGRAM_ENTRIES = 1 << 24;
 };
 
 // This class is used when the lookup is into a non-precomputed table.
@@ -142,6 +208,11 @@ template <typename LookupSettings> class LookupIntoDynamicTableSequential : publ
             }
         }
     }
+
+    std::vector<Column> get_written_columns() const override
+    {
+        return { LookupSettings::COUNTS, LookupSettings::INVERSES };
+    }
 };
 
 } // namespace bb::avm2::tracegen
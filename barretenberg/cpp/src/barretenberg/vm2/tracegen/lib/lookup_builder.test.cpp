@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "barretenberg/vm2/generated/relations/lookups_range_check.hpp"
+#include "barretenberg/vm2/tracegen/lib/lookup_builder.hpp"
+#include "barretenberg/vm2/tracegen/lib/lookup_into_indexed_by_clk.hpp"
+#include "barretenberg/vm2/tracegen/precomputed_trace.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using C = Column;
+using Settings = lookup_range_check_r0_is_u16_settings;
+
+// Fills num_rows source rows of the lookup, and returns the expected counts of the 16-bit range rows.
+std::vector<uint32_t> fill_range_check_rows(TraceContainer& trace, uint32_t num_rows)
+{
+    PrecomputedTraceBuilder precomputed_builder;
+    precomputed_builder.process_misc(trace, 1 << 16);
+    precomputed_builder.process_sel_range_16(trace);
+
+    std::vector<uint32_t> expected_counts(1 << 16);
+    for (uint32_t row = 0; row < num_rows; ++row) {
+        // Skewed towards small values, as range checks of small numbers are the most frequent.
+        const uint32_t value = (row * 2654435761U) >> (16 + (row % 8));
+        trace.set(row, { { { C::range_check_sel_r0_16_bit_rng_lookup, 1 }, { C::range_check_u16_r0, value } } });
+        ++expected_counts[value];
+    }
+    return expected_counts;
+}
+
+template <typename Builder> void check_counts(uint32_t num_rows)
+{
+    TraceContainer trace;
+    auto expected_counts = fill_range_check_rows(trace, num_rows);
+
+    Builder().process(trace);
+
+    for (uint32_t row = 0; row < expected_counts.size(); ++row) {
+        ASSERT_EQ(trace.get(Settings::COUNTS, row), FF(expected_counts[row])) << "row " << row;
+    }
+}
+
+TEST(LookupBuilderTest, IndexedByClkCounts)
+{
+    check_counts<LookupIntoIndexedByClk<Settings>>(100);
+    // Enough source rows to be processed in parallel chunks.
+    check_counts<LookupIntoIndexedByClk<Settings>>(1 << 18);
+}
+
+TEST(LookupBuilderTest, DynamicTableCounts)
+{
+    check_counts<LookupIntoDynamicTableGeneric<Settings>>(100);
+    check_counts<LookupIntoDynamicTableGeneric<Settings>>(1 << 18);
+}
+
+TEST(LookupBuilderTest, ThrowsIfTupleNotInDestination)
+{
+    TraceContainer trace;
+    fill_range_check_rows(trace, 1 << 18);
+    trace.set(C::range_check_u16_r0, 1234, 1 << 16);
+
+    EXPECT_THROW(LookupIntoDynamicTableGeneric<Settings>().process(trace), std::runtime_error);
+    EXPECT_THROW(LookupIntoIndexedByClk<Settings>().process(trace), std::runtime_error);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
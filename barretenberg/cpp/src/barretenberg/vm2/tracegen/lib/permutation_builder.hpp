@@ -11,6 +11,7 @@ namespace bb::avm2::tracegen {
 template <typename PermutationSettings> class PermutationBuilder : public InteractionBuilderInterface {
   public:
     void process(TraceContainer& trace) override { SetDummyInverses<PermutationSettings>(trace); }
+    std::vector<Column> get_written_columns() const override { return { PermutationSettings::INVERSES }; }
 };
 
 } // namespace bb::avm2::tracegen
\ No newline at end of file
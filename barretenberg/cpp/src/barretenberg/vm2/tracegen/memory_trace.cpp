@@ -8,12 +8,11 @@
 
 namespace bb::avm2::tracegen {
 
-void MemoryTraceBuilder::process(const simulation::EventEmitterInterface<simulation::MemoryEvent>::Container& events,
-                                 TraceContainer& trace)
+void MemoryTraceBuilder::process(std::span<const simulation::MemoryEvent> events, TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
+    uint32_t row = next_row;
     for (const auto& event : events) {
         trace.set(row,
                   { {
@@ -26,6 +25,7 @@ void MemoryTraceBuilder::process(const simulation::EventEmitterInterface<simulat
                   } });
         row++;
     }
+    next_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> MemoryTraceBuilder::lookup_jobs()
@@ -14,13 +14,11 @@ namespace bb::avm2::tracegen {
 
 using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
 
-void MerkleCheckTraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::MerkleCheckEvent>::Container& events, TraceContainer& trace)
+void MerkleCheckTraceBuilder::process(std::span<const simulation::MerkleCheckEvent> events, TraceContainer& trace)
 {
     using C = Column;
 
-    // Skip 0th row since this gadget has shifts
-    uint32_t row = 1;
+    uint32_t row = next_row;
 
     for (const auto& event : events) {
         const size_t full_path_len = event.sibling_path.size();
@@ -92,6 +90,7 @@ void MerkleCheckTraceBuilder::process(
         assert(read_node == root);
         assert(write_node == new_root);
     }
+    next_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> MerkleCheckTraceBuilder::lookup_jobs()
@@ -13,13 +13,12 @@ namespace bb::avm2::tracegen {
 
 using simulation::NullifierTreeLeafPreimage;
 
-void NullifierTreeCheckTraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::NullifierTreeCheckEvent>::Container& events,
-    TraceContainer& trace)
+void NullifierTreeCheckTraceBuilder::process(std::span<const simulation::NullifierTreeCheckEvent> events,
+                                             TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
+    uint32_t row = next_row;
 
     for (const auto& event : events) {
         bool exists = event.low_leaf_preimage.leaf.nullifier == event.nullifier;
@@ -75,6 +74,7 @@ void NullifierTreeCheckTraceBuilder::process(
                 { C::nullifier_check_new_leaf_hash, new_leaf_hash } } });
         row++;
     }
+    next_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> NullifierTreeCheckTraceBuilder::lookup_jobs()
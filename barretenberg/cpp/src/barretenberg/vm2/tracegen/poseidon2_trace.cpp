@@ -285,12 +285,11 @@ constexpr std::array<StateCols, 64> intermediate_round_cols = { {
 
 } // namespace
 
-void Poseidon2TraceBuilder::process_hash(
-    const simulation::EventEmitterInterface<simulation::Poseidon2HashEvent>::Container& hash_events,
-    TraceContainer& trace)
+void Poseidon2TraceBuilder::process_hash(std::span<const simulation::Poseidon2HashEvent> hash_events,
+                                         TraceContainer& trace)
 {
     using C = Column;
-    uint32_t row = 1; // We start from row 1 because this trace contains shifted columns.
+    uint32_t row = next_hash_row;
     for (const auto& event : hash_events) {
         auto input_size = event.inputs.size();
         auto num_perm_events = (input_size / 3) + static_cast<size_t>(input_size % 3 != 0);
@@ -338,11 +337,11 @@ void Poseidon2TraceBuilder::process_hash(
             row++;
         }
     }
+    next_hash_row = row;
 }
 
-void Poseidon2TraceBuilder::process_permutation(
-    const simulation::EventEmitterInterface<simulation::Poseidon2PermutationEvent>::Container& perm_events,
-    TraceContainer& trace)
+void Poseidon2TraceBuilder::process_permutation(std::span<const simulation::Poseidon2PermutationEvent> perm_events,
+                                                TraceContainer& trace)
 {
     using C = Column;
     // Our current state
@@ -350,7 +349,7 @@ void Poseidon2TraceBuilder::process_permutation(
     // These are where we will store the intermediate values of current_state in the trace.
     std::array<Column, 4> round_state_cols;
 
-    uint32_t row = 0;
+    uint32_t row = next_permutation_row;
 
     for (const auto& event : perm_events) {
         // The bulk of this code is a copy of the Poseidon2Permutation::permute function from bb
@@ -428,6 +427,7 @@ void Poseidon2TraceBuilder::process_permutation(
                   } });
         row++;
     }
+    next_permutation_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> Poseidon2TraceBuilder::lookup_jobs()
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
@@ -12,12 +14,28 @@ namespace bb::avm2::tracegen {
 class Poseidon2TraceBuilder final {
   public:
     void process_hash(const simulation::EventEmitterInterface<simulation::Poseidon2HashEvent>::Container& hash_events,
-                      TraceContainer& trace);
+                      TraceContainer& trace)
+    {
+        process_hash(std::span<const simulation::Poseidon2HashEvent>(hash_events), trace);
+    }
+    // Also takes the chunks of the events collected by the simulation (see EventArena::for_each_chunk).
+    void process_hash(std::span<const simulation::Poseidon2HashEvent> hash_events, TraceContainer& trace);
     void process_permutation(
         const simulation::EventEmitterInterface<simulation::Poseidon2PermutationEvent>::Container& perm_events,
-        TraceContainer& trace);
+        TraceContainer& trace)
+    {
+        process_permutation(std::span<const simulation::Poseidon2PermutationEvent>(perm_events), trace);
+    }
+    // Also takes the chunks of the batches streamed from the simulation.
+    void process_permutation(std::span<const simulation::Poseidon2PermutationEvent> perm_events, TraceContainer& trace);
 
     static std::vector<std::unique_ptr<class InteractionBuilderInterface>> lookup_jobs();
+
+  private:
+    // Permutation rows are appended across calls to process_permutation(), so that events can be processed in batches.
+    uint32_t next_permutation_row = 0;
+    // Rows are appended across calls to process_hash(), so that events can be processed chunk by chunk.
+    uint32_t next_hash_row = 1; // Row 0 is skipped because this trace contains shifted columns.
 };
 
 } // namespace bb::avm2::tracegen
@@ -7,6 +7,11 @@
 
 namespace bb::avm2::tracegen {
 
+// Hash of the values of the precomputed columns (see PrecomputedSnapshot::get_content_hash). It is part of the
+// fingerprint of precomputed snapshots, so that they are rebuilt whenever the values change (e.g., a new opcode spec)
+// without a PIL change. A test fails until it is updated.
+constexpr uint64_t PRECOMPUTED_TRACE_HASH = 0xfa40e38a52eacf58ULL;
+
 // This fills the trace for the "general" precomputed columns.
 // See precomputed.pil.
 class PrecomputedTraceBuilder final {
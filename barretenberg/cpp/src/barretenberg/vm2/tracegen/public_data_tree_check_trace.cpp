@@ -10,13 +10,12 @@ namespace bb::avm2::tracegen {
 
 using simulation::PublicDataTreeLeafPreimage;
 
-void PublicDataTreeCheckTraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::PublicDataTreeCheckEvent>::Container& events,
-    TraceContainer& trace)
+void PublicDataTreeCheckTraceBuilder::process(std::span<const simulation::PublicDataTreeCheckEvent> events,
+                                              TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
+    uint32_t row = next_row;
 
     for (const auto& event : events) {
         bool exists = event.low_leaf_preimage.leaf.slot == event.slot;
@@ -76,6 +75,7 @@ void PublicDataTreeCheckTraceBuilder::process(
                   } });
         row++;
     }
+    next_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> PublicDataTreeCheckTraceBuilder::lookup_jobs()
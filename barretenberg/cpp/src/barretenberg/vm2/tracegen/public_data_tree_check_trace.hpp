@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
@@ -12,9 +14,18 @@ namespace bb::avm2::tracegen {
 class PublicDataTreeCheckTraceBuilder final {
   public:
     void process(const simulation::EventEmitterInterface<simulation::PublicDataTreeCheckEvent>::Container& events,
-                 TraceContainer& trace);
+                 TraceContainer& trace)
+    {
+        process(std::span<const simulation::PublicDataTreeCheckEvent>(events), trace);
+    }
+    // Also takes the chunks of the events collected by the simulation (see EventArena::for_each_chunk).
+    void process(std::span<const simulation::PublicDataTreeCheckEvent> events, TraceContainer& trace);
 
     static std::vector<std::unique_ptr<class InteractionBuilderInterface>> lookup_jobs();
+
+  private:
+    // Rows are appended across calls to process(), so that events can be processed chunk by chunk.
+    uint32_t next_row = 0;
 };
 
 } // namespace bb::avm2::tracegen
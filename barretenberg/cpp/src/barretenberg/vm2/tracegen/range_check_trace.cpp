@@ -15,12 +15,11 @@
 
 namespace bb::avm2::tracegen {
 
-void RangeCheckTraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::RangeCheckEvent>::Container& events, TraceContainer& trace)
+void RangeCheckTraceBuilder::process(std::span<const simulation::RangeCheckEvent> events, TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
+    uint32_t row = next_row;
     for (const auto& event : events) {
         // store off event entries to be used directly in row
         const uint256_t original_num_bits = event.num_bits;
@@ -93,6 +92,7 @@ void RangeCheckTraceBuilder::process(
 
         row++;
     }
+    next_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> RangeCheckTraceBuilder::lookup_jobs()
@@ -260,8 +260,7 @@ void Sha256TraceBuilder::compute_sha256_output(const std::array<uint32_t, 8>& ou
     }
 }
 
-void Sha256TraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::Sha256CompressionEvent>::Container& events)
+void Sha256TraceBuilder::process(std::span<const simulation::Sha256CompressionEvent> events)
 {
     using C = Column;
 
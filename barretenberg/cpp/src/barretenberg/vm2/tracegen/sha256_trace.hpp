@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
@@ -14,7 +15,13 @@ class Sha256TraceBuilder final {
     Sha256TraceBuilder(TraceContainer& trace)
         : trace(trace)
     {}
-    void process(const simulation::EventEmitterInterface<simulation::Sha256CompressionEvent>::Container& events);
+    void process(const simulation::EventEmitterInterface<simulation::Sha256CompressionEvent>::Container& events)
+    {
+        process(std::span<const simulation::Sha256CompressionEvent>(events));
+    }
+    // Also takes the chunks of the events collected by the simulation (see EventArena::for_each_chunk). Rows are
+    // appended across calls.
+    void process(std::span<const simulation::Sha256CompressionEvent> events);
     static std::vector<std::unique_ptr<class InteractionBuilderInterface>> lookup_jobs();
 
   private:
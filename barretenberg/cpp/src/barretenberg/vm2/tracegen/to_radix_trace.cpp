@@ -16,14 +16,13 @@
 
 namespace bb::avm2::tracegen {
 
-void ToRadixTraceBuilder::process(const simulation::EventEmitterInterface<simulation::ToRadixEvent>::Container& events,
-                                  TraceContainer& trace)
+void ToRadixTraceBuilder::process(std::span<const simulation::ToRadixEvent> events, TraceContainer& trace)
 {
     using C = Column;
 
     auto p_limbs_per_radix = get_p_limbs_per_radix();
 
-    uint32_t row = 1; // We start from row 1 because this trace contains shifted columns.
+    uint32_t row = next_row;
     for (const auto& event : events) {
         FF value = event.value;
         uint32_t radix = event.radix;
@@ -89,6 +88,7 @@ void ToRadixTraceBuilder::process(const simulation::EventEmitterInterface<simula
             exponent *= radix;
         }
     }
+    next_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> ToRadixTraceBuilder::lookup_jobs()
@@ -1,6 +1,13 @@
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
+#include <bit>
+#include <cstring>
+#ifndef __wasm__
+#include <sys/mman.h>
+#endif
+
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
 
@@ -11,20 +18,69 @@ namespace {
 static const FF zero = FF::zero();
 constexpr auto clk_column = Column::precomputed_clk;
 
+#ifdef __wasm__
+// Without virtual memory, zero-initialized buffers are not cheap enough, so columns stay sparse.
+constexpr bool dense_columns_supported = false;
+#else
+constexpr bool dense_columns_supported = true;
+#endif
+
+/**
+ * @brief Allocates a zero-initialized buffer of (at least) num_rows rows for a dense column.
+ * @details Anonymous mappings are zero-filled and only backed by physical memory once a page is written, so the rows
+ * that are never written do not cost anything. Returns nullptr if the memory can not be allocated.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+std::shared_ptr<FF[]> allocate_dense_rows(size_t num_rows)
+{
+#ifdef __wasm__
+    static_cast<void>(num_rows);
+    return nullptr;
+#else
+    const size_t num_bytes = std::max<size_t>(num_rows, 1) * sizeof(FF);
+    void* mapping = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mapping == MAP_FAILED) {
+        vinfo("TraceContainer: failed to allocate ", num_rows, " dense rows: ", std::strerror(errno));
+        return nullptr;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    return std::shared_ptr<FF[]>(static_cast<FF*>(mapping), [num_bytes](FF* ptr) { munmap(ptr, num_bytes); });
+#endif
+}
+
 } // namespace
 
 TraceContainer::TraceContainer()
-    : trace(std::make_unique<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>())
+    : trace(std::make_unique<std::array<ColumnData, NUM_COLUMNS_WITHOUT_SHIFTS>>())
 {}
 
 const FF& TraceContainer::get(Column col, uint32_t row) const
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
+    if (const FF* dense_rows = column_data.dense_rows.load(std::memory_order_acquire); dense_rows != nullptr) {
+        return get_dense(column_data, dense_rows, row);
+    }
     std::shared_lock lock(column_data.mutex);
+    // The column might have become dense while we were waiting for the lock.
+    if (const FF* dense_rows = column_data.dense_rows.load(std::memory_order_relaxed); dense_rows != nullptr) {
+        return get_dense(column_data, dense_rows, row);
+    }
     const auto it = column_data.rows.find(row);
     return it == column_data.rows.end() ? zero : it->second;
 }
 
+const FF& TraceContainer::get_dense(const ColumnData& column_data, const FF* dense_rows, uint32_t row)
+{
+    if (row < column_data.dense_capacity) {
+        return dense_rows[row];
+    }
+    if (row >= DENSE_COLUMN_CAPACITY) {
+        return zero;
+    }
+    const FF* chunk = (*column_data.dense_chunks)[row / DENSE_CHUNK_ROWS].load(std::memory_order_acquire);
+    return chunk == nullptr ? zero : chunk[row % DENSE_CHUNK_ROWS];
+}
+
 const FF& TraceContainer::get_column_or_shift(ColumnAndShifts col, uint32_t row) const
 {
     if (is_shift(col)) {
@@ -36,18 +92,105 @@ const FF& TraceContainer::get_column_or_shift(ColumnAndShifts col, uint32_t row)
 void TraceContainer::set(Column col, uint32_t row, const FF& value)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
+    // Fast path: dense columns are written without locking.
+    if (FF* dense_rows = column_data.dense_rows.load(std::memory_order_acquire); dense_rows != nullptr) {
+        set_dense(column_data, dense_rows, row, value);
+        return;
+    }
+
     std::unique_lock lock(column_data.mutex);
+    if (FF* dense_rows = column_data.dense_rows.load(std::memory_order_relaxed); dense_rows != nullptr) {
+        lock.unlock();
+        set_dense(column_data, dense_rows, row, value);
+        return;
+    }
     if (!value.is_zero()) {
         column_data.rows.insert_or_assign(row, value);
-        column_data.max_row_number = std::max(column_data.max_row_number, static_cast<int64_t>(row));
+        if (static_cast<int64_t>(row) > column_data.max_row_number.load(std::memory_order_relaxed)) {
+            column_data.max_row_number.store(static_cast<int64_t>(row), std::memory_order_relaxed);
+        }
     } else {
         auto num_erased = column_data.rows.erase(row);
-        if (column_data.max_row_number == row && num_erased > 0) {
+        if (column_data.max_row_number.load(std::memory_order_relaxed) == row && num_erased > 0) {
             // This shouldn't happen often. We delay recalculation of the max row number
             // until someone actually needs it.
-            column_data.row_number_dirty = true;
+            column_data.row_number_dirty.store(true, std::memory_order_relaxed);
         }
+        return;
+    }
+
+    // Switch to dense storage once the column is large and dense enough.
+    const size_t num_values = column_data.rows.size();
+    const auto num_rows = static_cast<size_t>(column_data.max_row_number.load(std::memory_order_relaxed) + 1);
+    if (dense_columns_supported && !column_data.dense_allocation_failed && num_values >= MIN_DENSE_COLUMN_VALUES &&
+        num_rows <= DENSE_COLUMN_CAPACITY && num_values * MAX_DENSE_COLUMN_SPARSITY >= num_rows) {
+        // The column keeps growing, most likely. Leave room for as many rows again before we need chunks.
+        make_dense(column_data, std::min(DENSE_COLUMN_CAPACITY, std::bit_ceil(2 * num_rows)));
+    }
+}
+
+void TraceContainer::set_dense(ColumnData& column_data, FF* dense_rows, uint32_t row, const FF& value)
+{
+    if (row < column_data.dense_capacity) {
+        dense_rows[row] = value;
+    } else if (row >= DENSE_COLUMN_CAPACITY) {
+        throw_or_abort("TraceContainer: row " + std::to_string(row) + " exceeds the circuit size");
+    } else if (FF* chunk = (*column_data.dense_chunks)[row / DENSE_CHUNK_ROWS].load(std::memory_order_acquire);
+               chunk != nullptr) {
+        chunk[row % DENSE_CHUNK_ROWS] = value;
+    } else if (!value.is_zero()) {
+        get_or_create_chunk(column_data, row)[row % DENSE_CHUNK_ROWS] = value;
+    }
+    const auto row_number = static_cast<int64_t>(row);
+    if (!value.is_zero()) {
+        int64_t max_row_number = column_data.max_row_number.load(std::memory_order_relaxed);
+        while (row_number > max_row_number &&
+               !column_data.max_row_number.compare_exchange_weak(max_row_number, row_number)) {
+        }
+    } else if (column_data.max_row_number.load(std::memory_order_relaxed) == row_number) {
+        // As for sparse columns, the max row number is recalculated lazily.
+        column_data.row_number_dirty.store(true, std::memory_order_relaxed);
+    }
+}
+
+FF* TraceContainer::get_or_create_chunk(ColumnData& column_data, uint32_t row)
+{
+    auto& chunk = (*column_data.dense_chunks)[row / DENSE_CHUNK_ROWS];
+    std::unique_lock lock(column_data.mutex);
+    if (FF* existing = chunk.load(std::memory_order_relaxed); existing != nullptr) {
+        return existing;
+    }
+    auto memory = allocate_dense_rows(DENSE_CHUNK_ROWS);
+    if (memory == nullptr) {
+        throw_or_abort("TraceContainer: failed to allocate rows of a dense column");
+    }
+    FF* rows = memory.get();
+    column_data.chunk_memory.push_back(std::move(memory));
+    chunk.store(rows, std::memory_order_release);
+    return rows;
+}
+
+bool TraceContainer::make_dense(ColumnData& column_data, size_t capacity)
+{
+    const auto num_rows = static_cast<size_t>(column_data.max_row_number.load(std::memory_order_relaxed) + 1);
+    capacity = std::max(capacity, num_rows);
+    auto memory = allocate_dense_rows(capacity);
+    if (memory == nullptr) {
+        column_data.dense_allocation_failed = true;
+        return false;
+    }
+    column_data.dense_memory = std::move(memory);
+    column_data.dense_capacity = capacity;
+    column_data.dense_chunks = std::make_unique<std::array<std::atomic<FF*>, NUM_DENSE_CHUNKS>>();
+    FF* dense_rows = column_data.dense_memory.get();
+    for (const auto& [row, value] : column_data.rows) {
+        dense_rows[row] = value;
     }
+    // Release the hash map memory.
+    unordered_flat_map<uint32_t, FF>().swap(column_data.rows);
+    // Publish the dense storage only after it has been filled in.
+    column_data.dense_rows.store(dense_rows, std::memory_order_release);
+    return true;
 }
 
 void TraceContainer::set(uint32_t row, std::span<const std::pair<Column, FF>> values)
@@ -61,22 +204,49 @@ void TraceContainer::reserve_column(Column col, size_t size)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
+    if (column_data.dense_rows.load(std::memory_order_relaxed) != nullptr) {
+        return;
+    }
+    if (dense_columns_supported && !column_data.dense_allocation_failed && size >= MIN_DENSE_COLUMN_VALUES &&
+        size <= DENSE_COLUMN_CAPACITY && make_dense(column_data, size)) {
+        return;
+    }
     column_data.rows.reserve(size);
 }
 
+bool TraceContainer::is_dense(Column col) const
+{
+    return (*trace)[static_cast<size_t>(col)].dense_rows.load(std::memory_order_acquire) != nullptr;
+}
+
 uint32_t TraceContainer::get_column_rows(Column col) const
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
+    if (!column_data.row_number_dirty.load(std::memory_order_acquire)) {
+        return static_cast<uint32_t>(column_data.max_row_number.load(std::memory_order_relaxed) + 1);
+    }
     std::unique_lock lock(column_data.mutex);
-    if (column_data.row_number_dirty) {
+    if (column_data.row_number_dirty.load(std::memory_order_relaxed)) {
         // Trigger recalculation of max row number.
-        auto keys = std::views::keys(column_data.rows);
-        const auto it = std::max_element(keys.begin(), keys.end());
         // We use -1 to indicate that the column is empty.
-        column_data.max_row_number = it == keys.end() ? -1 : static_cast<int64_t>(*it);
-        column_data.row_number_dirty = false;
+        int64_t max_row_number = -1;
+        if (const FF* dense_rows = column_data.dense_rows.load(std::memory_order_relaxed); dense_rows != nullptr) {
+            // Scan down from the previous maximum, which is an upper bound.
+            for (int64_t row = column_data.max_row_number.load(std::memory_order_relaxed); row >= 0; --row) {
+                if (!get_dense(column_data, dense_rows, static_cast<uint32_t>(row)).is_zero()) {
+                    max_row_number = row;
+                    break;
+                }
+            }
+        } else {
+            auto keys = std::views::keys(column_data.rows);
+            const auto it = std::max_element(keys.begin(), keys.end());
+            max_row_number = it == keys.end() ? -1 : static_cast<int64_t>(*it);
+        }
+        column_data.max_row_number.store(max_row_number, std::memory_order_relaxed);
+        column_data.row_number_dirty.store(false, std::memory_order_release);
     }
-    return static_cast<uint32_t>(column_data.max_row_number + 1);
+    return static_cast<uint32_t>(column_data.max_row_number.load(std::memory_order_relaxed) + 1);
 }
 
 uint32_t TraceContainer::get_num_rows_without_clk() const
@@ -98,19 +268,106 @@ uint32_t TraceContainer::get_num_rows() const
 void TraceContainer::visit_column(Column col, const std::function<void(uint32_t, const FF&)>& visitor) const
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
+    if (const FF* dense_rows = column_data.dense_rows.load(std::memory_order_acquire); dense_rows != nullptr) {
+        const uint32_t num_rows = get_column_rows(col);
+        for (uint32_t row = 0; row < num_rows; ++row) {
+            const FF& value = get_dense(column_data, dense_rows, row);
+            if (!value.is_zero()) {
+                visitor(row, value);
+            }
+        }
+        return;
+    }
     std::shared_lock lock(column_data.mutex);
     for (const auto& [row, value] : column_data.rows) {
         visitor(row, value);
     }
 }
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+std::shared_ptr<FF[]> TraceContainer::release_dense_column(Column col)
+{
+    auto& column_data = (*trace)[static_cast<size_t>(col)];
+    const uint32_t num_rows = get_column_rows(col);
+    std::unique_lock lock(column_data.mutex);
+    const FF* dense_rows = column_data.dense_rows.load(std::memory_order_relaxed);
+    if (dense_rows == nullptr) {
+        return nullptr;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::shared_ptr<FF[]> memory = std::move(column_data.dense_memory);
+    if (num_rows > column_data.dense_capacity) {
+        // The column outgrew its buffer, so it has to be copied together with its chunks.
+        auto contiguous = allocate_dense_rows(num_rows);
+        if (contiguous == nullptr) {
+            throw_or_abort("TraceContainer: failed to allocate rows of a dense column");
+        }
+        FF* contiguous_rows = contiguous.get();
+        std::copy_n(dense_rows, column_data.dense_capacity, contiguous_rows);
+        for (size_t row = column_data.dense_capacity; row < num_rows; ++row) {
+            const FF& value = get_dense(column_data, dense_rows, static_cast<uint32_t>(row));
+            if (!value.is_zero()) {
+                contiguous_rows[row] = value;
+            }
+        }
+        memory = std::move(contiguous);
+    }
+    column_data.dense_rows.store(nullptr, std::memory_order_relaxed);
+    column_data.dense_capacity = 0;
+    column_data.dense_chunks.reset();
+    column_data.chunk_memory.clear();
+    column_data.max_row_number.store(-1, std::memory_order_relaxed);
+    column_data.row_number_dirty.store(false, std::memory_order_relaxed);
+    return memory;
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+std::shared_ptr<FF[]> TraceContainer::share_dense_column(Column col) const
+{
+    auto& column_data = (*trace)[static_cast<size_t>(col)];
+    std::shared_lock lock(column_data.mutex);
+    if (!column_data.chunk_memory.empty()) {
+        return nullptr;
+    }
+    return column_data.dense_memory;
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+void TraceContainer::set_dense_column(Column col, std::shared_ptr<FF[]> memory, uint32_t num_rows)
+{
+    if (!dense_columns_supported) {
+        throw_or_abort("TraceContainer: dense columns are not supported");
+    }
+    if (num_rows > DENSE_COLUMN_CAPACITY) {
+        throw_or_abort("TraceContainer: " + std::to_string(num_rows) + " rows exceed the circuit size");
+    }
+    auto& column_data = (*trace)[static_cast<size_t>(col)];
+    std::unique_lock lock(column_data.mutex);
+    if (column_data.dense_rows.load(std::memory_order_relaxed) != nullptr || !column_data.rows.empty()) {
+        throw_or_abort("TraceContainer: column " + COLUMN_NAMES.at(static_cast<size_t>(col)) + " is not empty");
+    }
+    column_data.dense_memory = std::move(memory);
+    column_data.dense_capacity = num_rows;
+    column_data.dense_chunks = std::make_unique<std::array<std::atomic<FF*>, NUM_DENSE_CHUNKS>>();
+    column_data.max_row_number.store(static_cast<int64_t>(num_rows) - 1, std::memory_order_relaxed);
+    // The last rows might be zero, in which case the row number is recalculated.
+    column_data.row_number_dirty.store(true, std::memory_order_relaxed);
+    column_data.dense_rows.store(column_data.dense_memory.get(), std::memory_order_release);
+}
+
 void TraceContainer::clear_column(Column col)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
-    column_data.rows.clear();
-    column_data.max_row_number = 0;
-    column_data.row_number_dirty = false;
+    unordered_flat_map<uint32_t, FF>().swap(column_data.rows);
+    column_data.dense_rows.store(nullptr, std::memory_order_relaxed);
+    column_data.dense_capacity = 0;
+    column_data.dense_chunks.reset();
+    column_data.dense_memory.reset();
+    column_data.chunk_memory.clear();
+    column_data.dense_allocation_failed = false;
+    column_data.max_row_number.store(-1, std::memory_order_relaxed);
+    column_data.row_number_dirty.store(false, std::memory_order_relaxed);
 }
 
 } // namespace bb::avm2::tracegen
@@ -2,13 +2,16 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
 #include <shared_mutex>
 #include <span>
 #include <unordered_map>
+#include <vector>
 
+#include "barretenberg/vm2/common/constants.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/constraining/flavor_settings.hpp"
@@ -18,7 +21,13 @@
 namespace bb::avm2::tracegen {
 
 // This container is thread-safe.
-// Contention can only happen when concurrently accessing the same column.
+// Columns start out sparse (a hash map per column, behind a per-column mutex) and switch to dense storage once enough
+// of their prefix is non-zero. A dense column is a zero-initialized buffer sized from the rows known at that point
+// (see reserve_column), followed by chunks of DENSE_CHUNK_ROWS rows that are allocated when first written, so buffers
+// never move. Writes to dense columns are lock-free (but for allocating a chunk), so concurrent writers of different
+// rows (e.g. row ranges of the same trace) never contend. Dense columns that fit their buffer can be handed over to the
+// prover polynomials without copying (see release_dense_column). If a dense buffer can not be allocated, the column
+// stays sparse.
 class TraceContainer {
   public:
     TraceContainer();
@@ -43,7 +52,8 @@ class TraceContainer {
     void set(Column col, uint32_t row, const FF& value);
     // Bulk setting for a given row.
     void set(uint32_t row, std::span<const std::pair<Column, FF>> values);
-    // Reserve column size. Useful for precomputed columns.
+    // Reserve column size. Useful for precomputed columns. Large reservations make the column dense right away, with a
+    // buffer of the given number of rows. Concurrent writers of a column should reserve its rows first.
     void reserve_column(Column col, size_t size);
 
     // Visits non-zero values in a column.
@@ -56,27 +66,76 @@ class TraceContainer {
     uint32_t get_num_rows_without_clk() const;
     // Number of columns (without shifts).
     static constexpr size_t num_columns() { return NUM_COLUMNS_WITHOUT_SHIFTS; }
+    // Whether a column currently uses dense storage.
+    bool is_dense(Column col) const;
+
+    // Moves the memory of a dense column out of the container. The returned buffer holds the column values at rows
+    // [0, get_column_rows(col)) (and at least one row). It is not copied unless the column outgrew its buffer.
+    // Returns nullptr (and leaves the column untouched) if the column is sparse. Otherwise, the column is cleared
+    // (so query the number of rows before).
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::shared_ptr<FF[]> release_dense_column(Column col);
+    // Shares the memory of a dense column with the caller, while the container keeps using it. The column must not be
+    // written anymore. Returns nullptr if the column is sparse or outgrew its buffer.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::shared_ptr<FF[]> share_dense_column(Column col) const;
+
+    // Makes an empty column dense, backed by existing memory (e.g., shared by several traces) of at least
+    // max(num_rows, 1) rows. The memory can be read-only, in which case the column must not be written afterwards.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    void set_dense_column(Column col, std::shared_ptr<FF[]> memory, uint32_t num_rows);
 
     // Free column memory.
     void clear_column(Column col);
 
+    // Number of rows that a dense column can hold.
+    static constexpr size_t DENSE_COLUMN_CAPACITY = CIRCUIT_SUBGROUP_SIZE;
+    // Rows past the buffer of a dense column are allocated in chunks of this many rows.
+    static constexpr size_t DENSE_CHUNK_ROWS = 1 << 16;
+    static constexpr size_t NUM_DENSE_CHUNKS = DENSE_COLUMN_CAPACITY / DENSE_CHUNK_ROWS;
+    // A sparse column becomes dense once it holds at least this many values...
+    static constexpr size_t MIN_DENSE_COLUMN_VALUES = 1 << 10;
+    // ... and at least one in MAX_DENSE_COLUMN_SPARSITY rows of its prefix is non-zero. (Below that, the hash map
+    // uses less memory than the touched pages of a dense column.)
+    static constexpr size_t MAX_DENSE_COLUMN_SPARSITY = 4;
+
   private:
     // We use a mutex per column to allow for concurrent writes.
     // Observe that therefore concurrent write access to different columns is cheap.
-    struct SparseColumn {
-        std::shared_mutex mutex;
-        int64_t max_row_number = -1; // We use -1 to indicate that the column is empty.
-        bool row_number_dirty;       // Needs recalculation.
+    // Once a column is dense, the mutex is only needed to recompute the row number.
+    struct ColumnData {
+        mutable std::shared_mutex mutex;
+        std::atomic<int64_t> max_row_number = -1;  // We use -1 to indicate that the column is empty.
+        std::atomic<bool> row_number_dirty = false; // Needs recalculation.
+        // Sparse storage, used until the column is dense.
         // Future memory optimization notes: we can do the same trick as in Operand.
         // That is, store a variant with a unique_ptr. However, we should benchmark this.
         // (see serialization.hpp).
         unordered_flat_map<uint32_t, FF> rows;
+        // Dense storage, set once (under the mutex) when the column becomes dense. Rows [0, dense_capacity) are in
+        // dense_rows, the ones after that in the chunk of their row (row / DENSE_CHUNK_ROWS), if allocated.
+        std::atomic<FF*> dense_rows = nullptr;
+        size_t dense_capacity = 0;
+        std::unique_ptr<std::array<std::atomic<FF*>, NUM_DENSE_CHUNKS>> dense_chunks;
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        std::shared_ptr<FF[]> dense_memory; // Owns dense_rows.
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        std::vector<std::shared_ptr<FF[]>> chunk_memory; // Owns the chunks.
+        // Set when a dense buffer could not be allocated, so that we do not try again on every write.
+        bool dense_allocation_failed = false;
     };
-    // We store the trace as a sparse matrix.
     // We use a unique_ptr to allocate the array in the heap vs the stack.
     // Even if the _content_ of each unordered_map is always heap-allocated, if we have 3k columns
     // we could unnecessarily put strain on the stack with sizeof(unordered_map) * 3k bytes.
-    std::unique_ptr<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
+    std::unique_ptr<std::array<ColumnData, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
+
+    static const FF& get_dense(const ColumnData& column_data, const FF* dense_rows, uint32_t row);
+    static void set_dense(ColumnData& column_data, FF* dense_rows, uint32_t row, const FF& value);
+    // Returns the chunk holding the row, allocating it if needed.
+    static FF* get_or_create_chunk(ColumnData& column_data, uint32_t row);
+    // Moves the sparse rows into a dense buffer of (at least) the given number of rows. Requires the column mutex to be
+    // held. Returns false, leaving the column sparse, if the buffer can not be allocated.
+    static bool make_dense(ColumnData& column_data, size_t capacity);
 };
 
 } // namespace bb::avm2::tracegen
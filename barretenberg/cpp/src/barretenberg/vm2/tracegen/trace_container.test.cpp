@@ -0,0 +1,204 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using C = Column;
+
+TEST(TraceContainerTest, SparseColumn)
+{
+    TraceContainer trace;
+    trace.set(C::execution_sel, 10, 1);
+    trace.set(C::execution_sel, 100, 2);
+
+    EXPECT_FALSE(trace.is_dense(C::execution_sel));
+    EXPECT_EQ(trace.get(C::execution_sel, 10), 1);
+    EXPECT_EQ(trace.get(C::execution_sel, 100), 2);
+    EXPECT_EQ(trace.get(C::execution_sel, 11), 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 101);
+    EXPECT_EQ(trace.release_dense_column(C::execution_sel), nullptr);
+
+    // Unsetting the last row shrinks the column.
+    trace.set(C::execution_sel, 100, 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 11);
+}
+
+TEST(TraceContainerTest, BecomesDense)
+{
+    TraceContainer trace;
+    const uint32_t num_rows = TraceContainer::MIN_DENSE_COLUMN_VALUES + 10;
+    for (uint32_t row = 1; row < num_rows; ++row) {
+        trace.set(C::execution_sel, row, row);
+    }
+
+    EXPECT_TRUE(trace.is_dense(C::execution_sel));
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), num_rows);
+    for (uint32_t row = 0; row < num_rows; ++row) {
+        EXPECT_EQ(trace.get(C::execution_sel, row), row);
+    }
+
+    // Unsetting values of a dense column.
+    trace.set(C::execution_sel, num_rows - 1, 0);
+    trace.set(C::execution_sel, num_rows - 2, 0);
+    trace.set(C::execution_sel, 5, 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), num_rows - 2);
+
+    size_t num_visited = 0;
+    trace.visit_column(C::execution_sel, [&](uint32_t row, const FF& value) {
+        EXPECT_EQ(value, row);
+        num_visited++;
+    });
+    EXPECT_EQ(num_visited, num_rows - 4);
+}
+
+TEST(TraceContainerTest, StaysSparseIfScattered)
+{
+    TraceContainer trace;
+    for (uint32_t i = 0; i < TraceContainer::MIN_DENSE_COLUMN_VALUES; ++i) {
+        trace.set(C::execution_sel, i * 1000, 1);
+    }
+    EXPECT_FALSE(trace.is_dense(C::execution_sel));
+}
+
+TEST(TraceContainerTest, ReserveMakesDense)
+{
+    TraceContainer trace;
+    trace.reserve_column(C::precomputed_clk, 1 << 16);
+    EXPECT_TRUE(trace.is_dense(C::precomputed_clk));
+    EXPECT_EQ(trace.get_column_rows(C::precomputed_clk), 0);
+
+    trace.reserve_column(C::execution_sel, 10);
+    EXPECT_FALSE(trace.is_dense(C::execution_sel));
+}
+
+TEST(TraceContainerTest, ConcurrentRowRangeWrites)
+{
+    TraceContainer trace;
+    trace.reserve_column(C::execution_sel, 1 << 16);
+
+    const size_t num_chunks = 16;
+    const uint32_t chunk_size = 1 << 12;
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const auto start = static_cast<uint32_t>(chunk) * chunk_size;
+        for (uint32_t row = start; row < start + chunk_size; ++row) {
+            trace.set(C::execution_sel, row, row + 1);
+        }
+    });
+
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), num_chunks * chunk_size);
+    for (uint32_t row = 0; row < num_chunks * chunk_size; ++row) {
+        EXPECT_EQ(trace.get(C::execution_sel, row), row + 1);
+    }
+}
+
+TEST(TraceContainerTest, DenseColumnGrowsInChunks)
+{
+    TraceContainer trace;
+    trace.reserve_column(C::execution_sel, 1 << 12);
+    const uint32_t far_row = (1 << 17) + 5;
+    for (uint32_t row = 0; row < (1 << 13); ++row) {
+        trace.set(C::execution_sel, row, row + 1);
+    }
+    trace.set(C::execution_sel, far_row, 42);
+    // Zeroes past the buffer do not need a chunk.
+    trace.set(C::execution_sel, far_row + TraceContainer::DENSE_CHUNK_ROWS, 0);
+
+    EXPECT_TRUE(trace.is_dense(C::execution_sel));
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), far_row + 1);
+    EXPECT_EQ(trace.get(C::execution_sel, 5000), 5001);
+    EXPECT_EQ(trace.get(C::execution_sel, far_row), 42);
+    EXPECT_EQ(trace.get(C::execution_sel, far_row - 1), 0);
+    // The column is not contiguous, so it can not be shared.
+    EXPECT_EQ(trace.share_dense_column(C::execution_sel), nullptr);
+
+    size_t num_visited = 0;
+    trace.visit_column(C::execution_sel, [&](uint32_t, const FF&) { num_visited++; });
+    EXPECT_EQ(num_visited, (1 << 13) + 1);
+
+    // Unsetting the last row shrinks the column back into the chunks.
+    trace.set(C::execution_sel, far_row, 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 1 << 13);
+    trace.set(C::execution_sel, far_row, 43);
+
+    // Releasing copies the buffer and the chunks into contiguous memory.
+    auto memory = trace.release_dense_column(C::execution_sel);
+    ASSERT_NE(memory, nullptr);
+    for (uint32_t row = 0; row < (1 << 13); ++row) {
+        EXPECT_EQ(memory[row], row + 1);
+    }
+    EXPECT_EQ(memory[(1 << 13) + 1], 0);
+    EXPECT_EQ(memory[far_row], 43);
+    EXPECT_FALSE(trace.is_dense(C::execution_sel));
+}
+
+TEST(TraceContainerTest, ConcurrentWritesPastTheBuffer)
+{
+    TraceContainer trace;
+    trace.reserve_column(C::execution_sel, TraceContainer::MIN_DENSE_COLUMN_VALUES);
+
+    const size_t num_chunks = 16;
+    const uint32_t chunk_size = 1 << 12;
+    parallel_for(num_chunks, [&](size_t chunk) {
+        for (uint32_t i = 0; i < chunk_size; ++i) {
+            // Interleaved, so that the threads race to allocate the same chunks.
+            const auto row = i * static_cast<uint32_t>(num_chunks) + static_cast<uint32_t>(chunk);
+            trace.set(C::execution_sel, row, row + 1);
+        }
+    });
+
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), num_chunks * chunk_size);
+    for (uint32_t row = 0; row < num_chunks * chunk_size; ++row) {
+        EXPECT_EQ(trace.get(C::execution_sel, row), row + 1);
+    }
+}
+
+TEST(TraceContainerTest, ReleaseDenseColumn)
+{
+    TraceContainer trace;
+    trace.reserve_column(C::execution_sel, 1 << 12);
+    for (uint32_t row = 0; row < 100; ++row) {
+        trace.set(C::execution_sel, row, row + 7);
+    }
+
+    auto memory = trace.release_dense_column(C::execution_sel);
+    ASSERT_NE(memory, nullptr);
+    for (uint32_t row = 0; row < 100; ++row) {
+        EXPECT_EQ(memory[row], row + 7);
+    }
+    EXPECT_EQ(memory[100], 0);
+
+    // The column is cleared.
+    EXPECT_FALSE(trace.is_dense(C::execution_sel));
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 0);
+    EXPECT_EQ(trace.get(C::execution_sel, 5), 0);
+}
+
+TEST(TraceContainerTest, ShareDenseColumn)
+{
+    TraceContainer trace;
+    trace.set(C::alu_ia, 3, 5);
+    EXPECT_EQ(trace.share_dense_column(C::alu_ia), nullptr);
+
+    trace.reserve_column(C::execution_sel, 1 << 12);
+    for (uint32_t row = 0; row < 100; ++row) {
+        trace.set(C::execution_sel, row, row + 7);
+    }
+
+    auto memory = trace.share_dense_column(C::execution_sel);
+    ASSERT_NE(memory, nullptr);
+    EXPECT_EQ(memory[42], 49);
+    // The column is still in the container.
+    EXPECT_TRUE(trace.is_dense(C::execution_sel));
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 100);
+    EXPECT_EQ(&trace.get(C::execution_sel, 42), &memory[42]);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
@@ -10,12 +10,11 @@
 
 namespace bb::avm2::tracegen {
 
-void UpdateCheckTraceBuilder::process(
-    const simulation::EventEmitterInterface<simulation::UpdateCheckEvent>::Container& events, TraceContainer& trace)
+void UpdateCheckTraceBuilder::process(std::span<const simulation::UpdateCheckEvent> events, TraceContainer& trace)
 {
     using C = Column;
 
-    uint32_t row = 0;
+    uint32_t row = next_row;
 
     for (const auto& event : events) {
         uint256_t update_metadata = static_cast<uint256_t>(event.update_preimage_metadata);
@@ -69,6 +68,7 @@ void UpdateCheckTraceBuilder::process(
                       { C::update_check_update_post_class_inv, update_post_class_inv } } });
         row++;
     }
+    next_row = row;
 }
 
 std::vector<std::unique_ptr<InteractionBuilderInterface>> UpdateCheckTraceBuilder::lookup_jobs()
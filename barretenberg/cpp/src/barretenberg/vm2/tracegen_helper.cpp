@@ -1,15 +1,19 @@
 #include "barretenberg/vm2/tracegen_helper.hpp"
 
 #include <array>
+#include <exception>
 #include <functional>
 #include <span>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/std_array.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/vm2/common/bounded_queue.hpp"
 #include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/constraining/flavor.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
@@ -74,6 +78,10 @@ auto build_precomputed_columns_jobs(TraceContainer& trace)
             AVM_TRACK_TIME("tracegen/precomputed/memory_tag_ranges",
                            precomputed_builder.process_memory_tag_range(trace));
         },
+        [&]() {
+            PublicInputsTraceBuilder public_inputs_builder;
+            public_inputs_builder.process_public_inputs_aux_precomputed(trace);
+        },
     };
 }
 
@@ -84,10 +92,6 @@ auto build_public_inputs_columns_jobs(TraceContainer& trace, const PublicInputs&
             PublicInputsTraceBuilder public_inputs_builder;
             public_inputs_builder.process_public_inputs(trace, public_inputs);
         },
-        [&]() {
-            PublicInputsTraceBuilder public_inputs_builder;
-            public_inputs_builder.process_public_inputs_aux_precomputed(trace);
-        },
     };
 }
 
@@ -96,12 +100,6 @@ void execute_jobs(std::span<std::function<void()>> jobs)
     parallel_for(jobs.size(), [&](size_t i) { jobs[i](); });
 }
 
-template <typename T> inline void clear_events(T& c)
-{
-    c.clear();
-    c.shrink_to_fit();
-}
-
 void print_trace_stats(const TraceContainer& trace)
 {
     constexpr auto main_relation_names = [] {
@@ -166,17 +164,166 @@ template <typename T> std::vector<T> concatenate_jobs(std::vector<T>&& first, au
     return result;
 }
 
+// Number of events per batch when streaming events from the simulation.
+constexpr size_t EVENT_BATCH_SIZE = 1 << 12;
+// Maximum number of batches (per event type) waiting to be processed. The simulation blocks when this is reached.
+constexpr size_t MAX_QUEUED_EVENT_BATCHES = 4;
+
+// Processes the batches of events of one type, as they are streamed from the simulation.
+// Batches are processed in order on a dedicated thread. We don't use the thread pool, because a full queue
+// would then block one of its workers, and the simulation is not running on the pool either.
+// The events of a batch are processed in place, chunk by chunk, and freed with the batch.
+template <typename Event> class EventBatchConsumer {
+  public:
+    using Batch = simulation::EventArena<Event>;
+
+    EventBatchConsumer(std::string name, std::function<void(std::span<const Event>)> process)
+        : name(std::move(name))
+        , process(std::move(process))
+        , queue(MAX_QUEUED_EVENT_BATCHES)
+    {
+#ifndef NO_MULTITHREADING
+        thread = std::thread([this]() { consume(); });
+#endif
+    }
+    EventBatchConsumer(const EventBatchConsumer&) = delete;
+    EventBatchConsumer& operator=(const EventBatchConsumer&) = delete;
+    ~EventBatchConsumer() { join(); }
+
+    EventBatchSink<Event> sink()
+    {
+#ifdef NO_MULTITHREADING
+        // Without threads we still gain from not holding all the events in memory at once.
+        return [this](Batch&& batch) { process_batch(batch); };
+#else
+        return [this](Batch&& batch) { queue.push(std::move(batch)); };
+#endif
+    }
+
+    // Waits until all the streamed batches are processed. Rethrows the first error found while processing them.
+    void finish()
+    {
+        join();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+  private:
+    void consume()
+    {
+        while (auto batch = queue.pop()) {
+            // On error, we keep draining the queue so that the simulation does not block.
+            if (!error) {
+                process_batch(*batch);
+            }
+        }
+    }
+
+    void process_batch(const Batch& batch)
+    {
+        try {
+            AVM_TRACK_TIME(name, batch.for_each_chunk(process));
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+
+    void join()
+    {
+        queue.close();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    const std::string name;
+    const std::function<void(std::span<const Event>)> process;
+    BoundedQueue<Batch> queue;
+    std::exception_ptr error;
+    std::thread thread;
+};
+
 } // namespace
 
 TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events, const PublicInputs& public_inputs)
 {
     TraceContainer trace;
+    fill_trace(trace, std::move(events), public_inputs);
+    return trace;
+}
+
+TraceContainer AvmTraceGenHelper::generate_trace_streaming(
+    const std::function<EventsContainer(EventBatchSinks&)>& simulate, const PublicInputs& public_inputs)
+{
+    TraceContainer trace;
+    fill_trace_streaming(trace, simulate, public_inputs, /*on_final_columns=*/nullptr);
+    return trace;
+}
+
+void AvmTraceGenHelper::fill_trace_streaming(TraceContainer& trace,
+                                             const std::function<EventsContainer(EventBatchSinks&)>& simulate,
+                                             const PublicInputs& public_inputs,
+                                             const FinalColumnsCallback& on_final_columns)
+{
 
+    // The builders are only ever used by their consumer thread.
+    MemoryTraceBuilder memory_builder;
+    AluTraceBuilder alu_builder;
+    RangeCheckTraceBuilder range_check_builder;
+    FieldGreaterThanTraceBuilder field_gt_builder;
+    Poseidon2TraceBuilder poseidon2_builder;
+
+    // These have to be destroyed (joined) before the builders and the trace.
+    EventBatchConsumer<MemoryEvent> memory(
+        "tracegen/memory", [&](const auto& batch) { memory_builder.process(batch, trace); });
+    EventBatchConsumer<AluEvent> alu("tracegen/alu", [&](const auto& batch) { alu_builder.process(batch, trace); });
+    EventBatchConsumer<RangeCheckEvent> range_check(
+        "tracegen/range_check", [&](const auto& batch) { range_check_builder.process(batch, trace); });
+    EventBatchConsumer<FieldGreaterThanEvent> field_gt(
+        "tracegen/field_gt", [&](const auto& batch) { field_gt_builder.process(batch, trace); });
+    EventBatchConsumer<Poseidon2PermutationEvent> poseidon2_permutation(
+        "tracegen/poseidon2_permutation",
+        [&](const auto& batch) { poseidon2_builder.process_permutation(batch, trace); });
+
+    EventBatchSinks sinks = {
+        .batch_size = EVENT_BATCH_SIZE,
+        .memory = memory.sink(),
+        .alu = alu.sink(),
+        .range_check = range_check.sink(),
+        .field_gt = field_gt.sink(),
+        .poseidon2_permutation = poseidon2_permutation.sink(),
+    };
+    // If the simulation throws, the consumers are joined on destruction.
+    EventsContainer events = simulate(sinks);
+
+    AVM_TRACK_TIME("tracegen/streamed_traces", ({
+                       memory.finish();
+                       alu.finish();
+                       range_check.finish();
+                       field_gt.finish();
+                       poseidon2_permutation.finish();
+                   }));
+
+    // The streamed events are not in the container anymore, so their builders will have nothing to do here.
+    fill_trace(trace, std::move(events), public_inputs, on_final_columns);
+}
+
+void AvmTraceGenHelper::fill_trace(TraceContainer& trace,
+                                   EventsContainer&& events,
+                                   const PublicInputs& public_inputs,
+                                   const FinalColumnsCallback& on_final_columns)
+{
+    if (precomputed_snapshot != nullptr) {
+        AVM_TRACK_TIME("tracegen/precomputed/snapshot", precomputed_snapshot->fill_trace(trace));
+    }
     // We process the events in parallel. Ideally the jobs should access disjoint column sets.
+    // The builders take the events chunk by chunk, in the arenas they were emitted into, and free them when done.
     {
         auto jobs = concatenate(
             // Precomputed column jobs.
-            build_precomputed_columns_jobs(trace),
+            precomputed_snapshot != nullptr ? std::vector<std::function<void()>>{}
+                                            : build_precomputed_columns_jobs(trace),
             // Public inputs column jobs.
             build_public_inputs_columns_jobs(trace, public_inputs),
             // Subtrace jobs.
@@ -184,120 +331,132 @@ TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events, const
                 [&]() {
                     ExecutionTraceBuilder exec_builder;
                     AVM_TRACK_TIME("tracegen/execution", exec_builder.process(events.execution, trace));
-                    clear_events(events.execution);
+                    events.execution.clear();
                 },
                 [&]() {
                     AddressDerivationTraceBuilder address_derivation_builder;
-                    AVM_TRACK_TIME("tracegen/address_derivation",
-                                   address_derivation_builder.process(events.address_derivation, trace));
-                    clear_events(events.address_derivation);
+                    auto process = [&](auto chunk) { address_derivation_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/address_derivation", events.address_derivation.for_each_chunk(process));
+                    events.address_derivation.clear();
                 },
                 [&]() {
                     AluTraceBuilder alu_builder;
-                    AVM_TRACK_TIME("tracegen/alu", alu_builder.process(events.alu, trace));
-                    clear_events(events.alu);
+                    auto process = [&](auto chunk) { alu_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/alu", events.alu.for_each_chunk(process));
+                    events.alu.clear();
                 },
                 [&]() {
                     BytecodeTraceBuilder bytecode_builder;
+                    auto process = [&](auto chunk) { bytecode_builder.process_decomposition(chunk, trace); };
                     AVM_TRACK_TIME("tracegen/bytecode_decomposition",
-                                   bytecode_builder.process_decomposition(events.bytecode_decomposition, trace));
-                    clear_events(events.bytecode_decomposition);
+                                   events.bytecode_decomposition.for_each_chunk(process));
+                    events.bytecode_decomposition.clear();
                 },
                 [&]() {
                     BytecodeTraceBuilder bytecode_builder;
-                    AVM_TRACK_TIME("tracegen/bytecode_hashing",
-                                   bytecode_builder.process_hashing(events.bytecode_hashing, trace));
-                    clear_events(events.bytecode_hashing);
+                    auto process = [&](auto chunk) { bytecode_builder.process_hashing(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/bytecode_hashing", events.bytecode_hashing.for_each_chunk(process));
+                    events.bytecode_hashing.clear();
                 },
                 [&]() {
                     ClassIdDerivationTraceBuilder class_id_builder;
-                    AVM_TRACK_TIME("tracegen/class_id_derivation",
-                                   class_id_builder.process(events.class_id_derivation, trace));
-                    clear_events(events.class_id_derivation);
+                    auto process = [&](auto chunk) { class_id_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/class_id_derivation", events.class_id_derivation.for_each_chunk(process));
+                    events.class_id_derivation.clear();
                 },
                 [&]() {
                     BytecodeTraceBuilder bytecode_builder;
-                    AVM_TRACK_TIME("tracegen/bytecode_retrieval",
-                                   bytecode_builder.process_retrieval(events.bytecode_retrieval, trace));
-                    clear_events(events.bytecode_retrieval);
+                    auto process = [&](auto chunk) { bytecode_builder.process_retrieval(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/bytecode_retrieval", events.bytecode_retrieval.for_each_chunk(process));
+                    events.bytecode_retrieval.clear();
                 },
                 [&]() {
                     BytecodeTraceBuilder bytecode_builder;
+                    auto process = [&](auto chunk) { bytecode_builder.process_instruction_fetching(chunk, trace); };
                     AVM_TRACK_TIME("tracegen/instruction_fetching",
-                                   bytecode_builder.process_instruction_fetching(events.instruction_fetching, trace));
-                    clear_events(events.instruction_fetching);
+                                   events.instruction_fetching.for_each_chunk(process));
+                    events.instruction_fetching.clear();
                 },
                 [&]() {
                     Sha256TraceBuilder sha256_builder(trace);
-                    AVM_TRACK_TIME("tracegen/sha256_compression", sha256_builder.process(events.sha256_compression));
-                    clear_events(events.sha256_compression);
+                    auto process = [&](auto chunk) { sha256_builder.process(chunk); };
+                    AVM_TRACK_TIME("tracegen/sha256_compression", events.sha256_compression.for_each_chunk(process));
+                    events.sha256_compression.clear();
                 },
                 [&]() {
                     EccTraceBuilder ecc_builder;
-                    AVM_TRACK_TIME("tracegen/ecc_add", ecc_builder.process_add(events.ecc_add, trace));
-                    clear_events(events.ecc_add);
+                    auto process = [&](auto chunk) { ecc_builder.process_add(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/ecc_add", events.ecc_add.for_each_chunk(process));
+                    events.ecc_add.clear();
                 },
                 [&]() {
                     EccTraceBuilder ecc_builder;
-                    AVM_TRACK_TIME("tracegen/scalar_mul", ecc_builder.process_scalar_mul(events.scalar_mul, trace));
-                    clear_events(events.scalar_mul);
+                    auto process = [&](auto chunk) { ecc_builder.process_scalar_mul(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/scalar_mul", events.scalar_mul.for_each_chunk(process));
+                    events.scalar_mul.clear();
                 },
                 [&]() {
                     Poseidon2TraceBuilder poseidon2_builder;
-                    AVM_TRACK_TIME("tracegen/poseidon2_hash",
-                                   poseidon2_builder.process_hash(events.poseidon2_hash, trace));
-                    clear_events(events.poseidon2_hash);
+                    auto process = [&](auto chunk) { poseidon2_builder.process_hash(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/poseidon2_hash", events.poseidon2_hash.for_each_chunk(process));
+                    events.poseidon2_hash.clear();
                 },
                 [&]() {
                     Poseidon2TraceBuilder poseidon2_builder;
+                    auto process = [&](auto chunk) { poseidon2_builder.process_permutation(chunk, trace); };
                     AVM_TRACK_TIME("tracegen/poseidon2_permutation",
-                                   poseidon2_builder.process_permutation(events.poseidon2_permutation, trace));
-                    clear_events(events.poseidon2_permutation);
+                                   events.poseidon2_permutation.for_each_chunk(process));
+                    events.poseidon2_permutation.clear();
                 },
                 [&]() {
                     ToRadixTraceBuilder to_radix_builder;
-                    AVM_TRACK_TIME("tracegen/to_radix", to_radix_builder.process(events.to_radix, trace));
-                    clear_events(events.to_radix);
+                    auto process = [&](auto chunk) { to_radix_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/to_radix", events.to_radix.for_each_chunk(process));
+                    events.to_radix.clear();
                 },
                 [&]() {
                     FieldGreaterThanTraceBuilder field_gt_builder;
-                    AVM_TRACK_TIME("tracegen/field_gt", field_gt_builder.process(events.field_gt, trace));
-                    clear_events(events.field_gt);
+                    auto process = [&](auto chunk) { field_gt_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/field_gt", events.field_gt.for_each_chunk(process));
+                    events.field_gt.clear();
                 },
                 [&]() {
                     MerkleCheckTraceBuilder merkle_check_builder;
-                    AVM_TRACK_TIME("tracegen/merkle_check", merkle_check_builder.process(events.merkle_check, trace));
-                    clear_events(events.merkle_check);
+                    auto process = [&](auto chunk) { merkle_check_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/merkle_check", events.merkle_check.for_each_chunk(process));
+                    events.merkle_check.clear();
                 },
                 [&]() {
                     RangeCheckTraceBuilder range_check_builder;
-                    AVM_TRACK_TIME("tracegen/range_check", range_check_builder.process(events.range_check, trace));
-                    clear_events(events.range_check);
+                    auto process = [&](auto chunk) { range_check_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/range_check", events.range_check.for_each_chunk(process));
+                    events.range_check.clear();
                 },
                 [&]() {
                     PublicDataTreeCheckTraceBuilder public_data_tree_check_trace_builder;
-                    AVM_TRACK_TIME(
-                        "tracegen/public_data_tree_check",
-                        public_data_tree_check_trace_builder.process(events.public_data_tree_check_events, trace));
-                    clear_events(events.public_data_tree_check_events);
+                    auto process = [&](auto chunk) { public_data_tree_check_trace_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/public_data_tree_check",
+                                   events.public_data_tree_check_events.for_each_chunk(process));
+                    events.public_data_tree_check_events.clear();
                 },
                 [&]() {
                     UpdateCheckTraceBuilder update_check_trace_builder;
-                    AVM_TRACK_TIME("tracegen/update_check",
-                                   update_check_trace_builder.process(events.update_check_events, trace));
-                    clear_events(events.update_check_events);
+                    auto process = [&](auto chunk) { update_check_trace_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/update_check", events.update_check_events.for_each_chunk(process));
+                    events.update_check_events.clear();
                 },
                 [&]() {
                     NullifierTreeCheckTraceBuilder nullifier_tree_check_trace_builder;
-                    AVM_TRACK_TIME(
-                        "tracegen/nullifier_tree_check",
-                        nullifier_tree_check_trace_builder.process(events.nullifier_tree_check_events, trace));
-                    clear_events(events.nullifier_tree_check_events);
+                    auto process = [&](auto chunk) { nullifier_tree_check_trace_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/nullifier_tree_check",
+                                   events.nullifier_tree_check_events.for_each_chunk(process));
+                    events.nullifier_tree_check_events.clear();
                 },
                 [&]() {
                     MemoryTraceBuilder memory_trace_builder;
-                    AVM_TRACK_TIME("tracegen/memory", memory_trace_builder.process(events.memory, trace));
-                    clear_events(events.memory);
+                    auto process = [&](auto chunk) { memory_trace_builder.process(chunk, trace); };
+                    AVM_TRACK_TIME("tracegen/memory", events.memory.for_each_chunk(process));
+                    events.memory.clear();
                 },
             });
         AVM_TRACK_TIME("tracegen/traces", execute_jobs(jobs));
@@ -321,13 +480,35 @@ TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events, const
                                                   NullifierTreeCheckTraceBuilder::lookup_jobs(),
                                                   MemoryTraceBuilder::lookup_jobs());
 
-        AVM_TRACK_TIME("tracegen/interactions",
-                       parallel_for(jobs_interactions.size(), [&](size_t i) { jobs_interactions[i]->process(trace); }));
+        if (on_final_columns) {
+            // The traces are done, so only the columns written by the interactions can still change.
+            std::vector<bool> written(TraceContainer::num_columns());
+            for (const auto& job : jobs_interactions) {
+                for (const Column col : job->get_written_columns()) {
+                    // Otherwise, the column could be reported before every interaction writing it is done.
+                    ASSERT(!written[static_cast<size_t>(col)]);
+                    written[static_cast<size_t>(col)] = true;
+                }
+            }
+            std::vector<Column> final_columns;
+            for (size_t col = 0; col < written.size(); ++col) {
+                if (!written[col]) {
+                    final_columns.push_back(static_cast<Column>(col));
+                }
+            }
+            on_final_columns(final_columns);
+        }
+
+        AVM_TRACK_TIME("tracegen/interactions", parallel_for(jobs_interactions.size(), [&](size_t i) {
+                           jobs_interactions[i]->process(trace);
+                           if (on_final_columns) {
+                               on_final_columns(jobs_interactions[i]->get_written_columns());
+                           }
+                       }));
     }
 
     check_interactions(trace);
     print_trace_stats(trace);
-    return trace;
 }
 
 TraceContainer AvmTraceGenHelper::generate_precomputed_columns()
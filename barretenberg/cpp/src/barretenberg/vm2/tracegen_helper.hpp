@@ -1,6 +1,12 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <span>
+
 #include "barretenberg/vm2/common/avm_inputs.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/precomputed_snapshot.hpp"
 #include "barretenberg/vm2/simulation/events/events_container.hpp"
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
@@ -8,11 +14,38 @@ namespace bb::avm2 {
 
 class AvmTraceGenHelper {
   public:
+    // Called with columns that will not be written anymore, although they can still be read. Can be called
+    // concurrently.
+    using FinalColumnsCallback = std::function<void(std::span<const Column>)>;
+
     AvmTraceGenHelper() = default;
+    // The precomputed columns of the traces are taken from the snapshot instead of being generated.
+    explicit AvmTraceGenHelper(std::shared_ptr<const PrecomputedSnapshot> precomputed_snapshot)
+        : precomputed_snapshot(std::move(precomputed_snapshot))
+    {}
 
     tracegen::TraceContainer generate_trace(simulation::EventsContainer&& events, const PublicInputs& public_inputs);
+    // Runs the simulation and tracegen concurrently. The simulation streams batches of events to the sinks, which
+    // are processed into the trace while the simulation continues. The rest of the events are processed afterwards.
+    tracegen::TraceContainer generate_trace_streaming(
+        const std::function<simulation::EventsContainer(simulation::EventBatchSinks&)>& simulate,
+        const PublicInputs& public_inputs);
+    // As above, but fills the given trace, and reports its columns as soon as they are final (e.g., to commit to them
+    // while the interactions are computed).
+    void fill_trace_streaming(tracegen::TraceContainer& trace,
+                              const std::function<simulation::EventsContainer(simulation::EventBatchSinks&)>& simulate,
+                              const PublicInputs& public_inputs,
+                              const FinalColumnsCallback& on_final_columns);
     tracegen::TraceContainer generate_precomputed_columns();
     tracegen::TraceContainer generate_public_inputs_columns(const PublicInputs& public_inputs);
+
+  private:
+    void fill_trace(tracegen::TraceContainer& trace,
+                    simulation::EventsContainer&& events,
+                    const PublicInputs& public_inputs,
+                    const FinalColumnsCallback& on_final_columns = nullptr);
+
+    std::shared_ptr<const PrecomputedSnapshot> precomputed_snapshot;
 };
 
 } // namespace bb::avm2
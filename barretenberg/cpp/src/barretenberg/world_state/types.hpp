@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
@@ -42,6 +43,16 @@ struct WorldStateRevision {
     static WorldStateRevision uncommitted() { return WorldStateRevision{ .includeUncommitted = true }; }
 };
 
+// The leaves of a block to be synced, see WorldState::sync_block
+struct SyncBlockData {
+    StateReference blockStateRef;
+    bb::fr blockHeaderHash;
+    std::vector<bb::fr> noteHashes;
+    std::vector<bb::fr> l1ToL2Messages;
+    std::vector<crypto::merkle_tree::NullifierLeafValue> nullifiers;
+    std::vector<crypto::merkle_tree::PublicDataLeafValue> publicDataWrites;
+};
+
 struct WorldStateStatusSummary {
     index_t unfinalisedBlockNumber;
     index_t finalisedBlockNumber;
@@ -49,6 +49,7 @@ WorldState::WorldState(uint64_t thread_pool_size,
     // We set the max readers to be high, at least the number of given threads or the default if higher
     uint64_t maxReaders = std::max(thread_pool_size, DEFAULT_MIN_NUMBER_OF_READERS);
     create_canonical_fork(data_dir, map_size, prefilled_public_data, maxReaders);
+    unwind_trees_to_common_block();
 }
 
 WorldState::WorldState(uint64_t thread_pool_size,
@@ -673,6 +674,39 @@ WorldStateStatusFull WorldState::sync_block(const StateReference& block_state_re
     return status;
 }
 
+WorldStateStatusFull WorldState::sync_blocks(const std::vector<SyncBlockData>& blocks)
+{
+    if (blocks.empty()) {
+        throw std::runtime_error("Can't synch blocks: no blocks provided");
+    }
+    // Flushes the blocks committed so far and restores the durable commits
+    auto end_group = [this]() {
+        for (const auto& store : *_persistentStores) {
+            store->sync();
+            store->set_sync_on_commit(true);
+        }
+    };
+    for (const auto& store : *_persistentStores) {
+        store->set_sync_on_commit(false);
+    }
+    WorldStateStatusFull status;
+    try {
+        for (const auto& block : blocks) {
+            status = sync_block(block.blockStateRef,
+                                block.blockHeaderHash,
+                                block.noteHashes,
+                                block.l1ToL2Messages,
+                                block.nullifiers,
+                                block.publicDataWrites);
+        }
+    } catch (std::exception&) {
+        end_group();
+        throw;
+    }
+    end_group();
+    return status;
+}
+
 GetLowIndexedLeafResponse WorldState::find_low_leaf_index(const WorldStateRevision& revision,
                                                           MerkleTreeId tree_id,
                                                           const bb::fr& leaf_key) const
@@ -1024,6 +1058,50 @@ void WorldState::validate_trees_are_equally_synched()
     }
 }
 
+void WorldState::unwind_trees_to_common_block()
+{
+    WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
+    std::array<TreeMeta, NUM_TREES> responses;
+    get_all_tree_info(revision, responses);
+    if (determine_if_synched(responses)) {
+        return;
+    }
+    // The trees can only be left at different blocks by an interrupted commit, the blocks that only some of the trees
+    // committed are removed so they can be synced again
+    block_number_t commonBlockNumber = responses[0].unfinalisedBlockHeight;
+    for (const auto& meta : responses) {
+        commonBlockNumber = std::min(commonBlockNumber, meta.unfinalisedBlockHeight);
+    }
+    info("World state trees are out of sync, unwinding them to block ", commonBlockNumber);
+
+    Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
+    for (auto& [id, tree] : fork->_trees) {
+        for (block_number_t blockNumber = responses[id].unfinalisedBlockHeight; blockNumber > commonBlockNumber;
+             blockNumber--) {
+            Signal signal;
+            Response response;
+            std::visit(
+                [&](auto&& wrapper) {
+                    wrapper.tree->unwind_block(blockNumber, [&](TypedResponse<UnwindResponse>& resp) {
+                        response.success = resp.success;
+                        response.message = std::move(resp.message);
+                        signal.signal_level();
+                    });
+                },
+                tree);
+            signal.wait_for_level();
+            if (!response.success) {
+                throw std::runtime_error(format("Unable to unwind tree ",
+                                                getMerkleTreeName(id),
+                                                " to block ",
+                                                commonBlockNumber,
+                                                ": ",
+                                                response.message));
+            }
+        }
+    }
+}
+
 bool WorldState::determine_if_synched(std::array<TreeMeta, NUM_TREES>& metaResponses)
 {
     block_number_t blockNumber = metaResponses[0].unfinalisedBlockHeight;
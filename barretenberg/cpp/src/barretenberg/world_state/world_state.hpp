@@ -273,6 +273,14 @@ class WorldState {
                                     const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
                                     const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes);
 
+    /**
+     * @brief Syncs consecutive blocks as sync_block does, as one group commit: each tree commits the blocks without
+     * flushing them to disk, and all the stores are flushed once the group is synced (or fails).
+     * A system crash during the group can lose a different number of the group's blocks in each tree; the trees are
+     * unwound to their common block when the world state is next opened, after which the blocks can be synced again.
+     */
+    WorldStateStatusFull sync_blocks(const std::vector<SyncBlockData>& blocks);
+
     void checkpoint(const uint64_t& forkId);
     void commit_checkpoint(const uint64_t& forkId);
     void revert_checkpoint(const uint64_t& forkId);
@@ -306,6 +314,8 @@ class WorldState {
 
     void validate_trees_are_equally_synched();
 
+    void unwind_trees_to_common_block();
+
     static bool block_state_matches_world_state(const StateReference& block_state_ref,
                                                 const StateReference& tree_state_ref);
 
@@ -929,3 +929,127 @@ TEST_F(WorldStateTest, GetBlockForIndex)
         EXPECT_EQ(blockNumbers[0].value(), 1);
     }
 }
+
+// Builds num_blocks blocks on top of the latest block of ws, syncs them to ws and returns them
+std::vector<SyncBlockData> build_and_sync_blocks(WorldState& ws, size_t num_blocks)
+{
+    std::vector<SyncBlockData> blocks;
+    for (size_t i = 0; i < num_blocks; i++) {
+        WorldStateStatusSummary status;
+        ws.get_status_summary(status);
+        const uint64_t value = 1000 * (status.unfinalisedBlockNumber + 1);
+
+        SyncBlockData block{ .blockStateRef = {},
+                             .blockHeaderHash = fr(value),
+                             .noteHashes = { fr(value + 1), fr(value + 2) },
+                             .l1ToL2Messages = { fr(value + 3) },
+                             .nullifiers = { NullifierLeafValue(value + 4) },
+                             .publicDataWrites = { PublicDataLeafValue(value + 5, 1) } };
+        auto fork_id = ws.create_fork(std::nullopt);
+        ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, block.noteHashes, fork_id);
+        ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, block.l1ToL2Messages, fork_id);
+        ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, block.nullifiers, 0, fork_id);
+        ws.insert_indexed_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, block.publicDataWrites, fork_id);
+        block.blockStateRef =
+            ws.get_state_reference(WorldStateRevision{ .forkId = fork_id, .includeUncommitted = true });
+        ws.delete_fork(fork_id);
+
+        ws.sync_block(block.blockStateRef,
+                      block.blockHeaderHash,
+                      block.noteHashes,
+                      block.l1ToL2Messages,
+                      block.nullifiers,
+                      block.publicDataWrites);
+        blocks.push_back(block);
+    }
+    return blocks;
+}
+
+TEST_F(WorldStateTest, SyncBlocksMatchesSyncBlock)
+{
+    std::string data_dir_reference = random_temp_directory();
+    std::filesystem::create_directories(data_dir_reference);
+    std::vector<SyncBlockData> blocks;
+    StateReference reference_state_ref;
+    {
+        WorldState ws_reference(
+            thread_pool_size, data_dir_reference, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        blocks = build_and_sync_blocks(ws_reference, 4);
+        reference_state_ref = ws_reference.get_state_reference(WorldStateRevision::committed());
+    }
+    std::filesystem::remove_all(data_dir_reference);
+
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    WorldStateStatusFull status = ws.sync_blocks({ blocks.begin(), blocks.begin() + 3 });
+    WorldStateStatusSummary expected{ 3, 0, 1, true };
+    EXPECT_EQ(status.summary, expected);
+
+    // Blocks can keep being synced one at a time after a group
+    status = ws.sync_blocks({ blocks.back() });
+    expected = WorldStateStatusSummary{ 4, 0, 1, true };
+    EXPECT_EQ(status.summary, expected);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), reference_state_ref);
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, 4, blocks.back().blockHeaderHash);
+
+    EXPECT_THROW(ws.sync_blocks({}), std::runtime_error);
+}
+
+TEST_F(WorldStateTest, SyncBlocksRejectsInvalidBlock)
+{
+    std::vector<SyncBlockData> blocks;
+    {
+        WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        blocks = build_and_sync_blocks(ws, 2);
+    }
+    std::filesystem::remove_all(data_dir);
+    std::filesystem::create_directories(data_dir);
+
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    blocks[1].noteHashes.emplace_back(42);
+    EXPECT_THROW(ws.sync_blocks(blocks), std::runtime_error);
+
+    // The blocks before the invalid one are committed
+    WorldStateStatusSummary status;
+    ws.get_status_summary(status);
+    WorldStateStatusSummary expected{ 1, 0, 1, true };
+    EXPECT_EQ(status, expected);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), blocks[0].blockStateRef);
+}
+
+TEST_F(WorldStateTest, UnwindsTreesLeftAtDifferentBlocks)
+{
+    std::string data_dir_block_1 = random_temp_directory();
+    std::string data_dir_block_2 = random_temp_directory();
+    std::vector<SyncBlockData> blocks;
+    {
+        WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        blocks = build_and_sync_blocks(ws, 1);
+        ws.copy_stores(data_dir_block_1, false);
+        auto block_2 = build_and_sync_blocks(ws, 1);
+        blocks.push_back(block_2[0]);
+        ws.copy_stores(data_dir_block_2, false);
+    }
+
+    // As if the commit of block 2 was interrupted after the note hash tree had committed it
+    const std::string note_hash_tree_name = getMerkleTreeName(MerkleTreeId::NOTE_HASH_TREE);
+    std::filesystem::remove_all(std::filesystem::path(data_dir_block_1) / note_hash_tree_name);
+    std::filesystem::copy(std::filesystem::path(data_dir_block_2) / note_hash_tree_name,
+                          std::filesystem::path(data_dir_block_1) / note_hash_tree_name);
+    std::filesystem::remove_all(data_dir_block_2);
+
+    {
+        WorldState ws(
+            thread_pool_size, data_dir_block_1, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        WorldStateStatusSummary status;
+        ws.get_status_summary(status);
+        WorldStateStatusSummary expected{ 1, 0, 1, true };
+        EXPECT_EQ(status, expected);
+        EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), blocks[0].blockStateRef);
+
+        WorldStateStatusFull full_status = ws.sync_blocks({ blocks[1] });
+        expected = WorldStateStatusSummary{ 2, 0, 1, true };
+        EXPECT_EQ(full_status.summary, expected);
+        EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), blocks[1].blockStateRef);
+    }
+    std::filesystem::remove_all(data_dir_block_1);
+}
@@ -43,6 +43,8 @@ export enum WorldStateMessageType {
 
   COPY_STORES,
 
+  SYNC_BLOCKS,
+
   CLOSE = 999,
 }
 
@@ -394,7 +396,8 @@ interface UpdateArchiveRequest extends WithForkId {
   blockHeaderHash: Buffer;
 }
 
-interface SyncBlockRequest extends WithCanonicalForkId {
+/** The leaves of a block, as they are inserted into the trees. */
+export interface SyncBlockData {
   blockNumber: number;
   blockStateRef: BlockStateReference;
   blockHeaderHash: Fr;
@@ -404,6 +407,13 @@ interface SyncBlockRequest extends WithCanonicalForkId {
   publicDataWrites: readonly SerializedLeafValue[];
 }
 
+type SyncBlockRequest = SyncBlockData & WithCanonicalForkId;
+
+interface SyncBlocksRequest extends WithCanonicalForkId {
+  /** Consecutive blocks, synced as one group commit. */
+  blocks: SyncBlockData[];
+}
+
 interface CreateForkRequest extends WithCanonicalForkId {
   latest: boolean;
   blockNumber: number;
@@ -472,6 +482,7 @@ export type WorldStateRequest = {
   [WorldStateMessageType.REVERT_CHECKPOINT]: WithForkId;
 
   [WorldStateMessageType.COPY_STORES]: CopyStoresRequest;
+  [WorldStateMessageType.SYNC_BLOCKS]: SyncBlocksRequest;
 
   [WorldStateMessageType.CLOSE]: WithCanonicalForkId;
 };
@@ -514,6 +525,7 @@ export type WorldStateResponse = {
   [WorldStateMessageType.REVERT_CHECKPOINT]: void;
 
   [WorldStateMessageType.COPY_STORES]: void;
+  [WorldStateMessageType.SYNC_BLOCKS]: WorldStateStatusFull;
 
   [WorldStateMessageType.CLOSE]: void;
 };
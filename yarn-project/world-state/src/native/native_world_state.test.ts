@@ -394,6 +394,32 @@ describe('NativeWorldState', () => {
       expect(status.finalisedBlockNumber).toBe(8n);
     });
 
+    it('syncs consecutive blocks as one group', async () => {
+      const fork = await ws.fork();
+      const blocks: L2Block[] = [];
+      const messages: Fr[][] = [];
+      for (let blockNumber = 1; blockNumber <= 8; blockNumber++) {
+        const mocked = await mockBlock(blockNumber, 1, fork);
+        blocks.push(mocked.block);
+        messages.push(mocked.messages);
+      }
+
+      await expect(
+        ws.handleL2BlocksAndMessages([blocks[0], blocks[2]], [messages[0], messages[2]]),
+      ).rejects.toThrow(/consecutive/);
+
+      const status = await ws.handleL2BlocksAndMessages(blocks, messages);
+      expect(status.summary.unfinalisedBlockNumber).toBe(8n);
+      expect(status.summary.finalisedBlockNumber).toBe(0n);
+      await assertSameState(fork, ws.getCommitted());
+
+      // Single blocks can follow the group.
+      const { block, messages: blockMessages } = await mockBlock(9, 1, fork);
+      const nextStatus = await ws.handleL2BlockAndMessages(block, blockMessages);
+      expect(nextStatus.summary.unfinalisedBlockNumber).toBe(9n);
+      await assertSameState(fork, ws.getCommitted());
+    });
+
     it('can prune historic blocks', async () => {
       const fork = await ws.fork();
       const forks = [];
@@ -26,6 +26,7 @@ import type { WorldStateTreeMapSizes } from '../synchronizer/factory.js';
 import type { MerkleTreeAdminDatabase as MerkleTreeDatabase } from '../world-state-db/merkle_tree_db.js';
 import { MerkleTreesFacade, MerkleTreesForkFacade, serializeLeaf } from './merkle_trees_facade.js';
 import {
+  type SyncBlockData,
   WorldStateMessageType,
   type WorldStateStatusFull,
   type WorldStateStatusSummary,
@@ -168,6 +169,42 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
   }
 
   public async handleL2BlockAndMessages(l2Block: L2Block, l1ToL2Messages: Fr[]): Promise<WorldStateStatusFull> {
+    const block = await this.buildSyncBlockData(l2Block, l1ToL2Messages);
+    try {
+      return await this.instance.call(
+        WorldStateMessageType.SYNC_BLOCK,
+        { ...block, canonical: true },
+        this.sanitiseAndCacheSummaryFromFull.bind(this),
+        this.deleteCachedSummary.bind(this),
+      );
+    } catch (err) {
+      this.worldStateInstrumentation.incCriticalErrors('synch_pending_block');
+      throw err;
+    }
+  }
+
+  public async handleL2BlocksAndMessages(l2Blocks: L2Block[], l1ToL2Messages: Fr[][]): Promise<WorldStateStatusFull> {
+    assert(l2Blocks.length > 0, 'No blocks to sync');
+    assert.equal(l1ToL2Messages.length, l2Blocks.length, 'Expected the L1 to L2 messages of every block');
+    for (let i = 1; i < l2Blocks.length; i++) {
+      assert.equal(l2Blocks[i].number, l2Blocks[i - 1].number + 1, 'Blocks to sync must be consecutive');
+    }
+
+    const blocks = await Promise.all(l2Blocks.map((block, i) => this.buildSyncBlockData(block, l1ToL2Messages[i])));
+    try {
+      return await this.instance.call(
+        WorldStateMessageType.SYNC_BLOCKS,
+        { blocks, canonical: true },
+        this.sanitiseAndCacheSummaryFromFull.bind(this),
+        this.deleteCachedSummary.bind(this),
+      );
+    } catch (err) {
+      this.worldStateInstrumentation.incCriticalErrors('synch_pending_block');
+      throw err;
+    }
+  }
+
+  private async buildSyncBlockData(l2Block: L2Block, l1ToL2Messages: Fr[]): Promise<SyncBlockData> {
     // We have to pad both the values within tx effects because that's how the trees are built by circuits.
     const paddedNoteHashes = l2Block.body.txEffects.flatMap(txEffect =>
       padArrayEnd(txEffect.noteHashes, Fr.ZERO, MAX_NOTE_HASHES_PER_TX),
@@ -187,26 +224,15 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
       });
     });
 
-    try {
-      return await this.instance.call(
-        WorldStateMessageType.SYNC_BLOCK,
-        {
-          blockNumber: l2Block.number,
-          blockHeaderHash: await l2Block.header.hash(),
-          paddedL1ToL2Messages: paddedL1ToL2Messages.map(serializeLeaf),
-          paddedNoteHashes: paddedNoteHashes.map(serializeLeaf),
-          paddedNullifiers: paddedNullifiers.map(serializeLeaf),
-          publicDataWrites: publicDataWrites.map(serializeLeaf),
-          blockStateRef: blockStateReference(l2Block.header.state),
-          canonical: true,
-        },
-        this.sanitiseAndCacheSummaryFromFull.bind(this),
-        this.deleteCachedSummary.bind(this),
-      );
-    } catch (err) {
-      this.worldStateInstrumentation.incCriticalErrors('synch_pending_block');
-      throw err;
-    }
+    return {
+      blockNumber: l2Block.number,
+      blockHeaderHash: await l2Block.header.hash(),
+      paddedL1ToL2Messages: paddedL1ToL2Messages.map(serializeLeaf),
+      paddedNoteHashes: paddedNoteHashes.map(serializeLeaf),
+      paddedNullifiers: paddedNullifiers.map(serializeLeaf),
+      publicDataWrites: publicDataWrites.map(serializeLeaf),
+      blockStateRef: blockStateReference(l2Block.header.state),
+    };
   }
 
   public async close(): Promise<void> {
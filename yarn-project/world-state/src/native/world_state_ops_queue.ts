@@ -33,6 +33,7 @@ export const MUTATING_MSG_TYPES = new Set([
   WorldStateMessageType.COMMIT,
   WorldStateMessageType.ROLLBACK,
   WorldStateMessageType.SYNC_BLOCK,
+  WorldStateMessageType.SYNC_BLOCKS,
   WorldStateMessageType.CREATE_FORK,
   WorldStateMessageType.DELETE_FORK,
   WorldStateMessageType.FINALISE_BLOCKS,
@@ -32,6 +32,7 @@ describe('ServerWorldStateSynchronizer', () => {
 
   let server: TestWorldStateSynchronizer;
   let latestHandledBlockNumber: number;
+  let numHandledBlocks: number;
 
   const LATEST_BLOCK_NUMBER = 5;
 
@@ -63,9 +64,16 @@ describe('ServerWorldStateSynchronizer', () => {
     merkleTreeDb.getCommitted.mockReturnValue(merkleTreeRead);
     merkleTreeDb.handleL2BlockAndMessages.mockImplementation((l2Block: L2Block) => {
       latestHandledBlockNumber = l2Block.number;
+      numHandledBlocks++;
+      return Promise.resolve(buildEmptyWorldStateStatusFull());
+    });
+    merkleTreeDb.handleL2BlocksAndMessages.mockImplementation((l2Blocks: L2Block[]) => {
+      latestHandledBlockNumber = l2Blocks.at(-1)!.number;
+      numHandledBlocks += l2Blocks.length;
       return Promise.resolve(buildEmptyWorldStateStatusFull());
     });
     latestHandledBlockNumber = 0;
+    numHandledBlocks = 0;
 
     merkleTreeDb.getStatusSummary.mockResolvedValue({
       unfinalisedBlockNumber: BigInt(latestHandledBlockNumber),
@@ -134,7 +142,7 @@ describe('ServerWorldStateSynchronizer', () => {
 
     // and check the final status
     await expectServerStatus(WorldStateRunningState.STOPPED, 5);
-    expect(merkleTreeDb.handleL2BlockAndMessages).toHaveBeenCalledTimes(5);
+    expect(numHandledBlocks).toEqual(5);
   });
 
   it('handles multiple calls to start', async () => {
@@ -147,7 +155,7 @@ describe('ServerWorldStateSynchronizer', () => {
     await server.start();
 
     await expectServerStatus(WorldStateRunningState.RUNNING, 5);
-    expect(merkleTreeDb.handleL2BlockAndMessages).toHaveBeenCalledTimes(5);
+    expect(numHandledBlocks).toEqual(5);
   });
 
   it('immediately syncs if no new blocks', async () => {
@@ -174,7 +182,7 @@ describe('ServerWorldStateSynchronizer', () => {
     await server.syncImmediate();
 
     await expectServerStatus(WorldStateRunningState.RUNNING, 7);
-    expect(merkleTreeDb.handleL2BlockAndMessages).toHaveBeenCalledTimes(7);
+    expect(numHandledBlocks).toEqual(7);
   });
 
   it('can immediately sync to a minimum block number', async () => {
@@ -185,7 +193,7 @@ describe('ServerWorldStateSynchronizer', () => {
     await server.syncImmediate(7);
 
     await expectServerStatus(WorldStateRunningState.RUNNING, 8);
-    expect(merkleTreeDb.handleL2BlockAndMessages).toHaveBeenCalledTimes(8);
+    expect(numHandledBlocks).toEqual(8);
   });
 
   it('sync returns immediately if block was already synced', async () => {
@@ -196,7 +204,7 @@ describe('ServerWorldStateSynchronizer', () => {
     expect(l2BlockStream.sync).not.toHaveBeenCalled();
 
     await expectServerStatus(WorldStateRunningState.RUNNING, 5);
-    expect(merkleTreeDb.handleL2BlockAndMessages).toHaveBeenCalledTimes(5);
+    expect(numHandledBlocks).toEqual(5);
   });
 
   it('throws if you try to sync to an unavailable block', async () => {
@@ -210,9 +218,45 @@ describe('ServerWorldStateSynchronizer', () => {
     await expect(server.syncImmediate(3)).rejects.toThrow(/is not running/i);
   });
 
+  it('syncs the blocks of the catch-up as groups', async () => {
+    void server.start();
+    await pushBlocks(1, 3);
+    await pushBlocks(4, 5);
+    await expectServerStatus(WorldStateRunningState.RUNNING, 5);
+
+    expect(merkleTreeDb.handleL2BlockAndMessages).not.toHaveBeenCalled();
+    expect(merkleTreeDb.handleL2BlocksAndMessages).toHaveBeenCalledTimes(2);
+    const blockNumbers = merkleTreeDb.handleL2BlocksAndMessages.mock.calls.map(([blocks]) => blocks.map(b => b.number));
+    expect(blockNumbers).toEqual([
+      [1, 2, 3],
+      [4, 5],
+    ]);
+    expect(merkleTreeDb.handleL2BlocksAndMessages.mock.calls[0][1]).toEqual([
+      l1ToL2Messages,
+      l1ToL2Messages,
+      l1ToL2Messages,
+    ]);
+
+    // Once running, blocks are synced one by one.
+    await pushBlocks(6, 7);
+    await expectServerStatus(WorldStateRunningState.RUNNING, 7);
+    expect(numHandledBlocks).toEqual(2);
+    expect(merkleTreeDb.handleL2BlocksAndMessages).toHaveBeenCalledTimes(2);
+  });
+
+  it('does not sync a group with a block whose messages do not match', async () => {
+    void server.start();
+    blockAndMessagesSource.getL1ToL2Messages.mockImplementation(blockNumber =>
+      Promise.resolve(blockNumber === 2n ? [Fr.random()] : l1ToL2Messages),
+    );
+    await expect(pushBlocks(1, 3)).rejects.toThrow(/inHash/);
+    expect(merkleTreeDb.handleL2BlocksAndMessages).not.toHaveBeenCalled();
+  });
+
   it('throws if handling blocks fails', async () => {
     void server.start();
     merkleTreeDb.handleL2BlockAndMessages.mockRejectedValue(new Error('Test error'));
+    merkleTreeDb.handleL2BlocksAndMessages.mockRejectedValue(new Error('Test error'));
     await expect(pushBlocks(1, 5)).rejects.toThrow(/Test error/i);
   });
 });
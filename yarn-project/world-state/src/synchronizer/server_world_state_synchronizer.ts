@@ -286,17 +286,15 @@ export class ServerWorldStateSynchronizer
     const l1ToL2Messages: Fr[][] = await Promise.all(messagePromises);
     let updateStatus: WorldStateStatusFull | undefined = undefined;
 
-    for (let i = 0; i < l2Blocks.length; i++) {
-      const [duration, result] = await elapsed(() => this.handleL2Block(l2Blocks[i], l1ToL2Messages[i]));
-      this.log.info(`World state updated with L2 block ${l2Blocks[i].number}`, {
-        eventName: 'l2-block-handled',
-        duration,
-        unfinalisedBlockNumber: result.summary.unfinalisedBlockNumber,
-        finalisedBlockNumber: result.summary.finalisedBlockNumber,
-        oldestHistoricBlock: result.summary.oldestHistoricalBlock,
-        ...l2Blocks[i].getStats(),
-      } satisfies L2BlockHandledStats);
-      updateStatus = result;
+    if (this.currentState === WorldStateRunningState.SYNCHING && l2Blocks.length > 1) {
+      // While catching up, the blocks are synced as one group rather than flushing every block to disk.
+      updateStatus = await this.handleL2BlockGroup(l2Blocks, l1ToL2Messages);
+    } else {
+      for (let i = 0; i < l2Blocks.length; i++) {
+        const [duration, result] = await elapsed(() => this.handleL2Block(l2Blocks[i], l1ToL2Messages[i]));
+        this.logBlockHandled(l2Blocks[i], duration, result);
+        updateStatus = result;
+      }
     }
     if (!updateStatus) {
       return;
@@ -304,6 +302,40 @@ export class ServerWorldStateSynchronizer
     this.instrumentation.updateWorldStateMetrics(updateStatus);
   }
 
+  /**
+   * Handles consecutive L2 blocks as one group commit.
+   * @param l2Blocks - The L2 blocks to handle.
+   * @param l1ToL2Messages - The L1 to L2 messages of each block.
+   */
+  private async handleL2BlockGroup(l2Blocks: L2Block[], l1ToL2Messages: Fr[][]): Promise<WorldStateStatusFull> {
+    for (let i = 0; i < l2Blocks.length; i++) {
+      await this.verifyMessagesHashToInHash(l1ToL2Messages[i], l2Blocks[i].header.contentCommitment.inHash);
+    }
+
+    this.log.trace(`Pushing L2 blocks ${l2Blocks[0].number} to ${l2Blocks.at(-1)!.number} to merkle tree db`);
+    const [duration, result] = await elapsed(() =>
+      this.merkleTreeDb.handleL2BlocksAndMessages(l2Blocks, l1ToL2Messages),
+    );
+    // The blocks are synced together, so each one is attributed its share of the time.
+    for (const block of l2Blocks) {
+      this.logBlockHandled(block, duration / l2Blocks.length, result);
+    }
+
+    this.updateSyncState(l2Blocks.at(-1)!.number);
+    return result;
+  }
+
+  private logBlockHandled(l2Block: L2Block, duration: number, result: WorldStateStatusFull) {
+    this.log.info(`World state updated with L2 block ${l2Block.number}`, {
+      eventName: 'l2-block-handled',
+      duration,
+      unfinalisedBlockNumber: result.summary.unfinalisedBlockNumber,
+      finalisedBlockNumber: result.summary.finalisedBlockNumber,
+      oldestHistoricBlock: result.summary.oldestHistoricalBlock,
+      ...l2Block.getStats(),
+    } satisfies L2BlockHandledStats);
+  }
+
   /**
    * Handles a single L2 block (i.e. Inserts the new note hashes into the merkle tree).
    * @param l2Block - The L2 block to handle.
@@ -324,13 +356,16 @@ export class ServerWorldStateSynchronizer
       l1ToL2Messages: l1ToL2Messages.map(msg => msg.toString()),
     });
     const result = await this.merkleTreeDb.handleL2BlockAndMessages(l2Block, l1ToL2Messages);
+    this.updateSyncState(l2Block.number);
+    return result;
+  }
 
-    if (this.currentState === WorldStateRunningState.SYNCHING && l2Block.number >= this.latestBlockNumberAtStart) {
+  /** Moves to the running state once the blocks up to the latest one at start are handled. */
+  private updateSyncState(handledBlockNumber: number) {
+    if (this.currentState === WorldStateRunningState.SYNCHING && handledBlockNumber >= this.latestBlockNumberAtStart) {
       this.setCurrentState(WorldStateRunningState.RUNNING);
       this.syncPromise.resolve();
     }
-
-    return result;
   }
 
   private async handleChainFinalized(blockNumber: number) {
@@ -42,6 +42,13 @@ export interface MerkleTreeAdminDatabase extends ForkMerkleTreeOperations {
    */
   handleL2BlockAndMessages(block: L2Block, l1ToL2Messages: Fr[]): Promise<WorldStateStatusFull>;
 
+  /**
+   * Handles consecutive L2 blocks as one group, which is committed to disk once rather than block by block.
+   * @param blocks - The L2 blocks to handle, in order.
+   * @param l1ToL2Messages - The L1 to L2 messages of each block.
+   */
+  handleL2BlocksAndMessages(blocks: L2Block[], l1ToL2Messages: Fr[][]): Promise<WorldStateStatusFull>;
+
   /**
    * Gets a handle that allows reading the latest committed state
    */